@@ -58,20 +58,27 @@ void usage_fprint(
 	fprintf( stream, "Use evtxexport to export items stored in a Windows XML Event Viewer\n"
 	                 "Log (EVTX) file.\n\n" );
 
-	fprintf( stream, "Usage: evtxexport [ -c codepage ] [ -f format ] [ -l log_file ]\n"
-	                 "                  [ -m mode ] [ -p resource_files_path ]\n"
+	fprintf( stream, "Usage: evtxexport [ -c codepage ] [ -C catalog_file ] [ -f format ]\n"
+	                 "                  [ -l log_file ] [ -m mode ] [ -p resource_files_path ]\n"
 	                 "                  [ -r registy_files_path ] [ -s system_file ]\n"
 	                 "                  [ -S software_file ] [ -t event_log_type ]\n"
-	                 "                  [ -hTvV ] source\n\n" );
+	                 "                  [ -hMTvV ] source [ source ... ]\n\n" );
 
 
-	fprintf( stream, "\tsource: the source file\n\n" );
+	fprintf( stream, "\tsource: the source file or a directory containing source files,\n"
+	                 "\t        multiple sources can be specified\n\n" );
 
 	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
 	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
 	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
 	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
 	                 "\t        windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-C:     filename of the message catalog, the event messages are\n"
+	                 "\t        resolved from the catalog and the registry and resource\n"
+	                 "\t        files are only read for event messages not in the catalog,\n"
+	                 "\t        newly resolved event messages are stored in the catalog.\n"
+	                 "\t        There is no separate mode to build a catalog, it is\n"
+	                 "\t        created or extended by an export that uses -C\n" );
 	fprintf( stream, "\t-f:     output format, options: xml, text (default)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-l:     logs information about the exported items\n" );
@@ -79,6 +86,10 @@ void usage_fprint(
 	                 "\t        'all' exports the (allocated) items and recovered items,\n"
 	                 "\t        'items' exports the (allocated) items and 'recovered' exports\n"
 	                 "\t        the recovered items\n" );
+	fprintf( stream, "\t-M:     merge the (allocated) items of all sources in written\n"
+	                 "\t        time order, recovered items are not exported. The items\n"
+	                 "\t        of each source are expected to be stored in written time\n"
+	                 "\t        order, otherwise the output is not strictly in time order\n" );
 	fprintf( stream, "\t-p:     search PATH for the resource files\n" );
 	fprintf( stream, "\t-r:     name of the directory containing the SOFTWARE and SYSTEM\n"
 	                 "\t        (Windows) Registry file\n" );
@@ -153,6 +164,7 @@ int main( int argc, char * const argv[] )
 	system_character_t *option_export_format              = NULL;
 	system_character_t *option_export_mode                = NULL;
 	system_character_t *option_log_filename               = NULL;
+	system_character_t *option_message_catalog_filename   = NULL;
 	system_character_t *option_resource_files_path        = NULL;
 	system_character_t *option_preferred_language         = NULL;
 	system_character_t *option_registry_directory_name    = NULL;
@@ -161,7 +173,11 @@ int main( int argc, char * const argv[] )
 	system_character_t *source                            = NULL;
 	char *program                                         = "evtxexport";
 	system_integer_t option                               = 0;
+	int merge_records                                     = 0;
+	int number_of_exported_files                          = 0;
+	int records_exported                                  = 0;
 	int result                                            = 0;
+	int source_index                                      = 0;
 	int use_template_definition                           = 0;
 	int verbose                                           = 0;
 
@@ -198,7 +214,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = evtxtools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "c:f:hl:m:p:r:s:S:t:TvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "c:C:f:hl:m:Mp:r:s:S:t:TvV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -219,6 +235,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'C':
+				option_message_catalog_filename = optarg;
+
+				break;
+
 			case (system_integer_t) 'f':
 				option_export_format = optarg;
 
@@ -240,6 +261,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'M':
+				merge_records = 1;
+
+				break;
+
 			case (system_integer_t) 'p':
 				option_resource_files_path = optarg;
 
@@ -293,8 +319,6 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
-
 	libcnotify_verbose_set(
 	 verbose );
 	libevtx_notify_set_stream(
@@ -408,19 +432,7 @@ int main( int argc, char * const argv[] )
 	if( ( option_event_log_type == NULL )
 	 || ( result == 0 ) )
 	{
-		result = export_handle_set_event_log_type_from_filename(
-			  evtxexport_export_handle,
-			  source,
-			  &error );
-
-		if( result == -1 )
-		{
-			fprintf(
-			 stderr,
-			 "Unable to set event log type from filename in export handle.\n" );
-
-			goto on_error;
-		}
+		evtxexport_export_handle->event_log_type_from_filename = 1;
 	}
 	if( option_resource_files_path != NULL )
 	{
@@ -493,6 +505,21 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_message_catalog_filename != NULL )
+	{
+		if( export_handle_open_message_catalog(
+		     evtxexport_export_handle,
+		     option_message_catalog_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open message catalog: %" PRIs_SYSTEM ".\n",
+			 option_message_catalog_filename );
+
+			goto on_error;
+		}
+	}
 	evtxexport_export_handle->use_template_definition = use_template_definition;
 	evtxexport_export_handle->verbose                 = verbose;
 
@@ -508,38 +535,107 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( export_handle_open_input(
-	     evtxexport_export_handle,
-	     source,
-	     &error ) != 1 )
+	if( merge_records != 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open: %" PRIs_SYSTEM ".\n",
-		 source );
+		if( export_handle_enable_merge(
+		     evtxexport_export_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to enable merge in export handle.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	result = export_handle_export_file(
-	          evtxexport_export_handle,
-	          log_handle,
-	          &error );
+	else if( ( argc - optind ) > 1 )
+	{
+		evtxexport_export_handle->print_source_filename = 1;
+	}
+	/* The export handle is reused for all sources so that the registry files
+	 * and resource files are only opened once
+	 */
+	for( source_index = optind;
+	     source_index < argc;
+	     source_index++ )
+	{
+		if( evtxexport_abort != 0 )
+		{
+			break;
+		}
+		source = argv[ source_index ];
+
+		result = export_handle_export_directory(
+		          evtxexport_export_handle,
+		          source,
+		          log_handle,
+		          &number_of_exported_files,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export directory: %" PRIs_SYSTEM ".\n",
+			 source );
 
-	if( result == -1 )
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			result = export_handle_export_source(
+			          evtxexport_export_handle,
+			          source,
+			          log_handle,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to export file: %" PRIs_SYSTEM ".\n",
+				 source );
+
+				goto on_error;
+			}
+		}
+		/* A directory only counts as exported when at least one of
+		 * its files contained records
+		 */
+		else if( number_of_exported_files == 0 )
+		{
+			result = 0;
+		}
+		if( ( merge_records == 0 )
+		 && ( result != 0 ) )
+		{
+			records_exported = 1;
+		}
+	}
+	if( merge_records != 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to export file.\n" );
+		result = export_handle_export_merged_records(
+		          evtxexport_export_handle,
+		          log_handle,
+		          &error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export merged records.\n" );
+
+			goto on_error;
+		}
+		records_exported = result;
 	}
-	if( export_handle_close_input(
+	if( export_handle_close_message_catalog(
 	     evtxexport_export_handle,
 	     &error ) != 0 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to close export handle.\n" );
+		 "Unable to close message catalog.\n" );
 
 		goto on_error;
 	}
@@ -573,7 +669,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( result == 0 )
+	if( records_exported == 0 )
 	{
 		fprintf(
 		 stdout,
@@ -27,17 +27,20 @@
 #include <wide_string.h>
 
 #include "evtxinput.h"
+#include "evtxtools_libcdirectory.h"
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libcnotify.h"
 #include "evtxtools_libclocale.h"
+#include "evtxtools_libcpath.h"
 #include "evtxtools_libevtx.h"
-#include "evtxtools_libfdatetime.h"
 #include "evtxtools_libfguid.h"
 #include "evtxtools_libfwevt.h"
 #include "export_handle.h"
 #include "log_handle.h"
+#include "message_cache.h"
 #include "message_handle.h"
 #include "message_string.h"
+#include "output_buffer.h"
 #include "resource_file.h"
 
 #define EXPORT_HANDLE_NOTIFY_STREAM		stdout
@@ -177,6 +180,33 @@ int export_handle_initialize(
 
 		goto on_error;
 	}
+	if( template_definition_cache_initialize(
+	     &( ( *export_handle )->template_definition_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create template definition cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_initialize(
+	     &( ( *export_handle )->output_buffer ),
+	     EXPORT_HANDLE_NOTIFY_STREAM,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
 	if( libevtx_file_initialize(
 	     &( ( *export_handle )->input_file ),
 	     error ) != 1 )
@@ -201,6 +231,18 @@ int export_handle_initialize(
 on_error:
 	if( *export_handle != NULL )
 	{
+		if( ( *export_handle )->output_buffer != NULL )
+		{
+			output_buffer_free(
+			 &( ( *export_handle )->output_buffer ),
+			 NULL );
+		}
+		if( ( *export_handle )->template_definition_cache != NULL )
+		{
+			template_definition_cache_free(
+			 &( ( *export_handle )->template_definition_cache ),
+			 NULL );
+		}
 		if( ( *export_handle )->message_handle != NULL )
 		{
 			message_handle_free(
@@ -254,6 +296,51 @@ int export_handle_free(
 				result = -1;
 			}
 		}
+		if( ( *export_handle )->message_handle_is_open != 0 )
+		{
+			if( message_handle_close_input(
+			     ( *export_handle )->message_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input of message handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->merge_handle != NULL )
+		{
+			if( merge_handle_free(
+			     &( ( *export_handle )->merge_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free merge handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( template_definition_cache_free(
+		     &( ( *export_handle )->template_definition_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free template definition cache.",
+			 function );
+
+			result = -1;
+		}
 		if( message_handle_free(
 		     &( ( *export_handle )->message_handle ),
 		     error ) != 1 )
@@ -267,6 +354,40 @@ int export_handle_free(
 
 			result = -1;
 		}
+		if( ( *export_handle )->output_buffer != NULL )
+		{
+			if( output_buffer_flush(
+			     ( *export_handle )->output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush output buffer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( output_buffer_free(
+		     &( ( *export_handle )->output_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output buffer.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *export_handle )->message_string_buffer != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->message_string_buffer );
+		}
 		if( libevtx_file_free(
 		     &( ( *export_handle )->input_file ),
 		     error ) != 1 )
@@ -342,6 +463,45 @@ int export_handle_signal_abort(
 	return( 1 );
 }
 
+/* Enables merging the records of the sources in written time order
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_enable_merge(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_enable_merge";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->merge_handle == NULL )
+	{
+		if( merge_handle_initialize(
+		     &( export_handle->merge_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create merge handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Sets the export mode
  * Returns 1 if successful, 0 if unsupported values or -1 on error
  */
@@ -819,15 +979,78 @@ int export_handle_set_resource_files_path(
 	return( 1 );
 }
 
-/* Opens the input
+/* Opens the message handle for the current event log type
+ * The message handle is opened once and reused for subsequent inputs
+ * so that the registry files and resource file caches are shared
  * Returns 1 if successful or -1 on error
  */
-int export_handle_open_input(
+int export_handle_open_message_handle(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_message_handle";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->message_handle_is_open == 0 )
+	{
+		if( message_handle_open_input(
+		     export_handle->message_handle,
+		     export_handle_get_event_log_key_name(
+		      export_handle->event_log_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input of message handle.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->message_handle_is_open = 1;
+	}
+	else if( message_handle_set_eventlog_key_name(
+	          export_handle->message_handle,
+	          export_handle_get_event_log_key_name(
+	           export_handle->event_log_type ),
+	          error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set eventlog key name in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->message_handle_event_log_type = export_handle->event_log_type;
+
+	return( 1 );
+}
+
+/* Opens the message catalog
+ * The message catalog contains the resolved event messages of previous runs
+ * and is read into the message cache of the message handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_message_catalog(
      export_handle_t *export_handle,
      const system_character_t *filename,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_open_input";
+	static char *function = "export_handle_open_message_catalog";
 
 	if( export_handle == NULL )
 	{
@@ -840,83 +1063,74 @@ int export_handle_open_input(
 
 		return( -1 );
 	}
-	if( export_handle->input_is_open != 0 )
+	if( export_handle->message_catalog_filename != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid export handle input is already open.",
+		 "%s: invalid export handle - message catalog filename value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( message_handle_open_input(
-	     export_handle->message_handle,
-	     export_handle_get_event_log_key_name(
-	      export_handle->event_log_type ),
-	     error ) != 1 )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input of message handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( libevtx_file_set_ascii_codepage(
-	     export_handle->input_file,
-	     export_handle->ascii_codepage,
+	/* All entries are retained so that they can be written back to the message catalog
+	 */
+	if( message_cache_set_maximum_number_of_entries(
+	     export_handle->message_handle->message_cache,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set ASCII codepage in input file.",
+		 "%s: unable to set maximum number of entries in message cache.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libevtx_file_open_wide(
-	     export_handle->input_file,
-	     filename,
-	     LIBEVTX_OPEN_READ,
-	     error ) != 1 )
-#else
-	if( libevtx_file_open(
-	     export_handle->input_file,
+	/* A message catalog that does not exist yet is created on close
+	 */
+	if( message_cache_read_file(
+	     export_handle->message_handle->message_cache,
 	     filename,
-	     LIBEVTX_OPEN_READ,
-	     error ) != 1 )
-#endif
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input file.",
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read message catalog.",
 		 function );
 
 		return( -1 );
 	}
-	export_handle->input_is_open = 1;
+	export_handle->message_catalog_filename = filename;
 
 	return( 1 );
 }
 
-/* Closes the input
- * Returns the 0 if succesful or -1 on error
+/* Closes the message catalog
+ * The message catalog is only written when new event messages were resolved
+ * Returns 0 if successful or -1 on error
  */
-int export_handle_close_input(
+int export_handle_close_message_catalog(
      export_handle_t *export_handle,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_close_input";
-	int result            = 0;
+	static char *function = "export_handle_close_message_catalog";
 
 	if( export_handle == NULL )
 	{
@@ -929,53 +1143,42 @@ int export_handle_close_input(
 
 		return( -1 );
 	}
-	if( export_handle->input_is_open != 0 )
+	if( export_handle->message_catalog_filename == NULL )
 	{
-		if( message_handle_close_input(
-		     export_handle->message_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close input of message handle.",
-			 function );
-
-			result = -1;
-		}
-		if( libevtx_file_close(
-		     export_handle->input_file,
-		     error ) != 0 )
+		return( 0 );
+	}
+	if( export_handle->message_handle->message_cache->is_modified != 0 )
+	{
+		if( message_cache_write_file(
+		     export_handle->message_handle->message_cache,
+		     export_handle->message_catalog_filename,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close input file.",
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write message catalog.",
 			 function );
 
-			result = -1;
+			return( -1 );
 		}
-		export_handle->input_is_open = 0;
 	}
-	return( result );
+	export_handle->message_catalog_filename = NULL;
+
+	return( 0 );
 }
 
-/* Copies the GUID string to a byte stream
+/* Opens the input
  * Returns 1 if successful or -1 on error
  */
-int export_handle_guid_string_copy_to_byte_stream(
+int export_handle_open_input(
      export_handle_t *export_handle,
-     const system_character_t *string,
-     size_t string_length,
-     uint8_t *byte_stream,
-     size_t byte_stream_size,
+     const system_character_t *filename,
      libcerror_error_t **error )
 {
-	libfguid_identifier_t *guid = NULL;
-	static char *function       = "export_handle_guid_string_copy_to_byte_stream";
-	int result                  = 0;
+	static char *function = "export_handle_open_input";
+	int access_flags      = LIBEVTX_OPEN_READ;
 
 	if( export_handle == NULL )
 	{
@@ -988,37 +1191,186 @@ int export_handle_guid_string_copy_to_byte_stream(
 
 		return( -1 );
 	}
-	if( libfguid_identifier_initialize(
-	     &guid,
-	     error ) != 1 )
+	if( export_handle->input_is_open != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create GUID.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle input is already open.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfguid_identifier_copy_from_utf16_string(
-		  guid,
-		  (uint16_t *) string,
-		  string_length,
-		  LIBFGUID_STRING_FORMAT_FLAG_USE_MIXED_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
-		  error );
-#else
-	result = libfguid_identifier_copy_from_utf8_string(
-		  guid,
-		  (uint8_t *) string,
-		  string_length,
-		  LIBFGUID_STRING_FORMAT_FLAG_USE_MIXED_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
-		  error );
-#endif
-	if( result != 1 )
+	/* With a message catalog the message handle is opened when an event message
+	 * cannot be resolved from the message catalog
+	 */
+	if( export_handle->message_catalog_filename == NULL )
 	{
-		libcerror_error_set(
+		if( export_handle_open_message_handle(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open message handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_file_set_ascii_codepage(
+	     export_handle->input_file,
+	     export_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in input file.",
+		 function );
+
+		return( -1 );
+	}
+	/* Records are exported in order, hence the chunks are read sequentially
+	 */
+	access_flags |= LIBEVTX_ACCESS_FLAG_READ_AHEAD;
+
+	/* Recovered records are not exported in items mode
+	 */
+	if( export_handle->export_mode == EXPORT_MODE_ITEMS )
+	{
+		access_flags |= LIBEVTX_ACCESS_FLAG_NO_RECOVERY;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_file_open_wide(
+	     export_handle->input_file,
+	     filename,
+	     access_flags,
+	     error ) != 1 )
+#else
+	if( libevtx_file_open(
+	     export_handle->input_file,
+	     filename,
+	     access_flags,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->input_is_open = 1;
+
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_input";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
+	{
+		if( libevtx_file_close(
+		     export_handle->input_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file.",
+			 function );
+
+			result = -1;
+		}
+		export_handle->input_is_open = 0;
+	}
+	return( result );
+}
+
+/* Copies the GUID string to a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_guid_string_copy_to_byte_stream(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     size_t string_length,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfguid_identifier_t *guid = NULL;
+	static char *function       = "export_handle_guid_string_copy_to_byte_stream";
+	int result                  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfguid_identifier_initialize(
+	     &guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create GUID.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfguid_identifier_copy_from_utf16_string(
+		  guid,
+		  (uint16_t *) string,
+		  string_length,
+		  LIBFGUID_STRING_FORMAT_FLAG_USE_MIXED_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
+		  error );
+#else
+	result = libfguid_identifier_copy_from_utf8_string(
+		  guid,
+		  (uint8_t *) string,
+		  string_length,
+		  LIBFGUID_STRING_FORMAT_FLAG_USE_MIXED_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
@@ -1164,7 +1516,6 @@ int export_handle_resource_file_get_template_definition(
 
 			goto on_error;
 		}
-/* TODO cache the EVTX template definitions ? */
 		if( libevtx_template_definition_initialize(
 		     template_definition,
 		     error ) != 1 )
@@ -1264,37 +1615,27 @@ on_error:
 	return( -1 );
 }
 
-/* Exports the record event message
- * Returns 1 if successful or -1 on error
+/* Retrieves the template definition of a specific event
+ * The template definitions are cached per provider identifier, event identifier and version
+ * The template definition is owned by the template definition cache
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int export_handle_export_record_event_message(
+int export_handle_get_template_definition(
      export_handle_t *export_handle,
-     libevtx_record_t *record,
-     const system_character_t *event_provider_identifier,
-     size_t event_provider_identifier_length,
-     const system_character_t *event_source,
-     size_t event_source_length,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
      uint32_t event_identifier,
-     log_handle_t *log_handle,
+     uint8_t event_version,
+     libevtx_template_definition_t **template_definition,
      libcerror_error_t **error )
 {
-	uint8_t provider_identifier[ 16 ];
-
-	libevtx_template_definition_t *template_definition = NULL;
-	message_string_t *message_string                   = NULL;
-	resource_file_t *resource_file                     = NULL;
-	system_character_t *message_filename               = NULL;
-	system_character_t *resource_filename              = NULL;
-	system_character_t *value_string                   = NULL;
-	static char *function                              = "export_handle_export_record_event_message";
-	size_t message_filename_size                       = 0;
-	size_t resource_filename_size                      = 0;
-	size_t value_string_size                           = 0;
-	uint32_t event_identifier_qualifiers               = 0;
-	uint32_t message_identifier                        = 0;
-	int number_of_strings                              = 0;
-	int result                                         = 0;
-	int value_string_index                             = 0;
+	libevtx_template_definition_t *safe_template_definition            = NULL;
+	resource_file_t *resource_file                                     = NULL;
+	template_definition_cache_entry_t *template_definition_cache_entry = NULL;
+	static char *function                                              = "export_handle_get_template_definition";
+	int result                                                         = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1307,109 +1648,93 @@ int export_handle_export_record_event_message(
 
 		return( -1 );
 	}
-	if( event_provider_identifier != NULL )
+	if( template_definition == NULL )
 	{
-		result = message_handle_get_value_by_provider_identifier(
-		          export_handle->message_handle,
-		          event_provider_identifier,
-		          event_provider_identifier_length,
-		          _SYSTEM_STRING( "ResourceFileName" ),
-		          16,
-		          &resource_filename,
-		          &resource_filename_size,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource filename by provider identifier.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
 
-			goto on_error;
-		}
-		result = message_handle_get_value_by_provider_identifier(
-		          export_handle->message_handle,
-		          event_provider_identifier,
-		          event_provider_identifier_length,
-		          _SYSTEM_STRING( "MessageFileName" ),
-		          15,
-		          &message_filename,
-		          &message_filename_size,
-		          error );
+		return( -1 );
+	}
+	result = template_definition_cache_get_entry(
+	          export_handle->template_definition_cache,
+	          provider_identifier,
+	          provider_identifier_size,
+	          event_identifier,
+	          event_version,
+	          &template_definition_cache_entry,
+	          error );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message filename by provider identifier.",
-			 function );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template definition cache entry.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	if( ( message_filename == NULL )
-	 && ( event_source != NULL ) )
+	else if( result != 0 )
 	{
-		result = message_handle_get_value_by_event_source(
-		          export_handle->message_handle,
-		          event_source,
-		          event_source_length,
-		          _SYSTEM_STRING( "EventMessageFile" ),
-		          16,
-		          &message_filename,
-		          &message_filename_size,
-		          error );
+		*template_definition = template_definition_cache_entry->template_definition;
 
-		if( result == -1 )
+		if( *template_definition == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message filename by event source.",
-			 function );
-
-			goto on_error;
+			return( 0 );
 		}
+		return( 1 );
 	}
-	if( resource_filename != NULL )
-	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Resource filename\t\t: %" PRIs_SYSTEM "\n",
-		 resource_filename );
-	}
-	if( resource_filename != NULL )
+	if( ( export_handle->message_handle_is_open == 0 )
+	 || ( export_handle->message_handle_event_log_type != export_handle->event_log_type ) )
 	{
-		if( export_handle_guid_string_copy_to_byte_stream(
+		if( export_handle_open_message_handle(
 		     export_handle,
-		     event_provider_identifier,
-		     event_provider_identifier_length,
-		     provider_identifier,
-		     16,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to copy GUID from string.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open message handle.",
 			 function );
 
 			goto on_error;
 		}
-		result = message_handle_get_resource_file_by_provider_identifier(
-			  export_handle->message_handle,
-			  resource_filename,
-			  resource_filename_size - 1,
+	}
+	result = message_handle_get_resource_file_by_provider_identifier(
+		  export_handle->message_handle,
+		  resource_filename,
+		  resource_filename_length,
+		  provider_identifier,
+		  provider_identifier_size,
+		  &resource_file,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = export_handle_resource_file_get_template_definition(
+			  export_handle,
+			  resource_file,
 			  provider_identifier,
-			  16,
-			  &resource_file,
+			  provider_identifier_size,
+			  event_identifier,
+			  &safe_template_definition,
 			  error );
 
 		if( result == -1 )
@@ -1418,45 +1743,299 @@ int export_handle_export_record_event_message(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource file.",
+			 "%s: unable to retrieve template definition.",
 			 function );
 
 			goto on_error;
 		}
-		else if( result != 0 )
-		{
-			result = resource_file_get_event_message_identifier(
-				  resource_file,
-				  provider_identifier,
-				  16,
-				  event_identifier,
-				  &message_identifier,
-				  error );
-
-			if( result == -1 )
-			{
+	}
+	/* A template definition that is not available is cached as well
+	 * so that the resource file is not searched again
+	 */
+	if( template_definition_cache_insert_template_definition(
+	     export_handle->template_definition_cache,
+	     provider_identifier,
+	     provider_identifier_size,
+	     event_identifier,
+	     event_version,
+	     safe_template_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert template definition into cache.",
+		 function );
+
+		goto on_error;
+	}
+	*template_definition = safe_template_definition;
+
+	if( safe_template_definition == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( safe_template_definition != NULL )
+	{
+		libevtx_template_definition_free(
+		 &safe_template_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the record event message
+ * The resolved event message is cached in the message handle per provider
+ * identifier, event source, event identifier, qualifiers and language
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_event_message(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     const system_character_t *event_provider_identifier,
+     size_t event_provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	uint8_t provider_identifier[ 16 ];
+
+	libevtx_template_definition_t *template_definition  = NULL;
+	message_cache_entry_t *message_cache_entry          = NULL;
+	message_cache_entry_t *resolved_message_cache_entry = NULL;
+	message_string_t *message_string                    = NULL;
+	resource_file_t *resource_file                      = NULL;
+	system_character_t *append_buffer                   = NULL;
+	static char *function                               = "export_handle_export_record_event_message";
+	size_t formatted_string_length                      = 0;
+	size_t value_string_size                            = 0;
+	uint32_t event_identifier_qualifiers                = 0;
+	uint8_t event_version                               = 0;
+	uint8_t has_event_identifier_qualifiers             = 0;
+	int number_of_strings                               = 0;
+	int result                                          = 0;
+	int value_string_index                              = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_get_event_identifier_qualifiers(
+		  record,
+		  &event_identifier_qualifiers,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier qualifiers.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		has_event_identifier_qualifiers = 1;
+	}
+	result = message_cache_get_entry(
+	          export_handle->message_handle->message_cache,
+	          export_handle->event_log_type,
+	          event_provider_identifier,
+	          event_provider_identifier_length,
+	          event_source,
+	          event_source_length,
+	          event_identifier,
+	          event_identifier_qualifiers,
+	          has_event_identifier_qualifiers,
+	          export_handle->message_handle->preferred_language_identifier,
+	          &message_cache_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_cache_entry == NULL )
+	{
+		if( ( export_handle->message_handle_is_open == 0 )
+		 || ( export_handle->message_handle_event_log_type != export_handle->event_log_type ) )
+		{
+			if( export_handle_open_message_handle(
+			     export_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open message handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( message_cache_entry_initialize(
+		     &resolved_message_cache_entry,
+		     export_handle->event_log_type,
+		     event_provider_identifier,
+		     event_provider_identifier_length,
+		     event_source,
+		     event_source_length,
+		     event_identifier,
+		     event_identifier_qualifiers,
+		     has_event_identifier_qualifiers,
+		     export_handle->message_handle->preferred_language_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create message cache entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( event_provider_identifier != NULL )
+		{
+			result = message_handle_get_value_by_provider_identifier(
+			          export_handle->message_handle,
+			          event_provider_identifier,
+			          event_provider_identifier_length,
+			          _SYSTEM_STRING( "ResourceFileName" ),
+			          16,
+			          &( resolved_message_cache_entry->resource_filename ),
+			          &( resolved_message_cache_entry->resource_filename_size ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve resource filename by provider identifier.",
+				 function );
+
+				goto on_error;
+			}
+			result = message_handle_get_value_by_provider_identifier(
+			          export_handle->message_handle,
+			          event_provider_identifier,
+			          event_provider_identifier_length,
+			          _SYSTEM_STRING( "MessageFileName" ),
+			          15,
+			          &( resolved_message_cache_entry->message_filename ),
+			          &( resolved_message_cache_entry->message_filename_size ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve message filename by provider identifier.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( resolved_message_cache_entry->message_filename == NULL )
+		 && ( event_source != NULL ) )
+		{
+			result = message_handle_get_value_by_event_source(
+			          export_handle->message_handle,
+			          event_source,
+			          event_source_length,
+			          _SYSTEM_STRING( "EventMessageFile" ),
+			          16,
+			          &( resolved_message_cache_entry->message_filename ),
+			          &( resolved_message_cache_entry->message_filename_size ),
+			          error );
+
+			if( result == -1 )
+			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve message identifier.",
+				 "%s: unable to retrieve message filename by event source.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( resolved_message_cache_entry->resource_filename != NULL )
+		{
+			if( export_handle_guid_string_copy_to_byte_stream(
+			     export_handle,
+			     event_provider_identifier,
+			     event_provider_identifier_length,
+			     provider_identifier,
+			     16,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to copy GUID from string.",
 				 function );
 
 				goto on_error;
 			}
-			else if( result == 0 )
+			result = message_handle_get_resource_file_by_provider_identifier(
+				  export_handle->message_handle,
+				  resolved_message_cache_entry->resource_filename,
+				  resolved_message_cache_entry->resource_filename_size - 1,
+				  provider_identifier,
+				  16,
+				  &resource_file,
+				  error );
+
+			if( result == -1 )
 			{
-				message_identifier = 0;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve resource file.",
+				 function );
+
+				goto on_error;
 			}
-			if( export_handle->use_template_definition != 0 )
+			else if( result != 0 )
 			{
-				result = export_handle_resource_file_get_template_definition(
-					  export_handle,
+				result = resource_file_get_event_message_identifier(
 					  resource_file,
 					  provider_identifier,
 					  16,
 					  event_identifier,
-					  &template_definition,
+					  &( resolved_message_cache_entry->message_identifier ),
 					  error );
 
 				if( result == -1 )
@@ -1465,30 +2044,34 @@ int export_handle_export_record_event_message(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve tempate definition.",
+					 "%s: unable to retrieve message identifier.",
 					 function );
 
 					goto on_error;
 				}
+				else if( result == 0 )
+				{
+					resolved_message_cache_entry->message_identifier = 0;
+				}
 			}
 		}
-		memory_free(
-		 resource_filename );
-
-		resource_filename = NULL;
-	}
-	if( message_filename != NULL )
-	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Message filename\t\t: %" PRIs_SYSTEM "\n",
-		 message_filename );
-
-		if( message_identifier == 0 )
+		if( resolved_message_cache_entry->message_filename != NULL )
 		{
-			result = libevtx_record_get_event_identifier_qualifiers(
-				  record,
-				  &event_identifier_qualifiers,
+			if( resolved_message_cache_entry->message_identifier == 0 )
+			{
+				if( has_event_identifier_qualifiers != 0 )
+				{
+					resolved_message_cache_entry->message_identifier                 = event_identifier_qualifiers << 16;
+					resolved_message_cache_entry->message_identifier_from_qualifiers = 1;
+				}
+				resolved_message_cache_entry->message_identifier |= event_identifier;
+			}
+			result = message_handle_get_message_string(
+				  export_handle->message_handle,
+				  resolved_message_cache_entry->message_filename,
+				  resolved_message_cache_entry->message_filename_size - 1,
+				  resolved_message_cache_entry->message_identifier,
+				  &message_string,
 				  error );
 
 			if( result == -1 )
@@ -1497,123 +2080,443 @@ int export_handle_export_record_event_message(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve event identifier qualifiers.",
+				 "%s: unable to retrieve message string.",
 				 function );
 
 				goto on_error;
 			}
-			else if( result != 0 )
-			{
-				if( export_handle->verbose != 0 )
-				{
-					fprintf(
-					 export_handle->notify_stream,
-					 "Event identifier qualifiers\t: 0x%08" PRIx32 "\n",
-					 event_identifier_qualifiers );
-				}
-				message_identifier = event_identifier_qualifiers << 16;
-			}
-			message_identifier |= event_identifier;
 		}
-		if( export_handle->verbose != 0 )
-		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Message identifier\t\t: 0x%08" PRIx32 "\n",
-			 message_identifier );
-		}
-		result = message_handle_get_message_string(
-			  export_handle->message_handle,
-			  message_filename,
-			  message_filename_size - 1,
-			  message_identifier,
-			  &message_string,
-			  error );
+		message_cache_entry = resolved_message_cache_entry;
 
-		if( result == -1 )
+		/* The message string is owned by the resource file message cache
+		 * hence the message cache entry stores a copy
+		 */
+		if( message_string_clone(
+		     &( resolved_message_cache_entry->message_string ),
+		     message_string,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message string.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone message string.",
 			 function );
 
 			goto on_error;
 		}
-		memory_free(
-		 message_filename );
+		if( message_cache_insert_entry(
+		     export_handle->message_handle->message_cache,
+		     resolved_message_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert message cache entry.",
+			 function );
 
-		message_filename = NULL;
+			goto on_error;
+		}
+		resolved_message_cache_entry = NULL;
 	}
-	if( export_handle->use_template_definition != 0 )
+	message_string = message_cache_entry->message_string;
+
+	if( ( export_handle->use_template_definition != 0 )
+	 && ( event_provider_identifier != NULL )
+	 && ( message_cache_entry->resource_filename != NULL ) )
 	{
-		result = libevtx_record_parse_data_with_template_definition(
-			  record,
-			  template_definition,
-			  error );
+		if( export_handle_guid_string_copy_to_byte_stream(
+		     export_handle,
+		     event_provider_identifier,
+		     event_provider_identifier_length,
+		     provider_identifier,
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy GUID from string.",
+			 function );
+
+			goto on_error;
+		}
+		result = libevtx_record_get_event_version(
+		          record,
+		          &event_version,
+		          error );
 
 		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to parse record data.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event version.",
 			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
+			goto on_error;
 		}
-		if( libevtx_template_definition_free(
-		     &template_definition,
-		     error ) != 1 )
+		result = export_handle_get_template_definition(
+		          export_handle,
+		          message_cache_entry->resource_filename,
+		          message_cache_entry->resource_filename_size - 1,
+		          provider_identifier,
+		          16,
+		          event_identifier,
+		          event_version,
+		          &template_definition,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free template definition.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template definition.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	if( libevtx_record_get_number_of_strings(
-	     record,
-	     &number_of_strings,
-	     error ) != 1 )
+	if( message_cache_entry->resource_filename != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of strings in record.",
-		 function );
-
-		goto on_error;
-	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Number of strings\t\t: %d\n",
-	 number_of_strings );
-
-	for( value_string_index = 0;
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "Resource filename\t\t: " ),
+		     21,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append resource filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     message_cache_entry->resource_filename,
+		     message_cache_entry->resource_filename_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append resource filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "\n" ),
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append resource filename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( message_cache_entry->message_filename != NULL )
+	{
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "Message filename\t\t: " ),
+		     20,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append message filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     message_cache_entry->message_filename,
+		     message_cache_entry->message_filename_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append message filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "\n" ),
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append message filename.",
+			 function );
+
+			goto on_error;
+		}
+
+		if( export_handle->verbose != 0 )
+		{
+			if( message_cache_entry->message_identifier_from_qualifiers != 0 )
+			{
+				if( output_buffer_append_string(
+				     export_handle->output_buffer,
+				     _SYSTEM_STRING( "Event identifier qualifiers\t: " ),
+				     30,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append event identifier qualifiers.",
+					 function );
+
+					goto on_error;
+				}
+				if( output_buffer_append_hexadecimal_32bit(
+				     export_handle->output_buffer,
+				     event_identifier_qualifiers,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append event identifier qualifiers.",
+					 function );
+
+					goto on_error;
+				}
+				if( output_buffer_append_string(
+				     export_handle->output_buffer,
+				     _SYSTEM_STRING( "\n" ),
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append event identifier qualifiers.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( output_buffer_append_string(
+			     export_handle->output_buffer,
+			     _SYSTEM_STRING( "Message identifier\t\t: " ),
+			     22,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append message identifier.",
+				 function );
+
+				goto on_error;
+			}
+			if( output_buffer_append_hexadecimal_32bit(
+			     export_handle->output_buffer,
+			     message_cache_entry->message_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append message identifier.",
+				 function );
+
+				goto on_error;
+			}
+			if( output_buffer_append_string(
+			     export_handle->output_buffer,
+			     _SYSTEM_STRING( "\n" ),
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append message identifier.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	message_cache_entry = NULL;
+
+	/* The template definition is owned by the template definition cache
+	 */
+	if( template_definition != NULL )
+	{
+		result = libevtx_record_parse_data_with_template_definition(
+			  record,
+			  template_definition,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse record data.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		template_definition = NULL;
+	}
+	if( libevtx_record_get_number_of_strings(
+	     record,
+	     &number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings in record.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( "Number of strings\t\t: " ),
+	     21,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append number of strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_decimal_64bit(
+	     export_handle->output_buffer,
+	     (uint64_t) number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append number of strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( "\n" ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append number of strings.",
+		 function );
+
+		goto on_error;
+	}
+
+	for( value_string_index = 0;
 	     value_string_index < number_of_strings;
 	     value_string_index++ )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "String: %d\t\t\t: ",
-		 value_string_index + 1 );
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "String: " ),
+		     8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string: %d.",
+			 function,
+			 value_string_index );
+
+			goto on_error;
+		}
+		if( output_buffer_append_decimal_64bit(
+		     export_handle->output_buffer,
+		     (uint64_t) value_string_index + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string: %d.",
+			 function,
+			 value_string_index );
+
+			goto on_error;
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "\t\t\t: " ),
+		     5,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string: %d.",
+			 function,
+			 value_string_index );
+
+			goto on_error;
+		}
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libevtx_record_get_utf16_string_size(
@@ -1642,16 +2545,17 @@ int export_handle_export_record_event_message(
 		}
 		if( value_string_size > 0 )
 		{
-			value_string = system_string_allocate(
-					value_string_size );
-
-			if( value_string == NULL )
+			if( output_buffer_get_append_buffer(
+			     export_handle->output_buffer,
+			     value_string_size,
+			     &append_buffer,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value string.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve append buffer.",
 				 function );
 
 				goto on_error;
@@ -1660,14 +2564,14 @@ int export_handle_export_record_event_message(
 			result = libevtx_record_get_utf16_string(
 				  record,
 				  value_string_index,
-				  (uint16_t *) value_string,
+				  (uint16_t *) append_buffer,
 				  value_string_size,
 				  error );
 #else
 			result = libevtx_record_get_utf8_string(
 				  record,
 				  value_string_index,
-				  (uint8_t *) value_string,
+				  (uint8_t *) append_buffer,
 				  value_string_size,
 				  error );
 #endif
@@ -1683,62 +2587,113 @@ int export_handle_export_record_event_message(
 
 				goto on_error;
 			}
-			fprintf(
-			 export_handle->notify_stream,
-			 "%" PRIs_SYSTEM "",
-			 value_string );
+			if( output_buffer_commit_string(
+			     export_handle->output_buffer,
+			     value_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append string: %d.",
+				 function,
+				 value_string_index );
 
-			memory_free(
-			 value_string );
+				goto on_error;
+			}
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "\n" ),
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string: %d.",
+			 function,
+			 value_string_index );
 
-			value_string = NULL;
+			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "\n" );
 	}
 	if( message_string != NULL )
 	{
-		if( message_string_fprint(
+		if( message_string_format(
 		     message_string,
 		     record,
-		     export_handle->notify_stream,
+		     &( export_handle->message_string_buffer ),
+		     &( export_handle->message_string_buffer_size ),
+		     &formatted_string_length,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print message string.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to format message string.",
 			 function );
 
 			goto on_error;
 		}
-		message_string = NULL;
-	}
-	return( 1 );
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "Message string\t\t\t: " ),
+		     19,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append message string.",
+			 function );
 
-on_error:
-	if( value_string != NULL )
-	{
-		memory_free(
-		 value_string );
-	}
-	if( template_definition != NULL )
-	{
-		libevtx_template_definition_free(
-		 &template_definition,
-		 NULL );
-	}
-	if( message_filename != NULL )
-	{
-		memory_free(
-		 message_filename );
+			goto on_error;
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     export_handle->message_string_buffer,
+		     formatted_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append message string.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "\n" ),
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append message string.",
+			 function );
+
+			goto on_error;
+		}
+		message_string = NULL;
 	}
-	if( resource_filename != NULL )
+	return( 1 );
+
+on_error:
+	if( resolved_message_cache_entry != NULL )
 	{
-		memory_free(
-		 resource_filename );
+		message_cache_entry_free(
+		 &resolved_message_cache_entry,
+		 NULL );
 	}
 	return( -1 );
 }
@@ -1753,6 +2708,7 @@ int export_handle_export_record(
      libcerror_error_t **error )
 {
 	static char *function = "export_handle_export_record";
+	int result            = 1;
 
 	if( export_handle == NULL )
 	{
@@ -1780,7 +2736,7 @@ int export_handle_export_record(
 			 "%s: unable to export record in text.",
 			 function );
 
-			return( -1 );
+			result = -1;
 		}
 	}
 	else if( export_handle->export_format == EXPORT_FORMAT_XML )
@@ -1798,10 +2754,30 @@ int export_handle_export_record(
 			 "%s: unable to export record in XML.",
 			 function );
 
-			return( -1 );
+			result = -1;
 		}
 	}
-	return( 1 );
+	/* The output of a record that could not be exported is flushed so that
+	 * it precedes any notification about the failure
+	 */
+	if( ( result != 1 )
+	 || ( export_handle->output_buffer->buffer_offset >= OUTPUT_BUFFER_FLUSH_SIZE ) )
+	{
+		if( output_buffer_flush(
+		     export_handle->output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output buffer.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
 }
 
 /* Exports the record in the text format
@@ -1813,12 +2789,10 @@ int export_handle_export_record_text(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	system_character_t filetime_string[ 48 ];
-
-	libfdatetime_filetime_t *filetime       = NULL;
+	system_character_t *append_buffer       = NULL;
 	system_character_t *source_name         = NULL;
 	system_character_t *provider_identifier = NULL;
-	system_character_t *value_string        = NULL;
+	const char *event_level_string          = NULL;
 	static char *function                   = "export_handle_export_record_text";
 	size_t source_name_size                 = 0;
 	size_t provider_identifier_size         = 0;
@@ -1851,37 +2825,64 @@ int export_handle_export_record_text(
 
 		return( -1 );
 	}
-	if( libfdatetime_filetime_initialize(
-	     &filetime,
+	if( libevtx_record_get_identifier(
+	     record,
+	     &value_64bit,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create filetime.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
 		 function );
 
 		goto on_error;
 	}
-	if( libevtx_record_get_identifier(
-	     record,
-	     &value_64bit,
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( "Event number\t\t\t: " ),
+	     17,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve identifier.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event number.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_decimal_64bit(
+	     export_handle->output_buffer,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event number.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( "\n" ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event number.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event number\t\t\t: %" PRIu64 "\n",
-	 value_64bit );
 
 	result = libevtx_record_get_creation_time(
 	          record,
@@ -1901,50 +2902,50 @@ int export_handle_export_record_text(
 	}
 	else if( result != 0 )
 	{
-		if( libfdatetime_filetime_copy_from_64bit(
-		     filetime,
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "Creation time\t\t\t: " ),
+		     18,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append creation time.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_append_filetime(
+		     export_handle->output_buffer,
 		     value_64bit,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to copy filetime from 64-bit.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append creation time.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfdatetime_filetime_copy_to_utf16_string(
-			  filetime,
-			  (uint16_t *) filetime_string,
-			  48,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			  error );
-#else
-		result = libfdatetime_filetime_copy_to_utf8_string(
-			  filetime,
-			  (uint8_t *) filetime_string,
-			  48,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			  error );
-#endif
-		if( result != 1 )
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( " UTC\n" ),
+		     5,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to copy filetime to string.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append creation time.",
 			 function );
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Creation time\t\t\t: %" PRIs_SYSTEM " UTC\n",
-		 filetime_string );
 	}
 	if( libevtx_record_get_written_time(
 	     record,
@@ -1960,60 +2961,46 @@ int export_handle_export_record_text(
 
 		goto on_error;
 	}
-	if( libfdatetime_filetime_copy_from_64bit(
-	     filetime,
-	     value_64bit,
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( "Written time\t\t\t: " ),
+	     17,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy filetime from 64-bit.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append written time.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfdatetime_filetime_copy_to_utf16_string(
-		  filetime,
-		  (uint16_t *) filetime_string,
-		  48,
-		  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-		  error );
-#else
-	result = libfdatetime_filetime_copy_to_utf8_string(
-		  filetime,
-		  (uint8_t *) filetime_string,
-		  48,
-		  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-		  error );
-#endif
-	if( result != 1 )
+	if( output_buffer_append_filetime(
+	     export_handle->output_buffer,
+	     value_64bit,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy filetime to string.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append written time.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Written time\t\t\t: %" PRIs_SYSTEM " UTC\n",
-	 filetime_string );
-
-	if( libfdatetime_filetime_free(
-	     &filetime,
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( " UTC\n" ),
+	     5,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free filetime.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append written time.",
 		 function );
 
 		goto on_error;
@@ -2036,10 +3023,50 @@ int export_handle_export_record_text(
 	}
 	else if( result != 0 )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Event version\t\t\t: %d\n",
-		 event_version );
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "Event version\t\t\t: " ),
+		     18,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event version.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_append_decimal_64bit(
+		     export_handle->output_buffer,
+		     (uint64_t) event_version,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event version.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "\n" ),
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event version.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( libevtx_record_get_event_level(
 	     record,
@@ -2055,12 +3082,84 @@ int export_handle_export_record_text(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event level\t\t\t: %s (%d)\n",
-	 export_handle_get_event_level(
-	  event_level ),
-	 event_level );
+	event_level_string = export_handle_get_event_level(
+	                      event_level );
+
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( "Event level\t\t\t: " ),
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event level.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_narrow_string(
+	     export_handle->output_buffer,
+	     event_level_string,
+	     narrow_string_length(
+	      event_level_string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event level.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( " (" ),
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event level.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_decimal_64bit(
+	     export_handle->output_buffer,
+	     (uint64_t) event_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event level.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( ")\n" ),
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event level.",
+		 function );
+
+		goto on_error;
+	}
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libevtx_record_get_utf16_user_security_identifier_size(
@@ -2087,16 +3186,32 @@ int export_handle_export_record_text(
 	if( ( result != 0 )
 	 && ( value_string_size > 0 ) )
 	{
-		value_string = system_string_allocate(
-		                value_string_size );
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "User security identifier\t: " ),
+		     27,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append user security identifier.",
+			 function );
 
-		if( value_string == NULL )
+			goto on_error;
+		}
+		if( output_buffer_get_append_buffer(
+		     export_handle->output_buffer,
+		     value_string_size,
+		     &append_buffer,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create value string.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve append buffer.",
 			 function );
 
 			goto on_error;
@@ -2104,13 +3219,13 @@ int export_handle_export_record_text(
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libevtx_record_get_utf16_user_security_identifier(
 		          record,
-		          (uint16_t *) value_string,
+		          (uint16_t *) append_buffer,
 		          value_string_size,
 		          error );
 #else
 		result = libevtx_record_get_utf8_user_security_identifier(
 		          record,
-		          (uint8_t *) value_string,
+		          (uint8_t *) append_buffer,
 		          value_string_size,
 		          error );
 #endif
@@ -2125,15 +3240,35 @@ int export_handle_export_record_text(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "User security identifier\t: %" PRIs_SYSTEM "\n",
-		 value_string );
+		if( output_buffer_commit_string(
+		     export_handle->output_buffer,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append user security identifier.",
+			 function );
 
-		memory_free(
-		 value_string );
+			goto on_error;
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "\n" ),
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append user security identifier.",
+			 function );
 
-		value_string = NULL;
+			goto on_error;
+		}
 	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libevtx_record_get_utf16_computer_name_size(
@@ -2160,16 +3295,32 @@ int export_handle_export_record_text(
 	if( ( result != 0 )
 	 && ( value_string_size > 0 ) )
 	{
-		value_string = system_string_allocate(
-		                value_string_size );
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "Computer name\t\t\t: " ),
+		     18,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append computer name.",
+			 function );
 
-		if( value_string == NULL )
+			goto on_error;
+		}
+		if( output_buffer_get_append_buffer(
+		     export_handle->output_buffer,
+		     value_string_size,
+		     &append_buffer,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create value string.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve append buffer.",
 			 function );
 
 			goto on_error;
@@ -2177,13 +3328,13 @@ int export_handle_export_record_text(
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libevtx_record_get_utf16_computer_name(
 		          record,
-		          (uint16_t *) value_string,
+		          (uint16_t *) append_buffer,
 		          value_string_size,
 		          error );
 #else
 		result = libevtx_record_get_utf8_computer_name(
 		          record,
-		          (uint8_t *) value_string,
+		          (uint8_t *) append_buffer,
 		          value_string_size,
 		          error );
 #endif
@@ -2198,15 +3349,35 @@ int export_handle_export_record_text(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Computer name\t\t\t: %" PRIs_SYSTEM "\n",
-		 value_string );
+		if( output_buffer_commit_string(
+		     export_handle->output_buffer,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append computer name.",
+			 function );
 
-		memory_free(
-		 value_string );
+			goto on_error;
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "\n" ),
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append computer name.",
+			 function );
 
-		value_string = NULL;
+			goto on_error;
+		}
 	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libevtx_record_get_utf16_provider_identifier_size(
@@ -2273,12 +3444,53 @@ int export_handle_export_record_text(
 		}
 		if( export_handle->verbose != 0 )
 		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Provider identifier\t\t: %" PRIs_SYSTEM "\n",
-			 provider_identifier );
-		}
-	}
+			if( output_buffer_append_string(
+			     export_handle->output_buffer,
+			     _SYSTEM_STRING( "Provider identifier\t\t: " ),
+			     23,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append provider identifier.",
+				 function );
+
+				goto on_error;
+			}
+			if( output_buffer_append_string(
+			     export_handle->output_buffer,
+			     provider_identifier,
+			     provider_identifier_size - 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append provider identifier.",
+				 function );
+
+				goto on_error;
+			}
+			if( output_buffer_append_string(
+			     export_handle->output_buffer,
+			     _SYSTEM_STRING( "\n" ),
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append provider identifier.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libevtx_record_get_utf16_source_name_size(
 	          record,
@@ -2342,10 +3554,51 @@ int export_handle_export_record_text(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Source name\t\t\t: %" PRIs_SYSTEM "\n",
-		 source_name );
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "Source name\t\t\t: " ),
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source name.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     source_name,
+		     source_name_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source name.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "\n" ),
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source name.",
+			 function );
+
+			goto on_error;
+		}
 	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libevtx_record_get_utf16_channel_name_size(
@@ -2372,16 +3625,32 @@ int export_handle_export_record_text(
 	if( ( result != 0 )
 	 && ( value_string_size > 0 ) )
 	{
-		value_string = system_string_allocate(
-		                value_string_size );
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "Channel name\t\t\t: " ),
+		     17,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append channel name.",
+			 function );
 
-		if( value_string == NULL )
+			goto on_error;
+		}
+		if( output_buffer_get_append_buffer(
+		     export_handle->output_buffer,
+		     value_string_size,
+		     &append_buffer,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create value string.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve append buffer.",
 			 function );
 
 			goto on_error;
@@ -2389,13 +3658,13 @@ int export_handle_export_record_text(
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libevtx_record_get_utf16_channel_name(
 		          record,
-		          (uint16_t *) value_string,
+		          (uint16_t *) append_buffer,
 		          value_string_size,
 		          error );
 #else
 		result = libevtx_record_get_utf8_channel_name(
 		          record,
-		          (uint8_t *) value_string,
+		          (uint8_t *) append_buffer,
 		          value_string_size,
 		          error );
 #endif
@@ -2410,15 +3679,35 @@ int export_handle_export_record_text(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Channel name\t\t\t: %" PRIs_SYSTEM "\n",
-		 value_string );
+		if( output_buffer_commit_string(
+		     export_handle->output_buffer,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append channel name.",
+			 function );
 
-		memory_free(
-		 value_string );
+			goto on_error;
+		}
+		if( output_buffer_append_string(
+		     export_handle->output_buffer,
+		     _SYSTEM_STRING( "\n" ),
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append channel name.",
+			 function );
 
-		value_string = NULL;
+			goto on_error;
+		}
 	}
 /* TODO category ? */
 
@@ -2436,11 +3725,79 @@ int export_handle_export_record_text(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event identifier\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\n",
-	 event_identifier,
-	 event_identifier );
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( "Event identifier\t\t: " ),
+	     20,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_hexadecimal_32bit(
+	     export_handle->output_buffer,
+	     event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( " (" ),
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_decimal_64bit(
+	     export_handle->output_buffer,
+	     (uint64_t) event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( ")\n" ),
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event identifier.",
+		 function );
+
+		goto on_error;
+	}
 
 	if( export_handle_export_record_event_message(
 	     export_handle,
@@ -2462,9 +3819,21 @@ int export_handle_export_record_text(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "\n" );
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( "\n" ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end of record.",
+		 function );
+
+		goto on_error;
+	}
 
 	if( provider_identifier != NULL )
 	{
@@ -2482,43 +3851,536 @@ int export_handle_export_record_text(
 	}
 	return( 1 );
 
-on_error:
-	if( provider_identifier != NULL )
-	{
-		memory_free(
-		 provider_identifier );
+on_error:
+	if( provider_identifier != NULL )
+	{
+		memory_free(
+		 provider_identifier );
+	}
+	if( source_name != NULL )
+	{
+		memory_free(
+		 source_name );
+	}
+	return( -1 );
+}
+
+/* Exports the record in the XML format
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_xml(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	system_character_t *append_buffer = NULL;
+	static char *function             = "export_handle_export_record_xml";
+	size_t event_xml_size             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_record_get_utf16_xml_string_size(
+	     record,
+	     &event_xml_size,
+	     error ) != 1 )
+#else
+	if( libevtx_record_get_utf8_xml_string_size(
+	     record,
+	     &event_xml_size,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event XML size.",
+		 function );
+
+		goto on_error;
+	}
+	if( event_xml_size > 0 )
+	{
+		if( output_buffer_get_append_buffer(
+		     export_handle->output_buffer,
+		     event_xml_size,
+		     &append_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve append buffer.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libevtx_record_get_utf16_xml_string(
+		     record,
+		     (uint16_t *) append_buffer,
+		     event_xml_size,
+		     error ) != 1 )
+#else
+		if( libevtx_record_get_utf8_xml_string(
+		     record,
+		     (uint8_t *) append_buffer,
+		     event_xml_size,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event XML.",
+			 function );
+
+			goto on_error;
+		}
+		/* Note that the event XML ends with a new line
+		 */
+		if( output_buffer_commit_string(
+		     export_handle->output_buffer,
+		     event_xml_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event XML.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( output_buffer_append_string(
+	     export_handle->output_buffer,
+	     _SYSTEM_STRING( "\n" ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end of record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
+/* Exports the records
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_records(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record = NULL;
+	static char *function   = "export_handle_export_records";
+	int number_of_records   = 0;
+	int record_index        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_records(
+	     file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			return( -1 );
+		}
+		if( libevtx_file_get_record_by_index(
+		     file,
+		     record_index,
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			/* Be error tollerant for corrupt records in dirty files
+			 */
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else if( export_handle_export_record(
+		          export_handle,
+		          record,
+		          log_handle,
+		          error ) != 1 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Unable to export record: %d.\n\n",
+			 record_index );
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record: %d.",
+			 function,
+			 record_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		if( libevtx_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	if( output_buffer_flush(
+	     export_handle->output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports the recovered records
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_recovered_records(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record = NULL;
+	static char *function   = "export_handle_export_recovered_records";
+	int number_of_records   = 0;
+	int record_index        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_recovered_records(
+	     file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			return( -1 );
+		}
+		if( libevtx_file_get_recovered_record_by_index(
+		     file,
+		     record_index,
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve recovered record: %d.",
+			 function,
+			 record_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else if( export_handle_export_record(
+		          export_handle,
+		          record,
+		          log_handle,
+		          error ) != 1 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Unable to export recovered record: %d.\n\n",
+			 record_index );
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export recovered record: %d.",
+			 function,
+			 record_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		if( libevtx_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	if( output_buffer_flush(
+	     export_handle->output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports the records from the file
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_file(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function        = "export_handle_export_file";
+	int result_recovered_records = 0;
+	int result_records           = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( source_name != NULL )
+	if( export_handle->export_mode != EXPORT_MODE_RECOVERED )
 	{
-		memory_free(
-		 source_name );
+		result_records = export_handle_export_records(
+				  export_handle,
+				  export_handle->input_file,
+				  log_handle,
+				  error );
+
+		if( result_records == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export records.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	if( value_string != NULL )
+	if( export_handle->export_mode != EXPORT_MODE_ITEMS )
 	{
-		memory_free(
-		 value_string );
+		result_recovered_records = export_handle_export_recovered_records(
+					    export_handle,
+					    export_handle->input_file,
+					    log_handle,
+					    error );
+
+		if( result_recovered_records == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export recovered records.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	if( filetime != NULL )
+	if( ( result_records != 0 )
+	 || ( result_recovered_records != 0 ) )
 	{
-		libfdatetime_filetime_free(
-		 &filetime,
-		 NULL );
+		return( 1 );
 	}
-	return( -1 );
+	return( 0 );
 }
 
-/* Exports the record in the XML format
- * Returns 1 if successful or -1 on error
+/* Exports the records of a specific source file
+ * If the records are merged the source file is only opened, its records are
+ * exported by export_handle_export_merged_records
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
  */
-int export_handle_export_record_xml(
+int export_handle_export_source(
      export_handle_t *export_handle,
-     libevtx_record_t *record,
+     const system_character_t *filename,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	system_character_t *event_xml = NULL;
-	static char *function         = "export_handle_export_record_xml";
-	size_t event_xml_size         = 0;
+	static char *function = "export_handle_export_source";
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -2531,117 +4393,141 @@ int export_handle_export_record_xml(
 
 		return( -1 );
 	}
-	if( record == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libevtx_record_get_utf16_xml_string_size(
-	     record,
-	     &event_xml_size,
-	     error ) != 1 )
-#else
-	if( libevtx_record_get_utf8_xml_string_size(
-	     record,
-	     &event_xml_size,
-	     error ) != 1 )
-#endif
+	if( export_handle->event_log_type_from_filename != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve event XML size.",
-		 function );
+		if( export_handle_set_event_log_type_from_filename(
+		     export_handle,
+		     filename,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set event log type from filename.",
+			 function );
 
-		goto on_error;
+			return( -1 );
+		}
 	}
-	if( event_xml_size > 0 )
+	if( export_handle->merge_handle != NULL )
 	{
-		event_xml = system_string_allocate(
-		             event_xml_size );
-
-		if( event_xml == NULL )
+		if( merge_handle_set_ascii_codepage(
+		     export_handle->merge_handle,
+		     export_handle->ascii_codepage,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create event XML.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set ASCII codepage in merge handle.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libevtx_record_get_utf16_xml_string(
-		     record,
-		     (uint16_t *) event_xml,
-		     event_xml_size,
-		     error ) != 1 )
-#else
-		if( libevtx_record_get_utf8_xml_string(
-		     record,
-		     (uint8_t *) event_xml,
-		     event_xml_size,
+		if( merge_handle_open_input(
+		     export_handle->merge_handle,
+		     filename,
+		     export_handle->event_log_type,
 		     error ) != 1 )
-#endif
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve event XML.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open: %" PRIs_SYSTEM " in merge handle.",
+			 function,
+			 filename );
 
-			goto on_error;
+			return( -1 );
 		}
-		/* Note that the event XML ends with a new line
-		 */
+		return( 1 );
+	}
+	if( export_handle_open_input(
+	     export_handle,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	if( ( export_handle->print_source_filename != 0 )
+	 && ( export_handle->export_format == EXPORT_FORMAT_TEXT ) )
+	{
 		fprintf(
 		 export_handle->notify_stream,
-		 "%" PRIs_SYSTEM "",
-		 event_xml );
-
-		memory_free(
-		 event_xml );
-
-		event_xml = NULL;
+		 "Source file\t\t\t: %" PRIs_SYSTEM "\n\n",
+		 filename );
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "\n" );
+	result = export_handle_export_file(
+	          export_handle,
+	          log_handle,
+	          error );
 
-	return( 1 );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
 
-on_error:
-	if( event_xml != NULL )
+		export_handle_close_input(
+		 export_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( export_handle_close_input(
+	     export_handle,
+	     error ) != 0 )
 	{
-		memory_free(
-		 event_xml );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( result );
 }
 
-/* Exports the records
+/* Exports the records of the sources opened in the merge handle in written time order
  * Returns the 1 if succesful, 0 if no records are available or -1 on error
  */
-int export_handle_export_records(
+int export_handle_export_merged_records(
      export_handle_t *export_handle,
-     libevtx_file_t *file,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
 	libevtx_record_t *record = NULL;
-	static char *function   = "export_handle_export_records";
-	int number_of_records   = 0;
-	int record_index        = 0;
+	static char *function    = "export_handle_export_merged_records";
+	int event_log_type       = 0;
+	int number_of_records    = 0;
+	int result               = 0;
 
 	if( export_handle == NULL )
 	{
@@ -2654,80 +4540,92 @@ int export_handle_export_records(
 
 		return( -1 );
 	}
-	if( file == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
-
-		return( -1 );
-	}
-	if( libevtx_file_get_number_of_records(
-	     file,
-	     &number_of_records,
-	     error ) != 1 )
+	if( export_handle->merge_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing merge handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_records == 0 )
-	{
-		return( 0 );
-	}
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
+	do
 	{
 		if( export_handle->abort != 0 )
 		{
+			/* The records exported before the abort are flushed
+			 * so that the output is not truncated mid buffer
+			 */
+			if( output_buffer_flush(
+			     export_handle->output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush output buffer.",
+				 function );
+			}
 			return( -1 );
 		}
-		if( libevtx_file_get_record_by_index(
-		     file,
-		     record_index,
-		     &record,
-		     error ) != 1 )
+		result = merge_handle_get_next_record(
+		          export_handle->merge_handle,
+		          &record,
+		          &event_log_type,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record: %d.",
+			 "%s: unable to retrieve next record: %d.",
 			 function,
-			 record_index );
+			 number_of_records );
 
-			/* Be error tollerant for corrupt records in dirty files
-			 */
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		export_handle->event_log_type = event_log_type;
+
+		/* The eventlog key of the message handle only needs to change
+		 * when the record originates from an event log of another type
+		 */
+		if( ( export_handle->message_catalog_filename == NULL )
+		 && ( ( export_handle->message_handle_is_open == 0 )
+		  || ( export_handle->message_handle_event_log_type != event_log_type ) ) )
+		{
+			if( export_handle_open_message_handle(
+			     export_handle,
+			     error ) != 1 )
 			{
-				libcnotify_print_error_backtrace(
-				 *error );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open message handle.",
+				 function );
+
+				goto on_error;
 			}
-#endif
-			libcerror_error_free(
-			 error );
 		}
-		else if( export_handle_export_record(
-		          export_handle,
-		          record,
-		          log_handle,
-		          error ) != 1 )
+		if( export_handle_export_record(
+		     export_handle,
+		     record,
+		     log_handle,
+		     error ) != 1 )
 		{
 			fprintf(
 			 export_handle->notify_stream,
 			 "Unable to export record: %d.\n\n",
-			 record_index );
+			 number_of_records );
 
 			libcerror_error_set(
 			 error,
@@ -2735,7 +4633,7 @@ int export_handle_export_records(
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
 			 "%s: unable to export record: %d.",
 			 function,
-			 record_index );
+			 number_of_records );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( ( error != NULL )
@@ -2758,27 +4656,67 @@ int export_handle_export_records(
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
 			 "%s: unable to free record: %d.",
 			 function,
-			 record_index );
+			 number_of_records );
 
-			return( -1 );
+			goto on_error;
 		}
+		number_of_records++;
+	}
+	while( result != 0 );
+
+	if( output_buffer_flush(
+	     export_handle->output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_records == 0 )
+	{
+		return( 0 );
 	}
 	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Exports the recovered records
- * Returns the 1 if succesful, 0 if no records are available or -1 on error
+/* Exports the records of the EVTX files in a specific directory
+ * The directory is not traversed recursively, only files with an .evtx
+ * extension are exported
+ * The number of exported files only includes the files that contained records
+ * Returns the 1 if succesful, 0 if the name does not refer to a directory or -1 on error
  */
-int export_handle_export_recovered_records(
+int export_handle_export_directory(
      export_handle_t *export_handle,
-     libevtx_file_t *file,
+     const system_character_t *directory_name,
      log_handle_t *log_handle,
+     int *number_of_exported_files,
      libcerror_error_t **error )
 {
-	libevtx_record_t *record = NULL;
-	static char *function   = "export_handle_export_recovered_records";
-	int number_of_records   = 0;
-	int record_index        = 0;
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	system_character_t *directory_entry_name         = NULL;
+	system_character_t *filename                     = NULL;
+	static char *function                            = "export_handle_export_directory";
+	size_t directory_entry_name_length               = 0;
+	size_t directory_name_length                     = 0;
+	size_t filename_size                             = 0;
+	uint8_t directory_entry_type                     = 0;
+	int export_result                                = 0;
+	int result                                       = 0;
 
 	if( export_handle == NULL )
 	{
@@ -2791,86 +4729,223 @@ int export_handle_export_recovered_records(
 
 		return( -1 );
 	}
-	if( file == NULL )
+	if( directory_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid directory name.",
 		 function );
 
 		return( -1 );
 	}
-	if( libevtx_file_get_number_of_recovered_records(
-	     file,
-	     &number_of_records,
+	if( number_of_exported_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of exported files.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_exported_files = 0;
+
+	directory_name_length = system_string_length(
+	                         directory_name );
+
+	if( libcdirectory_directory_initialize(
+	     &directory,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of recovered records.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( number_of_records == 0 )
+	/* The name does not refer to a directory if it cannot be opened as one
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcdirectory_directory_open_wide(
+		  directory,
+		  directory_name,
+		  NULL );
+#else
+	result = libcdirectory_directory_open(
+		  directory,
+		  directory_name,
+		  NULL );
+#endif
+	if( result != 1 )
 	{
+		if( libcdirectory_directory_free(
+		     &directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory.",
+			 function );
+
+			goto on_error;
+		}
 		return( 0 );
 	}
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->print_source_filename = 1;
+
+	do
 	{
 		if( export_handle->abort != 0 )
 		{
-			return( -1 );
+			break;
 		}
-		if( libevtx_file_get_recovered_record_by_index(
-		     file,
-		     record_index,
-		     &record,
+		result = libcdirectory_directory_read_entry(
+		          directory,
+		          directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_type(
+		     directory_entry,
+		     &directory_entry_type,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve recovered record: %d.",
-			 function,
-			 record_index );
+			 "%s: unable to retrieve directory entry type.",
+			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
+			goto on_error;
 		}
-		else if( export_handle_export_record(
-		          export_handle,
-		          record,
-		          log_handle,
-		          error ) != 1 )
+		if( directory_entry_type != LIBCDIRECTORY_ENTRY_TYPE_FILE )
 		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Unable to export recovered record: %d.\n\n",
-			 record_index );
+			continue;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcdirectory_directory_entry_get_name_wide(
+			  directory_entry,
+			  (wchar_t **) &directory_entry_name,
+			  error );
+#else
+		result = libcdirectory_directory_entry_get_name(
+			  directory_entry,
+			  (char **) &directory_entry_name,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			goto on_error;
+		}
+		directory_entry_name_length = system_string_length(
+		                               directory_entry_name );
 
+		if( directory_entry_name_length <= 5 )
+		{
+			continue;
+		}
+		if( system_string_compare_no_case(
+		     &( directory_entry_name[ directory_entry_name_length - 5 ] ),
+		     _SYSTEM_STRING( ".evtx" ),
+		     5 ) != 0 )
+		{
+			continue;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcpath_path_join_wide(
+			  &filename,
+			  &filename_size,
+			  directory_name,
+			  directory_name_length,
+			  directory_entry_name,
+			  directory_entry_name_length,
+			  error );
+#else
+		result = libcpath_path_join(
+			  &filename,
+			  &filename_size,
+			  directory_name,
+			  directory_name_length,
+			  directory_entry_name,
+			  directory_entry_name_length,
+			  error );
+#endif
+		if( result != 1 )
+		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export recovered record: %d.",
-			 function,
-			 record_index );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create filename.",
+			 function );
+
+			goto on_error;
+		}
+		/* Be error tolerant for individual files that cannot be exported
+		 */
+		export_result = export_handle_export_source(
+		                 export_handle,
+		                 filename,
+		                 log_handle,
+		                 error );
+
+		if( export_result == 1 )
+		{
+			*number_of_exported_files += 1;
+		}
+		else if( export_result == -1 )
+		{
+			output_buffer_flush(
+			 export_handle->output_buffer,
+			 NULL );
+
+			fprintf(
+			 export_handle->notify_stream,
+			 "Unable to export file: %" PRIs_SYSTEM ".\n\n",
+			 filename );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( ( error != NULL )
@@ -2883,92 +4958,76 @@ int export_handle_export_recovered_records(
 			libcerror_error_free(
 			 error );
 		}
-		if( libevtx_record_free(
-		     &record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record: %d.",
-			 function,
-			 record_index );
+		memory_free(
+		 filename );
 
-			return( -1 );
-		}
+		filename = NULL;
 	}
-	return( 1 );
-}
-
-/* Exports the records from the file
- * Returns the 1 if succesful, 0 if no records are available or -1 on error
- */
-int export_handle_export_file(
-     export_handle_t *export_handle,
-     log_handle_t *log_handle,
-     libcerror_error_t **error )
-{
-	static char *function        = "export_handle_export_file";
-	int result_recovered_records = 0;
-	int result_records           = 0;
+	while( result != 0 );
 
-	if( export_handle == NULL )
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( export_handle->export_mode != EXPORT_MODE_RECOVERED )
+	if( libcdirectory_directory_close(
+	     directory,
+	     error ) != 0 )
 	{
-		result_records = export_handle_export_records(
-				  export_handle,
-				  export_handle->input_file,
-				  log_handle,
-				  error );
-
-		if( result_records == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export records.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
 
-			return( -1 );
-		}
+		goto on_error;
 	}
-	if( export_handle->export_mode != EXPORT_MODE_ITEMS )
+	if( libcdirectory_directory_free(
+	     &directory,
+	     error ) != 1 )
 	{
-		result_recovered_records = export_handle_export_recovered_records(
-					    export_handle,
-					    export_handle->input_file,
-					    log_handle,
-					    error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
+		 function );
 
-		if( result_recovered_records == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export recovered records.",
-			 function );
+		goto on_error;
+	}
+	if( export_handle->abort != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
 
-			return( -1 );
-		}
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
 	}
-	if( ( result_records != 0 )
-	 || ( result_recovered_records != 0 ) )
+	if( directory_entry != NULL )
 	{
-		return( 1 );
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
 	}
-	return( 0 );
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( -1 );
 }
 
@@ -29,9 +29,12 @@
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libevtx.h"
 #include "log_handle.h"
+#include "merge_handle.h"
 #include "message_handle.h"
 #include "message_string.h"
+#include "output_buffer.h"
 #include "resource_file.h"
+#include "template_definition_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -70,6 +73,11 @@ struct export_handle
 	 */
 	message_handle_t *message_handle;
 
+	/* The merge handle
+	 * This is only set when the records of the sources are merged
+	 */
+	merge_handle_t *merge_handle;
+
 	/* The event log type
 	 */
 	int event_log_type;
@@ -78,10 +86,36 @@ struct export_handle
 	 */
 	int use_template_definition;
 
+	/* The template definition cache
+	 */
+	template_definition_cache_t *template_definition_cache;
+
 	/* Value to indicate the input is open
 	 */
 	int input_is_open;
 
+	/* Value to indicate the message handle input is open
+	 */
+	int message_handle_is_open;
+
+	/* The event log type the message handle input was opened for
+	 */
+	int message_handle_event_log_type;
+
+	/* The message catalog filename
+	 * When set the message handle input is only opened when a message
+	 * cannot be resolved from the message catalog
+	 */
+	const system_character_t *message_catalog_filename;
+
+	/* Value to indicate the event log type should be determined from the source filename
+	 */
+	int event_log_type_from_filename;
+
+	/* Value to indicate the source filename should be printed before its records
+	 */
+	int print_source_filename;
+
 	/* The ascii codepage
 	 */
 	int ascii_codepage;
@@ -90,6 +124,18 @@ struct export_handle
 	 */
 	FILE *notify_stream;
 
+	/* The output buffer of the notification output stream
+	 */
+	output_buffer_t *output_buffer;
+
+	/* The message string buffer
+	 */
+	system_character_t *message_string_buffer;
+
+	/* The message string buffer size
+	 */
+	size_t message_string_buffer_size;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -117,6 +163,10 @@ int export_handle_signal_abort(
      export_handle_t *export_handle,
      libcerror_error_t **error );
 
+int export_handle_enable_merge(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
 int export_handle_set_export_mode(
      export_handle_t *export_handle,
      const system_character_t *string,
@@ -167,6 +217,19 @@ int export_handle_set_resource_files_path(
      const system_character_t *path,
      libcerror_error_t **error );
 
+int export_handle_open_message_handle(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_open_message_catalog(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_close_message_catalog(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
 int export_handle_open_input(
      export_handle_t *export_handle,
      const system_character_t *filename,
@@ -195,6 +258,17 @@ int export_handle_resource_file_get_template_definition(
      libevtx_template_definition_t **template_definition,
      libcerror_error_t **error );
 
+int export_handle_get_template_definition(
+     export_handle_t *export_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint8_t event_version,
+     libevtx_template_definition_t **template_definition,
+     libcerror_error_t **error );
+
 int export_handle_message_string_fprint(
      export_handle_t *export_handle,
      message_string_t *message_string,
@@ -249,6 +323,24 @@ int export_handle_export_file(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_export_source(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_merged_records(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_directory(
+     export_handle_t *export_handle,
+     const system_character_t *directory_name,
+     log_handle_t *log_handle,
+     int *number_of_exported_files,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
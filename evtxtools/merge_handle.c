@@ -0,0 +1,771 @@
+/*
+ * Merge handle
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libcnotify.h"
+#include "evtxtools_libevtx.h"
+#include "merge_handle.h"
+
+#define MERGE_HANDLE_MINIMUM_NUMBER_OF_INPUTS	8
+
+/* Creates a merge handle
+ * Make sure the value merge_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int merge_handle_initialize(
+     merge_handle_t **merge_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "merge_handle_initialize";
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *merge_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid merge handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*merge_handle = memory_allocate_structure(
+	                 merge_handle_t );
+
+	if( *merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create merge handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *merge_handle,
+	     0,
+	     sizeof( merge_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear merge handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *merge_handle )->ascii_codepage = LIBEVTX_CODEPAGE_WINDOWS_1252;
+
+	return( 1 );
+
+on_error:
+	if( *merge_handle != NULL )
+	{
+		memory_free(
+		 *merge_handle );
+
+		*merge_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a merge handle
+ * Returns 1 if successful or -1 on error
+ */
+int merge_handle_free(
+     merge_handle_t **merge_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "merge_handle_free";
+	int result            = 1;
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *merge_handle != NULL )
+	{
+		if( merge_handle_close_inputs(
+		     *merge_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close inputs.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *merge_handle )->inputs != NULL )
+		{
+			memory_free(
+			 ( *merge_handle )->inputs );
+		}
+		if( ( *merge_handle )->heap != NULL )
+		{
+			memory_free(
+			 ( *merge_handle )->heap );
+		}
+		memory_free(
+		 *merge_handle );
+
+		*merge_handle = NULL;
+	}
+	return( result );
+}
+
+/* Sets the ascii codepage
+ * Returns 1 if successful or -1 on error
+ */
+int merge_handle_set_ascii_codepage(
+     merge_handle_t *merge_handle,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "merge_handle_set_ascii_codepage";
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	merge_handle->ascii_codepage = ascii_codepage;
+
+	return( 1 );
+}
+
+/* Determines if the current record of input index 1 precedes that of input index 2
+ * Records with the same written time are ordered by input index
+ * Returns 1 if it precedes or 0 if not
+ */
+int merge_handle_input_precedes(
+     merge_handle_t *merge_handle,
+     int input_index1,
+     int input_index2 )
+{
+	uint64_t written_time1 = merge_handle->inputs[ input_index1 ].written_time;
+	uint64_t written_time2 = merge_handle->inputs[ input_index2 ].written_time;
+
+	if( written_time1 < written_time2 )
+	{
+		return( 1 );
+	}
+	if( ( written_time1 == written_time2 )
+	 && ( input_index1 < input_index2 ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Moves the input index at a specific heap index towards the top of the heap
+ */
+void merge_handle_heap_sift_up(
+      merge_handle_t *merge_handle,
+      int heap_index )
+{
+	int input_index  = merge_handle->heap[ heap_index ];
+	int parent_index = 0;
+
+	while( heap_index > 0 )
+	{
+		parent_index = ( heap_index - 1 ) / 2;
+
+		if( merge_handle_input_precedes(
+		     merge_handle,
+		     input_index,
+		     merge_handle->heap[ parent_index ] ) == 0 )
+		{
+			break;
+		}
+		merge_handle->heap[ heap_index ] = merge_handle->heap[ parent_index ];
+
+		heap_index = parent_index;
+	}
+	merge_handle->heap[ heap_index ] = input_index;
+}
+
+/* Moves the input index at a specific heap index towards the bottom of the heap
+ */
+void merge_handle_heap_sift_down(
+      merge_handle_t *merge_handle,
+      int heap_index )
+{
+	int child_index = 0;
+	int input_index = merge_handle->heap[ heap_index ];
+
+	child_index = ( heap_index * 2 ) + 1;
+
+	while( child_index < merge_handle->heap_size )
+	{
+		if( ( ( child_index + 1 ) < merge_handle->heap_size )
+		 && ( merge_handle_input_precedes(
+		       merge_handle,
+		       merge_handle->heap[ child_index + 1 ],
+		       merge_handle->heap[ child_index ] ) != 0 ) )
+		{
+			child_index++;
+		}
+		if( merge_handle_input_precedes(
+		     merge_handle,
+		     merge_handle->heap[ child_index ],
+		     input_index ) == 0 )
+		{
+			break;
+		}
+		merge_handle->heap[ heap_index ] = merge_handle->heap[ child_index ];
+
+		heap_index  = child_index;
+		child_index = ( heap_index * 2 ) + 1;
+	}
+	merge_handle->heap[ heap_index ] = input_index;
+}
+
+/* Reads the next record of a specific input
+ * The records are read in logical order, so that a wrapped circular log is
+ * read from its oldest to its newest record
+ * Records that cannot be read are skipped
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int merge_handle_read_next_record(
+     merge_handle_t *merge_handle,
+     int input_index,
+     libcerror_error_t **error )
+{
+	merge_input_t *input  = NULL;
+	static char *function = "merge_handle_read_next_record";
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_index < 0 )
+	 || ( input_index >= merge_handle->number_of_inputs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	input = &( merge_handle->inputs[ input_index ] );
+
+	while( input->next_record_index < input->number_of_records )
+	{
+		if( libevtx_file_get_record_by_logical_index(
+		     input->input_file,
+		     input->next_record_index,
+		     &( input->record ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d of input: %d.",
+			 function,
+			 input->next_record_index,
+			 input_index );
+
+			/* Be error tollerant for corrupt records in dirty files
+			 */
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			input->next_record_index++;
+
+			continue;
+		}
+		input->next_record_index++;
+
+		if( libevtx_record_get_written_time(
+		     input->record,
+		     &( input->written_time ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve written time.",
+			 function );
+
+			libevtx_record_free(
+			 &( input->record ),
+			 NULL );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Opens an input
+ * Returns 1 if successful or -1 on error
+ */
+int merge_handle_open_input(
+     merge_handle_t *merge_handle,
+     const system_character_t *filename,
+     int event_log_type,
+     libcerror_error_t **error )
+{
+	merge_input_t *input  = NULL;
+	void *reallocation    = NULL;
+	static char *function = "merge_handle_open_input";
+	int access_flags      = LIBEVTX_OPEN_READ;
+	int input_index       = 0;
+	int number_of_inputs  = 0;
+	int result            = 0;
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( merge_handle->number_of_inputs >= merge_handle->number_of_allocated_inputs )
+	{
+		if( merge_handle->number_of_allocated_inputs == 0 )
+		{
+			number_of_inputs = MERGE_HANDLE_MINIMUM_NUMBER_OF_INPUTS;
+		}
+		else
+		{
+			number_of_inputs = merge_handle->number_of_allocated_inputs * 2;
+		}
+		if( ( number_of_inputs < merge_handle->number_of_allocated_inputs )
+		 || ( (size_t) number_of_inputs > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( merge_input_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of inputs value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                merge_handle->inputs,
+		                sizeof( merge_input_t ) * number_of_inputs );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize inputs.",
+			 function );
+
+			return( -1 );
+		}
+		merge_handle->inputs = (merge_input_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                merge_handle->heap,
+		                sizeof( int ) * number_of_inputs );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize heap.",
+			 function );
+
+			return( -1 );
+		}
+		merge_handle->heap = (int *) reallocation;
+
+		merge_handle->number_of_allocated_inputs = number_of_inputs;
+	}
+	input_index = merge_handle->number_of_inputs;
+
+	input = &( merge_handle->inputs[ input_index ] );
+
+	if( memory_set(
+	     input,
+	     0,
+	     sizeof( merge_input_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear input.",
+		 function );
+
+		return( -1 );
+	}
+	input->event_log_type = event_log_type;
+
+	if( libevtx_file_initialize(
+	     &( input->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_file_set_ascii_codepage(
+	     input->input_file,
+	     merge_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in input file.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only the (allocated) records are merged and these are read sequentially
+	 */
+	access_flags |= LIBEVTX_ACCESS_FLAG_NO_RECOVERY | LIBEVTX_ACCESS_FLAG_READ_AHEAD;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_file_open_wide(
+	     input->input_file,
+	     filename,
+	     access_flags,
+	     error ) != 1 )
+#else
+	if( libevtx_file_open(
+	     input->input_file,
+	     filename,
+	     access_flags,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_file_get_number_of_records(
+	     input->input_file,
+	     &( input->number_of_records ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	merge_handle->number_of_inputs += 1;
+
+	result = merge_handle_read_next_record(
+	          merge_handle,
+	          input_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read first record of input: %d.",
+		 function,
+		 input_index );
+
+		merge_handle->number_of_inputs -= 1;
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		merge_handle->heap[ merge_handle->heap_size ] = input_index;
+
+		merge_handle->heap_size += 1;
+
+		merge_handle_heap_sift_up(
+		 merge_handle,
+		 merge_handle->heap_size - 1 );
+	}
+	return( 1 );
+
+on_error:
+	if( input->input_file != NULL )
+	{
+		libevtx_file_free(
+		 &( input->input_file ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the inputs
+ * Returns the 0 if succesful or -1 on error
+ */
+int merge_handle_close_inputs(
+     merge_handle_t *merge_handle,
+     libcerror_error_t **error )
+{
+	merge_input_t *input  = NULL;
+	static char *function = "merge_handle_close_inputs";
+	int input_index       = 0;
+	int result            = 0;
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( input_index = 0;
+	     input_index < merge_handle->number_of_inputs;
+	     input_index++ )
+	{
+		input = &( merge_handle->inputs[ input_index ] );
+
+		if( input->record != NULL )
+		{
+			if( libevtx_record_free(
+			     &( input->record ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record of input: %d.",
+				 function,
+				 input_index );
+
+				result = -1;
+			}
+		}
+		if( libevtx_file_close(
+		     input->input_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file: %d.",
+			 function,
+			 input_index );
+
+			result = -1;
+		}
+		if( libevtx_file_free(
+		     &( input->input_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file: %d.",
+			 function,
+			 input_index );
+
+			result = -1;
+		}
+	}
+	merge_handle->number_of_inputs = 0;
+	merge_handle->heap_size        = 0;
+
+	return( result );
+}
+
+/* Retrieves the record with the earliest written time of all inputs
+ * Only the current record of every input is compared, hence the records of
+ * an input are expected to be stored in written time order
+ * The record is removed from the merge handle and must be freed by the caller
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int merge_handle_get_next_record(
+     merge_handle_t *merge_handle,
+     libevtx_record_t **record,
+     int *event_log_type,
+     libcerror_error_t **error )
+{
+	merge_input_t *input  = NULL;
+	static char *function = "merge_handle_get_next_record";
+	int input_index       = 0;
+	int result            = 0;
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_log_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event log type.",
+		 function );
+
+		return( -1 );
+	}
+	if( merge_handle->heap_size == 0 )
+	{
+		return( 0 );
+	}
+	input_index = merge_handle->heap[ 0 ];
+
+	input = &( merge_handle->inputs[ input_index ] );
+
+	*record         = input->record;
+	*event_log_type = input->event_log_type;
+
+	input->record = NULL;
+
+	result = merge_handle_read_next_record(
+	          merge_handle,
+	          input_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read next record of input: %d.",
+		 function,
+		 input_index );
+
+		libevtx_record_free(
+		 record,
+		 NULL );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		merge_handle->heap_size -= 1;
+
+		merge_handle->heap[ 0 ] = merge_handle->heap[ merge_handle->heap_size ];
+	}
+	if( merge_handle->heap_size > 0 )
+	{
+		merge_handle_heap_sift_down(
+		 merge_handle,
+		 0 );
+	}
+	return( 1 );
+}
+
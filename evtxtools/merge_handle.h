@@ -0,0 +1,146 @@
+/*
+ * Merge handle
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _MERGE_HANDLE_H )
+#define _MERGE_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct merge_input merge_input_t;
+
+struct merge_input
+{
+	/* The libevtx input file
+	 */
+	libevtx_file_t *input_file;
+
+	/* The event log type
+	 */
+	int event_log_type;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The index of the next record to read
+	 */
+	int next_record_index;
+
+	/* The current record
+	 */
+	libevtx_record_t *record;
+
+	/* The written time of the current record
+	 */
+	uint64_t written_time;
+};
+
+typedef struct merge_handle merge_handle_t;
+
+struct merge_handle
+{
+	/* The inputs
+	 */
+	merge_input_t *inputs;
+
+	/* The number of inputs
+	 */
+	int number_of_inputs;
+
+	/* The number of allocated inputs
+	 */
+	int number_of_allocated_inputs;
+
+	/* The heap of input indexes ordered by the written time of their current record
+	 */
+	int *heap;
+
+	/* The number of input indexes in the heap
+	 */
+	int heap_size;
+
+	/* The ascii codepage
+	 */
+	int ascii_codepage;
+};
+
+int merge_handle_initialize(
+     merge_handle_t **merge_handle,
+     libcerror_error_t **error );
+
+int merge_handle_free(
+     merge_handle_t **merge_handle,
+     libcerror_error_t **error );
+
+int merge_handle_set_ascii_codepage(
+     merge_handle_t *merge_handle,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int merge_handle_input_precedes(
+     merge_handle_t *merge_handle,
+     int input_index1,
+     int input_index2 );
+
+void merge_handle_heap_sift_up(
+      merge_handle_t *merge_handle,
+      int heap_index );
+
+void merge_handle_heap_sift_down(
+      merge_handle_t *merge_handle,
+      int heap_index );
+
+int merge_handle_read_next_record(
+     merge_handle_t *merge_handle,
+     int input_index,
+     libcerror_error_t **error );
+
+int merge_handle_open_input(
+     merge_handle_t *merge_handle,
+     const system_character_t *filename,
+     int event_log_type,
+     libcerror_error_t **error );
+
+int merge_handle_close_inputs(
+     merge_handle_t *merge_handle,
+     libcerror_error_t **error );
+
+int merge_handle_get_next_record(
+     merge_handle_t *merge_handle,
+     libevtx_record_t **record,
+     int *event_log_type,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MERGE_HANDLE_H ) */
+
@@ -0,0 +1,1920 @@
+/*
+ * Message cache
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "message_cache.h"
+#include "message_string.h"
+
+/* Calculates the hash of the message cache key values
+ * The hash is a 32-bit FNV-1a over the key values
+ * Returns the hash
+ */
+uint32_t message_cache_calculate_hash(
+          int event_log_type,
+          const system_character_t *provider_identifier,
+          size_t provider_identifier_length,
+          const system_character_t *event_source,
+          size_t event_source_length,
+          uint32_t event_identifier,
+          uint32_t event_identifier_qualifiers,
+          uint32_t language_identifier )
+{
+	const uint8_t *byte_stream = NULL;
+	size_t byte_stream_index   = 0;
+	size_t byte_stream_size    = 0;
+	uint32_t hash              = 0x811c9dc5UL;
+	uint32_t value_32bit       = 0;
+	int value_index            = 0;
+
+	if( provider_identifier != NULL )
+	{
+		byte_stream      = (const uint8_t *) provider_identifier;
+		byte_stream_size = provider_identifier_length * sizeof( system_character_t );
+
+		for( byte_stream_index = 0;
+		     byte_stream_index < byte_stream_size;
+		     byte_stream_index++ )
+		{
+			hash ^= byte_stream[ byte_stream_index ];
+			hash *= 0x01000193UL;
+		}
+	}
+	if( event_source != NULL )
+	{
+		byte_stream      = (const uint8_t *) event_source;
+		byte_stream_size = event_source_length * sizeof( system_character_t );
+
+		for( byte_stream_index = 0;
+		     byte_stream_index < byte_stream_size;
+		     byte_stream_index++ )
+		{
+			hash ^= byte_stream[ byte_stream_index ];
+			hash *= 0x01000193UL;
+		}
+	}
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		switch( value_index )
+		{
+			case 0:
+				value_32bit = (uint32_t) event_log_type;
+				break;
+
+			case 1:
+				value_32bit = event_identifier;
+				break;
+
+			case 2:
+				value_32bit = event_identifier_qualifiers;
+				break;
+
+			default:
+				value_32bit = language_identifier;
+				break;
+		}
+		for( byte_stream_index = 0;
+		     byte_stream_index < 4;
+		     byte_stream_index++ )
+		{
+			hash ^= value_32bit & 0xff;
+			hash *= 0x01000193UL;
+
+			value_32bit >>= 8;
+		}
+	}
+	return( hash );
+}
+
+/* Creates a message cache entry
+ * The key values are copied into the entry, the resolved values are set by the caller
+ * Make sure the value message_cache_entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int message_cache_entry_initialize(
+     message_cache_entry_t **message_cache_entry,
+     int event_log_type,
+     const system_character_t *provider_identifier,
+     size_t provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     uint8_t has_event_identifier_qualifiers,
+     uint32_t language_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "message_cache_entry_initialize";
+
+	if( message_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message cache entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid provider identifier length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_source_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid event source length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*message_cache_entry = memory_allocate_structure(
+	                        message_cache_entry_t );
+
+	if( *message_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *message_cache_entry,
+	     0,
+	     sizeof( message_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear message cache entry.",
+		 function );
+
+		memory_free(
+		 *message_cache_entry );
+
+		*message_cache_entry = NULL;
+
+		return( -1 );
+	}
+	if( provider_identifier != NULL )
+	{
+		( *message_cache_entry )->provider_identifier = system_string_allocate(
+		                                                 provider_identifier_length + 1 );
+
+		if( ( *message_cache_entry )->provider_identifier == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create provider identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     ( *message_cache_entry )->provider_identifier,
+		     provider_identifier,
+		     provider_identifier_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy provider identifier.",
+			 function );
+
+			goto on_error;
+		}
+		( *message_cache_entry )->provider_identifier[ provider_identifier_length ] = 0;
+
+		( *message_cache_entry )->provider_identifier_length = provider_identifier_length;
+	}
+	if( event_source != NULL )
+	{
+		( *message_cache_entry )->event_source = system_string_allocate(
+		                                          event_source_length + 1 );
+
+		if( ( *message_cache_entry )->event_source == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create event source.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     ( *message_cache_entry )->event_source,
+		     event_source,
+		     event_source_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy event source.",
+			 function );
+
+			goto on_error;
+		}
+		( *message_cache_entry )->event_source[ event_source_length ] = 0;
+
+		( *message_cache_entry )->event_source_length = event_source_length;
+	}
+	( *message_cache_entry )->event_log_type                  = event_log_type;
+	( *message_cache_entry )->event_identifier                = event_identifier;
+	( *message_cache_entry )->event_identifier_qualifiers     = event_identifier_qualifiers;
+	( *message_cache_entry )->has_event_identifier_qualifiers = has_event_identifier_qualifiers;
+	( *message_cache_entry )->language_identifier             = language_identifier;
+
+	( *message_cache_entry )->hash = message_cache_calculate_hash(
+	                                  event_log_type,
+	                                  provider_identifier,
+	                                  provider_identifier_length,
+	                                  event_source,
+	                                  event_source_length,
+	                                  event_identifier,
+	                                  event_identifier_qualifiers,
+	                                  language_identifier );
+
+	return( 1 );
+
+on_error:
+	if( *message_cache_entry != NULL )
+	{
+		if( ( *message_cache_entry )->event_source != NULL )
+		{
+			memory_free(
+			 ( *message_cache_entry )->event_source );
+		}
+		if( ( *message_cache_entry )->provider_identifier != NULL )
+		{
+			memory_free(
+			 ( *message_cache_entry )->provider_identifier );
+		}
+		memory_free(
+		 *message_cache_entry );
+
+		*message_cache_entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a message cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int message_cache_entry_free(
+     message_cache_entry_t **message_cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "message_cache_entry_free";
+	int result            = 1;
+
+	if( message_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_cache_entry != NULL )
+	{
+		if( ( *message_cache_entry )->message_string != NULL )
+		{
+			if( message_string_free(
+			     &( ( *message_cache_entry )->message_string ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free message string.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *message_cache_entry )->message_filename != NULL )
+		{
+			memory_free(
+			 ( *message_cache_entry )->message_filename );
+		}
+		if( ( *message_cache_entry )->resource_filename != NULL )
+		{
+			memory_free(
+			 ( *message_cache_entry )->resource_filename );
+		}
+		if( ( *message_cache_entry )->event_source != NULL )
+		{
+			memory_free(
+			 ( *message_cache_entry )->event_source );
+		}
+		if( ( *message_cache_entry )->provider_identifier != NULL )
+		{
+			memory_free(
+			 ( *message_cache_entry )->provider_identifier );
+		}
+		memory_free(
+		 *message_cache_entry );
+
+		*message_cache_entry = NULL;
+	}
+	return( result );
+}
+
+/* Creates a message cache
+ * Make sure the value message_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int message_cache_initialize(
+     message_cache_t **message_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "message_cache_initialize";
+
+	if( message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*message_cache = memory_allocate_structure(
+	                  message_cache_t );
+
+	if( *message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *message_cache,
+	     0,
+	     sizeof( message_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear message cache.",
+		 function );
+
+		goto on_error;
+	}
+	( *message_cache )->maximum_number_of_entries = MESSAGE_CACHE_MAXIMUM_NUMBER_OF_ENTRIES;
+
+	return( 1 );
+
+on_error:
+	if( *message_cache != NULL )
+	{
+		memory_free(
+		 *message_cache );
+
+		*message_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a message cache
+ * Returns 1 if successful or -1 on error
+ */
+int message_cache_free(
+     message_cache_t **message_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "message_cache_free";
+	int result            = 1;
+
+	if( message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_cache != NULL )
+	{
+		if( message_cache_empty(
+		     *message_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty message cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *message_cache );
+
+		*message_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a message cache
+ * Returns 1 if successful or -1 on error
+ */
+int message_cache_empty(
+     message_cache_t *message_cache,
+     libcerror_error_t **error )
+{
+	message_cache_entry_t *message_cache_entry = NULL;
+	static char *function                      = "message_cache_empty";
+	int bucket_index                           = 0;
+	int result                                 = 1;
+
+	if( message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < MESSAGE_CACHE_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		while( message_cache->buckets[ bucket_index ] != NULL )
+		{
+			message_cache_entry = message_cache->buckets[ bucket_index ];
+
+			message_cache->buckets[ bucket_index ] = message_cache_entry->next_entry;
+
+			if( message_cache_entry_free(
+			     &message_cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free message cache entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	message_cache->number_of_entries = 0;
+
+	return( result );
+}
+
+/* Retrieves the entry that matches the key values
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int message_cache_get_entry(
+     message_cache_t *message_cache,
+     int event_log_type,
+     const system_character_t *provider_identifier,
+     size_t provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     uint8_t has_event_identifier_qualifiers,
+     uint32_t language_identifier,
+     message_cache_entry_t **message_cache_entry,
+     libcerror_error_t **error )
+{
+	message_cache_entry_t *safe_message_cache_entry = NULL;
+	static char *function                           = "message_cache_get_entry";
+	uint32_t hash                                   = 0;
+
+	if( message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	hash = message_cache_calculate_hash(
+	        event_log_type,
+	        provider_identifier,
+	        provider_identifier_length,
+	        event_source,
+	        event_source_length,
+	        event_identifier,
+	        event_identifier_qualifiers,
+	        language_identifier );
+
+	safe_message_cache_entry = message_cache->buckets[ hash % MESSAGE_CACHE_NUMBER_OF_BUCKETS ];
+
+	while( safe_message_cache_entry != NULL )
+	{
+		if( ( safe_message_cache_entry->hash == hash )
+		 && ( safe_message_cache_entry->event_log_type == event_log_type )
+		 && ( safe_message_cache_entry->event_identifier == event_identifier )
+		 && ( safe_message_cache_entry->event_identifier_qualifiers == event_identifier_qualifiers )
+		 && ( safe_message_cache_entry->has_event_identifier_qualifiers == has_event_identifier_qualifiers )
+		 && ( safe_message_cache_entry->language_identifier == language_identifier ) )
+		{
+			if( ( ( provider_identifier == NULL )
+			   && ( safe_message_cache_entry->provider_identifier == NULL ) )
+			 || ( ( provider_identifier != NULL )
+			   && ( safe_message_cache_entry->provider_identifier != NULL )
+			   && ( safe_message_cache_entry->provider_identifier_length == provider_identifier_length )
+			   && ( system_string_compare(
+			         safe_message_cache_entry->provider_identifier,
+			         provider_identifier,
+			         provider_identifier_length ) == 0 ) ) )
+			{
+				if( ( ( event_source == NULL )
+				   && ( safe_message_cache_entry->event_source == NULL ) )
+				 || ( ( event_source != NULL )
+				   && ( safe_message_cache_entry->event_source != NULL )
+				   && ( safe_message_cache_entry->event_source_length == event_source_length )
+				   && ( system_string_compare(
+				         safe_message_cache_entry->event_source,
+				         event_source,
+				         event_source_length ) == 0 ) ) )
+				{
+					*message_cache_entry = safe_message_cache_entry;
+
+					return( 1 );
+				}
+			}
+		}
+		safe_message_cache_entry = safe_message_cache_entry->next_entry;
+	}
+	return( 0 );
+}
+
+/* Inserts an entry
+ * The message cache takes over management of the entry
+ * The cache is emptied when the maximum number of entries, if any, is reached
+ * Returns 1 if successful or -1 on error
+ */
+int message_cache_insert_entry(
+     message_cache_t *message_cache,
+     message_cache_entry_t *message_cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "message_cache_insert_entry";
+	int bucket_index      = 0;
+
+	if( message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_cache->maximum_number_of_entries > 0 )
+	 && ( message_cache->number_of_entries >= message_cache->maximum_number_of_entries ) )
+	{
+		if( message_cache_empty(
+		     message_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty message cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	bucket_index = (int) ( message_cache_entry->hash % MESSAGE_CACHE_NUMBER_OF_BUCKETS );
+
+	message_cache_entry->next_entry        = message_cache->buckets[ bucket_index ];
+	message_cache->buckets[ bucket_index ] = message_cache_entry;
+
+	message_cache->number_of_entries += 1;
+	message_cache->is_modified        = 1;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of entries
+ * A value of 0 represents no maximum, which is used when the entries are stored in a file
+ * Returns 1 if successful or -1 on error
+ */
+int message_cache_set_maximum_number_of_entries(
+     message_cache_t *message_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "message_cache_set_maximum_number_of_entries";
+
+	if( message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	message_cache->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+}
+
+/* Reads a string from a message cache file stream
+ * The string is stored as a 32-bit little-endian number of characters, including
+ * the end-of-string character, followed by the characters, where 0 represents
+ * no string. Every character is stored little-endian in the character size
+ * of the file header, independent of the byte order of the system
+ * Returns 1 if successful or -1 on error
+ */
+int message_cache_read_string(
+     FILE *stream,
+     system_character_t **string,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	uint8_t size_data[ 4 ];
+
+	system_character_t *safe_string = NULL;
+	uint8_t *string_data            = NULL;
+	static char *function           = "message_cache_read_string";
+	size_t byte_index               = 0;
+	size_t data_offset              = 0;
+	size_t read_size                = 0;
+	size_t string_index             = 0;
+	uint32_t character_value        = 0;
+	uint32_t safe_string_size       = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream_read(
+	     stream,
+	     size_data,
+	     4 ) != 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read string size.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 size_data,
+	 safe_string_size );
+
+	if( safe_string_size > 0 )
+	{
+		if( safe_string_size > (uint32_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		safe_string = system_string_allocate(
+		               (size_t) safe_string_size );
+
+		if( safe_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string.",
+			 function );
+
+			goto on_error;
+		}
+		read_size = (size_t) safe_string_size * sizeof( system_character_t );
+
+		string_data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * read_size );
+
+		if( string_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string data.",
+			 function );
+
+			goto on_error;
+		}
+		if( file_stream_read(
+		     stream,
+		     string_data,
+		     read_size ) != read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read string.",
+			 function );
+
+			goto on_error;
+		}
+		for( string_index = 0;
+		     string_index < (size_t) safe_string_size;
+		     string_index++ )
+		{
+			character_value = 0;
+
+			for( byte_index = sizeof( system_character_t );
+			     byte_index > 0;
+			     byte_index-- )
+			{
+				character_value <<= 8;
+				character_value  |= string_data[ data_offset + byte_index - 1 ];
+			}
+			safe_string[ string_index ] = (system_character_t) character_value;
+
+			data_offset += sizeof( system_character_t );
+		}
+		memory_free(
+		 string_data );
+
+		string_data = NULL;
+
+		safe_string[ safe_string_size - 1 ] = 0;
+	}
+	*string      = safe_string;
+	*string_size = (size_t) safe_string_size;
+
+	return( 1 );
+
+on_error:
+	if( string_data != NULL )
+	{
+		memory_free(
+		 string_data );
+	}
+	if( safe_string != NULL )
+	{
+		memory_free(
+		 safe_string );
+	}
+	return( -1 );
+}
+
+/* Writes a string to a message cache file stream
+ * Every character is written little-endian, see message_cache_read_string
+ * Returns 1 if successful or -1 on error
+ */
+int message_cache_write_string(
+     FILE *stream,
+     const system_character_t *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	uint8_t size_data[ 4 ];
+
+	uint8_t *string_data     = NULL;
+	static char *function    = "message_cache_write_string";
+	size_t byte_index        = 0;
+	size_t data_offset       = 0;
+	size_t string_index      = 0;
+	size_t write_size        = 0;
+	uint32_t character_value = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		string_size = 0;
+	}
+	if( ( string_size > (size_t) UINT32_MAX )
+	 || ( string_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 size_data,
+	 string_size );
+
+	if( file_stream_write(
+	     stream,
+	     size_data,
+	     4 ) != 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > 0 )
+	{
+		write_size = string_size * sizeof( system_character_t );
+
+		string_data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * write_size );
+
+		if( string_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string data.",
+			 function );
+
+			return( -1 );
+		}
+		for( string_index = 0;
+		     string_index < string_size;
+		     string_index++ )
+		{
+			character_value = (uint32_t) string[ string_index ];
+
+			for( byte_index = 0;
+			     byte_index < sizeof( system_character_t );
+			     byte_index++ )
+			{
+				string_data[ data_offset++ ] = (uint8_t) ( character_value & 0xff );
+
+				character_value >>= 8;
+			}
+		}
+		if( file_stream_write(
+		     stream,
+		     string_data,
+		     write_size ) != write_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write string.",
+			 function );
+
+			memory_free(
+			 string_data );
+
+			return( -1 );
+		}
+		memory_free(
+		 string_data );
+	}
+	return( 1 );
+}
+
+/* Reads a message cache entry from a file stream
+ * Make sure the value message_cache_entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int message_cache_entry_read_file_stream(
+     message_cache_entry_t **message_cache_entry,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	uint8_t entry_data[ 28 ];
+
+	system_character_t *event_source        = NULL;
+	system_character_t *message_filename    = NULL;
+	system_character_t *provider_identifier = NULL;
+	system_character_t *resource_filename   = NULL;
+	system_character_t *string              = NULL;
+	static char *function                   = "message_cache_entry_read_file_stream";
+	size_t event_source_size                = 0;
+	size_t message_filename_size            = 0;
+	size_t provider_identifier_size         = 0;
+	size_t resource_filename_size           = 0;
+	size_t string_size                      = 0;
+	uint32_t event_identifier               = 0;
+	uint32_t event_identifier_qualifiers    = 0;
+	uint32_t event_log_type                 = 0;
+	uint32_t language_identifier            = 0;
+	uint32_t message_identifier             = 0;
+	uint32_t message_string_identifier      = 0;
+
+	if( message_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream_read(
+	     stream,
+	     entry_data,
+	     28 ) != 28 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read entry data.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( entry_data[ 0 ] ),
+	 event_log_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( entry_data[ 4 ] ),
+	 event_identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( entry_data[ 8 ] ),
+	 event_identifier_qualifiers );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( entry_data[ 12 ] ),
+	 language_identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( entry_data[ 16 ] ),
+	 message_identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( entry_data[ 20 ] ),
+	 message_string_identifier );
+
+	if( message_cache_read_string(
+	     stream,
+	     &provider_identifier,
+	     &provider_identifier_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read provider identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_cache_read_string(
+	     stream,
+	     &event_source,
+	     &event_source_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read event source.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_cache_read_string(
+	     stream,
+	     &resource_filename,
+	     &resource_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read resource filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_cache_read_string(
+	     stream,
+	     &message_filename,
+	     &message_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read message filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_cache_read_string(
+	     stream,
+	     &string,
+	     &string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read message string.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_cache_entry_initialize(
+	     message_cache_entry,
+	     (int) event_log_type,
+	     provider_identifier,
+	     ( provider_identifier_size > 0 ) ? provider_identifier_size - 1 : 0,
+	     event_source,
+	     ( event_source_size > 0 ) ? event_source_size - 1 : 0,
+	     event_identifier,
+	     event_identifier_qualifiers,
+	     entry_data[ 24 ],
+	     language_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( entry_data[ 26 ] != 0 )
+	{
+		if( message_string_initialize(
+		     &( ( *message_cache_entry )->message_string ),
+		     message_string_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create message string.",
+			 function );
+
+			goto on_error;
+		}
+		( *message_cache_entry )->message_string->string      = string;
+		( *message_cache_entry )->message_string->string_size = string_size;
+
+		string = NULL;
+	}
+	( *message_cache_entry )->resource_filename                  = resource_filename;
+	( *message_cache_entry )->resource_filename_size             = resource_filename_size;
+	( *message_cache_entry )->message_filename                   = message_filename;
+	( *message_cache_entry )->message_filename_size              = message_filename_size;
+	( *message_cache_entry )->message_identifier                 = message_identifier;
+	( *message_cache_entry )->message_identifier_from_qualifiers = entry_data[ 25 ];
+
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+	if( event_source != NULL )
+	{
+		memory_free(
+		 event_source );
+	}
+	if( provider_identifier != NULL )
+	{
+		memory_free(
+		 provider_identifier );
+	}
+	return( 1 );
+
+on_error:
+	if( *message_cache_entry != NULL )
+	{
+		message_cache_entry_free(
+		 message_cache_entry,
+		 NULL );
+	}
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+	if( message_filename != NULL )
+	{
+		memory_free(
+		 message_filename );
+	}
+	if( resource_filename != NULL )
+	{
+		memory_free(
+		 resource_filename );
+	}
+	if( event_source != NULL )
+	{
+		memory_free(
+		 event_source );
+	}
+	if( provider_identifier != NULL )
+	{
+		memory_free(
+		 provider_identifier );
+	}
+	return( -1 );
+}
+
+/* Writes a message cache entry to a file stream
+ * Returns 1 if successful or -1 on error
+ */
+int message_cache_entry_write_file_stream(
+     message_cache_entry_t *message_cache_entry,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	uint8_t entry_data[ 28 ];
+
+	const system_character_t *string   = NULL;
+	static char *function              = "message_cache_entry_write_file_stream";
+	size_t string_size                 = 0;
+	uint32_t message_string_identifier = 0;
+
+	if( message_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_cache_entry->message_string != NULL )
+	{
+		message_string_identifier = message_cache_entry->message_string->identifier;
+		string                    = message_cache_entry->message_string->string;
+		string_size               = message_cache_entry->message_string->string_size;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 0 ] ),
+	 (uint32_t) message_cache_entry->event_log_type );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 4 ] ),
+	 message_cache_entry->event_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 8 ] ),
+	 message_cache_entry->event_identifier_qualifiers );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 12 ] ),
+	 message_cache_entry->language_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 16 ] ),
+	 message_cache_entry->message_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 20 ] ),
+	 message_string_identifier );
+
+	entry_data[ 24 ] = message_cache_entry->has_event_identifier_qualifiers;
+	entry_data[ 25 ] = message_cache_entry->message_identifier_from_qualifiers;
+	entry_data[ 26 ] = (uint8_t) ( message_cache_entry->message_string != NULL );
+	entry_data[ 27 ] = 0;
+
+	if( file_stream_write(
+	     stream,
+	     entry_data,
+	     28 ) != 28 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write entry data.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_cache_write_string(
+	     stream,
+	     message_cache_entry->provider_identifier,
+	     message_cache_entry->provider_identifier_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_cache_write_string(
+	     stream,
+	     message_cache_entry->event_source,
+	     message_cache_entry->event_source_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write event source.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_cache_write_string(
+	     stream,
+	     message_cache_entry->resource_filename,
+	     message_cache_entry->resource_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write resource filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_cache_write_string(
+	     stream,
+	     message_cache_entry->message_filename,
+	     message_cache_entry->message_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_cache_write_string(
+	     stream,
+	     string,
+	     string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the message cache entries from a file
+ * Returns 1 if successful, 0 if the file could not be opened or -1 on error
+ */
+int message_cache_read_file(
+     message_cache_t *message_cache,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ 16 ];
+
+	message_cache_entry_t *message_cache_entry = NULL;
+	FILE *stream                               = NULL;
+	static char *function                      = "message_cache_read_file";
+	uint32_t entry_index                       = 0;
+	uint32_t number_of_entries                 = 0;
+	uint16_t character_size                    = 0;
+	uint16_t format_version                    = 0;
+
+	if( message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		return( 0 );
+	}
+	if( file_stream_read(
+	     stream,
+	     file_header_data,
+	     16 ) != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     file_header_data,
+	     MESSAGE_CACHE_FILE_SIGNATURE,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( file_header_data[ 8 ] ),
+	 format_version );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( file_header_data[ 10 ] ),
+	 character_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( file_header_data[ 12 ] ),
+	 number_of_entries );
+
+	if( format_version != MESSAGE_CACHE_FILE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu16 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	/* The strings are stored little-endian in the size of the system character
+	 */
+	if( character_size != (uint16_t) sizeof( system_character_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character size: %" PRIu16 ".",
+		 function,
+		 character_size );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( message_cache_entry_read_file_stream(
+		     &message_cache_entry,
+		     stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entry: %" PRIu32 ".",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( message_cache_insert_entry(
+		     message_cache,
+		     message_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert entry: %" PRIu32 ".",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		message_cache_entry = NULL;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		stream = NULL;
+
+		goto on_error;
+	}
+	message_cache->is_modified = 0;
+
+	return( 1 );
+
+on_error:
+	if( message_cache_entry != NULL )
+	{
+		message_cache_entry_free(
+		 &message_cache_entry,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( -1 );
+}
+
+/* Writes the message cache entries to a file
+ * The entries are written to a temporary file that replaces the file
+ * once it was written completely, so that an interrupted write does not
+ * truncate an existing file
+ * Returns 1 if successful or -1 on error
+ */
+int message_cache_write_file(
+     message_cache_t *message_cache,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ 16 ];
+
+	message_cache_entry_t *message_cache_entry = NULL;
+	system_character_t *temporary_filename     = NULL;
+	FILE *stream                               = NULL;
+	static char *function                      = "message_cache_write_file";
+	size_t filename_length                     = 0;
+	int bucket_index                           = 0;
+	int result                                 = 0;
+
+	if( message_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 5 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	temporary_filename = system_string_allocate(
+	                      filename_length + 5 );
+
+	if( temporary_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create temporary filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     temporary_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( temporary_filename[ filename_length ] ),
+	     _SYSTEM_STRING( ".tmp" ),
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy temporary filename suffix.",
+		 function );
+
+		goto on_error;
+	}
+	temporary_filename[ filename_length + 4 ] = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          temporary_filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          temporary_filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     file_header_data,
+	     MESSAGE_CACHE_FILE_SIGNATURE,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( file_header_data[ 8 ] ),
+	 MESSAGE_CACHE_FILE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( file_header_data[ 10 ] ),
+	 sizeof( system_character_t ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 12 ] ),
+	 message_cache->number_of_entries );
+
+	if( file_stream_write(
+	     stream,
+	     file_header_data,
+	     16 ) != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < MESSAGE_CACHE_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		message_cache_entry = message_cache->buckets[ bucket_index ];
+
+		while( message_cache_entry != NULL )
+		{
+			if( message_cache_entry_write_file_stream(
+			     message_cache_entry,
+			     stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write entry.",
+				 function );
+
+				goto on_error;
+			}
+			message_cache_entry = message_cache_entry->next_entry;
+		}
+	}
+	result = file_stream_close(
+	          stream );
+
+	stream = NULL;
+
+	if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	/* Replace the file by the temporary file
+	 */
+#if defined( WINAPI ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = ( MoveFileExW(
+	            temporary_filename,
+	            filename,
+	            MOVEFILE_REPLACE_EXISTING ) != 0 );
+#elif defined( WINAPI )
+	result = ( MoveFileExA(
+	            temporary_filename,
+	            filename,
+	            MOVEFILE_REPLACE_EXISTING ) != 0 );
+#else
+	result = ( rename(
+	            temporary_filename,
+	            filename ) == 0 );
+#endif
+	if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to replace file with temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 temporary_filename );
+
+	message_cache->is_modified = 0;
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( temporary_filename != NULL )
+	{
+		/* Remove the incomplete temporary file, if any
+		 */
+#if defined( WINAPI ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		DeleteFileW(
+		 temporary_filename );
+#elif defined( WINAPI )
+		DeleteFileA(
+		 temporary_filename );
+#else
+		remove(
+		 temporary_filename );
+#endif
+		memory_free(
+		 temporary_filename );
+	}
+	return( -1 );
+}
+
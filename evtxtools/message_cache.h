@@ -0,0 +1,240 @@
+/*
+ * Message cache
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MESSAGE_CACHE_H )
+#define _MESSAGE_CACHE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "message_string.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define MESSAGE_CACHE_NUMBER_OF_BUCKETS		256
+#define MESSAGE_CACHE_MAXIMUM_NUMBER_OF_ENTRIES	4096
+
+#define MESSAGE_CACHE_FILE_SIGNATURE		"evtxmsgc"
+#define MESSAGE_CACHE_FILE_FORMAT_VERSION	1
+
+typedef struct message_cache_entry message_cache_entry_t;
+
+struct message_cache_entry
+{
+	/* The hash of the key values
+	 */
+	uint32_t hash;
+
+	/* The event log type
+	 */
+	int event_log_type;
+
+	/* The provider identifier string
+	 */
+	system_character_t *provider_identifier;
+
+	/* The provider identifier string length
+	 */
+	size_t provider_identifier_length;
+
+	/* The event source
+	 */
+	system_character_t *event_source;
+
+	/* The event source length
+	 */
+	size_t event_source_length;
+
+	/* The event identifier
+	 */
+	uint32_t event_identifier;
+
+	/* The event identifier qualifiers
+	 */
+	uint32_t event_identifier_qualifiers;
+
+	/* Value to indicate the event identifier qualifiers are set
+	 */
+	uint8_t has_event_identifier_qualifiers;
+
+	/* The language identifier
+	 */
+	uint32_t language_identifier;
+
+	/* The resource filename
+	 */
+	system_character_t *resource_filename;
+
+	/* The resource filename size
+	 */
+	size_t resource_filename_size;
+
+	/* The message filename
+	 */
+	system_character_t *message_filename;
+
+	/* The message filename size
+	 */
+	size_t message_filename_size;
+
+	/* The message identifier
+	 */
+	uint32_t message_identifier;
+
+	/* Value to indicate the message identifier was derived from the event identifier qualifiers
+	 */
+	uint8_t message_identifier_from_qualifiers;
+
+	/* The message string
+	 */
+	message_string_t *message_string;
+
+	/* The next entry in the same bucket
+	 */
+	message_cache_entry_t *next_entry;
+};
+
+typedef struct message_cache message_cache_t;
+
+struct message_cache
+{
+	/* The buckets
+	 */
+	message_cache_entry_t *buckets[ MESSAGE_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of entries, where 0 represents no maximum
+	 */
+	int maximum_number_of_entries;
+
+	/* Value to indicate entries were inserted
+	 */
+	uint8_t is_modified;
+};
+
+uint32_t message_cache_calculate_hash(
+          int event_log_type,
+          const system_character_t *provider_identifier,
+          size_t provider_identifier_length,
+          const system_character_t *event_source,
+          size_t event_source_length,
+          uint32_t event_identifier,
+          uint32_t event_identifier_qualifiers,
+          uint32_t language_identifier );
+
+int message_cache_entry_initialize(
+     message_cache_entry_t **message_cache_entry,
+     int event_log_type,
+     const system_character_t *provider_identifier,
+     size_t provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     uint8_t has_event_identifier_qualifiers,
+     uint32_t language_identifier,
+     libcerror_error_t **error );
+
+int message_cache_entry_free(
+     message_cache_entry_t **message_cache_entry,
+     libcerror_error_t **error );
+
+int message_cache_initialize(
+     message_cache_t **message_cache,
+     libcerror_error_t **error );
+
+int message_cache_free(
+     message_cache_t **message_cache,
+     libcerror_error_t **error );
+
+int message_cache_empty(
+     message_cache_t *message_cache,
+     libcerror_error_t **error );
+
+int message_cache_get_entry(
+     message_cache_t *message_cache,
+     int event_log_type,
+     const system_character_t *provider_identifier,
+     size_t provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     uint32_t event_identifier_qualifiers,
+     uint8_t has_event_identifier_qualifiers,
+     uint32_t language_identifier,
+     message_cache_entry_t **message_cache_entry,
+     libcerror_error_t **error );
+
+int message_cache_insert_entry(
+     message_cache_t *message_cache,
+     message_cache_entry_t *message_cache_entry,
+     libcerror_error_t **error );
+
+int message_cache_set_maximum_number_of_entries(
+     message_cache_t *message_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int message_cache_read_string(
+     FILE *stream,
+     system_character_t **string,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+int message_cache_write_string(
+     FILE *stream,
+     const system_character_t *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int message_cache_entry_read_file_stream(
+     message_cache_entry_t **message_cache_entry,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int message_cache_entry_write_file_stream(
+     message_cache_entry_t *message_cache_entry,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int message_cache_read_file(
+     message_cache_t *message_cache,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int message_cache_write_file(
+     message_cache_t *message_cache,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MESSAGE_CACHE_H ) */
+
@@ -31,16 +31,18 @@
 #include "evtxtools_libcpath.h"
 #include "evtxtools_libcsplit.h"
 #include "evtxtools_libevtx.h"
-#include "evtxtools_libfcache.h"
 #include "evtxtools_libfwevt.h"
 #include "evtxtools_libregf.h"
 #include "evtxtools_system_split_string.h"
 #include "evtxtools_wide_string.h"
+#include "message_cache.h"
 #include "message_handle.h"
 #include "message_string.h"
 #include "path_handle.h"
 #include "registry_file.h"
+#include "registry_value_cache.h"
 #include "resource_file.h"
+#include "resource_file_cache.h"
 
 /* Creates a message handle
  * Make sure the value message_handle is referencing, is set to NULL
@@ -120,9 +122,8 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( resource_file_cache_initialize(
 	     &( ( *message_handle )->resource_file_cache ),
-	     16,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -134,9 +135,8 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( resource_file_cache_initialize(
 	     &( ( *message_handle )->mui_resource_file_cache ),
-	     16,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -148,6 +148,32 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
+	if( registry_value_cache_initialize(
+	     &( ( *message_handle )->registry_value_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create registry value cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_cache_initialize(
+	     &( ( *message_handle )->message_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message cache.",
+		 function );
+
+		goto on_error;
+	}
 	( *message_handle )->ascii_codepage                = LIBREGF_CODEPAGE_WINDOWS_1252;
 	( *message_handle )->preferred_language_identifier = 0x00000409UL;
 
@@ -156,9 +182,21 @@ int message_handle_initialize(
 on_error:
 	if( *message_handle != NULL )
 	{
+		if( ( *message_handle )->registry_value_cache != NULL )
+		{
+			registry_value_cache_free(
+			 &( ( *message_handle )->registry_value_cache ),
+			 NULL );
+		}
+		if( ( *message_handle )->mui_resource_file_cache != NULL )
+		{
+			resource_file_cache_free(
+			 &( ( *message_handle )->mui_resource_file_cache ),
+			 NULL );
+		}
 		if( ( *message_handle )->resource_file_cache != NULL )
 		{
-			libfcache_cache_free(
+			resource_file_cache_free(
 			 &( ( *message_handle )->resource_file_cache ),
 			 NULL );
 		}
@@ -214,6 +252,11 @@ int message_handle_free(
 			memory_free(
 			 ( *message_handle )->registry_directory_name );
 		}
+		if( ( *message_handle )->eventlog_key_name != NULL )
+		{
+			memory_free(
+			 ( *message_handle )->eventlog_key_name );
+		}
 		if( ( *message_handle )->software_registry_file != NULL )
 		{
 			if( registry_file_free(
@@ -269,7 +312,7 @@ int message_handle_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
+		if( resource_file_cache_free(
 		     &( ( *message_handle )->resource_file_cache ),
 		     error ) != 1 )
 		{
@@ -282,7 +325,7 @@ int message_handle_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
+		if( resource_file_cache_free(
 		     &( ( *message_handle )->mui_resource_file_cache ),
 		     error ) != 1 )
 		{
@@ -295,6 +338,32 @@ int message_handle_free(
 
 			result = -1;
 		}
+		if( registry_value_cache_free(
+		     &( ( *message_handle )->registry_value_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free registry value cache.",
+			 function );
+
+			result = -1;
+		}
+		if( message_cache_free(
+		     &( ( *message_handle )->message_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free message cache.",
+			 function );
+
+			result = -1;
+		}
 		if( ( *message_handle )->winevt_publishers_key != NULL )
 		{
 			if( libregf_key_free(
@@ -798,6 +867,59 @@ int message_handle_set_resource_files_path(
 	return( 1 );
 }
 
+/* Sets the maximum number of cached resource files
+ * The value applies to both the resource file and the MUI resource file cache
+ * Returns 1 if successful or -1 on error
+ */
+int message_handle_set_maximum_number_of_cached_resource_files(
+     message_handle_t *message_handle,
+     int maximum_number_of_cached_resource_files,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_set_maximum_number_of_cached_resource_files";
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache_set_maximum_number_of_entries(
+	     message_handle->resource_file_cache,
+	     maximum_number_of_cached_resource_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of entries in resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache_set_maximum_number_of_entries(
+	     message_handle->mui_resource_file_cache,
+	     maximum_number_of_cached_resource_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of entries in MUI resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Opens the software registry file
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -1257,11 +1379,9 @@ int message_handle_open_system_registry_file(
      const char *eventlog_key_name,
      libcerror_error_t **error )
 {
-	libregf_key_t *sub_key              = NULL;
 	system_character_t *key_path        = NULL;
 	system_character_t *system_filename = NULL;
 	static char *function               = "message_handle_open_system_registry_file";
-	size_t eventlog_key_name_length     = 0;
 	size_t key_path_length              = 0;
 	int result                          = 0;
 
@@ -1287,9 +1407,6 @@ int message_handle_open_system_registry_file(
 
 		return( -1 );
 	}
-	eventlog_key_name_length = narrow_string_length(
-	                            eventlog_key_name );
-
 	if( ( message_handle->system_registry_filename == NULL )
 	 && ( message_handle->registry_directory_name != NULL ) )
 	{
@@ -1451,6 +1568,148 @@ int message_handle_open_system_registry_file(
 
 		goto on_error;
 	}
+	if( message_handle_set_eventlog_key_name(
+	     message_handle,
+	     eventlog_key_name,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set eventlog key name.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( system_filename != NULL )
+	{
+		memory_free(
+		 system_filename );
+	}
+	return( -1 );
+}
+
+/* Sets the eventlog key name
+ * This selects the eventlog services sub keys of the SYSTEM registry file
+ * without reopening the registry files, which allows the message handle to be
+ * reused for event logs of different types
+ * Returns 1 if successful, 0 if no SYSTEM registry file is open or -1 on error
+ */
+int message_handle_set_eventlog_key_name(
+     message_handle_t *message_handle,
+     const char *eventlog_key_name,
+     libcerror_error_t **error )
+{
+	libregf_key_t *sub_key          = NULL;
+	system_character_t *key_path    = NULL;
+	static char *function           = "message_handle_set_eventlog_key_name";
+	size_t eventlog_key_name_length = 0;
+	size_t key_path_length          = 0;
+	int result                      = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( eventlog_key_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid eventlog key name.",
+		 function );
+
+		return( -1 );
+	}
+	eventlog_key_name_length = narrow_string_length(
+	                            eventlog_key_name );
+
+	if( message_handle->eventlog_key_name != NULL )
+	{
+		memory_free(
+		 message_handle->eventlog_key_name );
+
+		message_handle->eventlog_key_name        = NULL;
+		message_handle->eventlog_key_name_length = 0;
+	}
+	message_handle->eventlog_key_name = narrow_string_allocate(
+	                                     eventlog_key_name_length + 1 );
+
+	if( message_handle->eventlog_key_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create eventlog key name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     message_handle->eventlog_key_name,
+	     eventlog_key_name,
+	     eventlog_key_name_length + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy eventlog key name.",
+		 function );
+
+		goto on_error;
+	}
+	message_handle->eventlog_key_name_length = eventlog_key_name_length;
+
+	if( message_handle->control_set_1_eventlog_services_key != NULL )
+	{
+		if( libregf_key_free(
+		     &( message_handle->control_set_1_eventlog_services_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free control set 1 eventlog services key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( message_handle->control_set_2_eventlog_services_key != NULL )
+	{
+		if( libregf_key_free(
+		     &( message_handle->control_set_2_eventlog_services_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free control set 2 eventlog services key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( message_handle->system_registry_file == NULL )
+	{
+		return( 0 );
+	}
 	/* Get the control set 1 eventlog services key:
 	 * SYSTEM\ControlSet001\Services\Eventlog
 	 */
@@ -1584,11 +1843,6 @@ on_error:
 		 &sub_key,
 		 NULL );
 	}
-	if( system_filename != NULL )
-	{
-		memory_free(
-		 system_filename );
-	}
 	return( -1 );
 }
 
@@ -1701,7 +1955,7 @@ int message_handle_close_input(
 			result = -1;
 		}
 	}
-	if( libfcache_cache_empty(
+	if( resource_file_cache_empty(
 	     message_handle->resource_file_cache,
 	     error ) != 1 )
 	{
@@ -1714,7 +1968,7 @@ int message_handle_close_input(
 
 		result = -1;
 	}
-	if( libfcache_cache_empty(
+	if( resource_file_cache_empty(
 	     message_handle->mui_resource_file_cache,
 	     error ) != 1 )
 	{
@@ -1727,6 +1981,32 @@ int message_handle_close_input(
 
 		result = -1;
 	}
+	if( registry_value_cache_empty(
+	     message_handle->registry_value_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty registry value cache.",
+		 function );
+
+		result = -1;
+	}
+	if( message_cache_empty(
+	     message_handle->message_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty message cache.",
+		 function );
+
+		result = -1;
+	}
 	return( result );
 }
 
@@ -1744,10 +2024,11 @@ int message_handle_get_value_by_event_source(
      size_t *value_string_size,
      libcerror_error_t **error )
 {
-	libregf_key_t *key     = NULL;
-	libregf_value_t *value = NULL;
-	static char *function  = "message_handle_get_value_by_event_source";
-	int result             = 0;
+	registry_value_cache_entry_t *registry_value_cache_entry = NULL;
+	libregf_key_t *key                                       = NULL;
+	libregf_value_t *value                                   = NULL;
+	static char *function                                    = "message_handle_get_value_by_event_source";
+	int result                                               = 0;
 
 	if( message_handle == NULL )
 	{
@@ -1793,6 +2074,67 @@ int message_handle_get_value_by_event_source(
 
 		return( -1 );
 	}
+	result = registry_value_cache_get_entry(
+	          message_handle->registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          message_handle->eventlog_key_name,
+	          message_handle->eventlog_key_name_length,
+	          event_source,
+	          event_source_length,
+	          value_name,
+	          value_name_length,
+	          &registry_value_cache_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve registry value cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( registry_value_cache_entry->value_string == NULL )
+		{
+			return( 0 );
+		}
+		*value_string = system_string_allocate(
+		                 registry_value_cache_entry->value_string_size );
+
+		if( *value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     *value_string,
+		     registry_value_cache_entry->value_string,
+		     registry_value_cache_entry->value_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value string.",
+			 function );
+
+			goto on_error;
+		}
+		*value_string_size = registry_value_cache_entry->value_string_size;
+
+		return( 1 );
+	}
 	if( message_handle->control_set_1_eventlog_services_key != NULL )
 	{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1915,7 +2257,7 @@ int message_handle_get_value_by_event_source(
 			*value_string = system_string_allocate(
 					 *value_string_size );
 
-			if( value_string == NULL )
+			if( *value_string == NULL )
 			{
 				libcerror_error_set(
 				 error,
@@ -1978,6 +2320,31 @@ int message_handle_get_value_by_event_source(
 			goto on_error;
 		}
 	}
+	/* Remember the value, or that it is not available, so that the registry
+	 * is only walked once per key and value name
+	 */
+	if( registry_value_cache_insert_value(
+	     message_handle->registry_value_cache,
+	     REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	     message_handle->eventlog_key_name,
+	     message_handle->eventlog_key_name_length,
+	     event_source,
+	     event_source_length,
+	     value_name,
+	     value_name_length,
+	     *value_string,
+	     *value_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert value into registry value cache.",
+		 function );
+
+		goto on_error;
+	}
 	return( result );
 
 on_error:
@@ -2019,10 +2386,11 @@ int message_handle_get_value_by_provider_identifier(
      size_t *value_string_size,
      libcerror_error_t **error )
 {
-	libregf_key_t *key     = NULL;
-	libregf_value_t *value = NULL;
-	static char *function  = "message_handle_get_value_by_provider_identifier";
-	int result             = 0;
+	registry_value_cache_entry_t *registry_value_cache_entry = NULL;
+	libregf_key_t *key                                       = NULL;
+	libregf_value_t *value                                   = NULL;
+	static char *function                                    = "message_handle_get_value_by_provider_identifier";
+	int result                                               = 0;
 
 	if( message_handle == NULL )
 	{
@@ -2068,6 +2436,67 @@ int message_handle_get_value_by_provider_identifier(
 
 		return( -1 );
 	}
+	result = registry_value_cache_get_entry(
+	          message_handle->registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_PROVIDER_IDENTIFIER,
+	          NULL,
+	          0,
+	          provider_identifier,
+	          provider_identifier_length,
+	          value_name,
+	          value_name_length,
+	          &registry_value_cache_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve registry value cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( registry_value_cache_entry->value_string == NULL )
+		{
+			return( 0 );
+		}
+		*value_string = system_string_allocate(
+		                 registry_value_cache_entry->value_string_size );
+
+		if( *value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     *value_string,
+		     registry_value_cache_entry->value_string,
+		     registry_value_cache_entry->value_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value string.",
+			 function );
+
+			goto on_error;
+		}
+		*value_string_size = registry_value_cache_entry->value_string_size;
+
+		return( 1 );
+	}
 	if( message_handle->winevt_publishers_key != NULL )
 	{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -2157,7 +2586,7 @@ int message_handle_get_value_by_provider_identifier(
 			*value_string = system_string_allocate(
 			                 *value_string_size );
 
-			if( value_string == NULL )
+			if( *value_string == NULL )
 			{
 				libcerror_error_set(
 				 error,
@@ -2220,6 +2649,31 @@ int message_handle_get_value_by_provider_identifier(
 			goto on_error;
 		}
 	}
+	/* Remember the value, or that it is not available, so that the registry
+	 * is only walked once per key and value name
+	 */
+	if( registry_value_cache_insert_value(
+	     message_handle->registry_value_cache,
+	     REGISTRY_VALUE_CACHE_KEY_TYPE_PROVIDER_IDENTIFIER,
+	     NULL,
+	     0,
+	     provider_identifier,
+	     provider_identifier_length,
+	     value_name,
+	     value_name_length,
+	     *value_string,
+	     *value_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert value into registry value cache.",
+		 function );
+
+		goto on_error;
+	}
 	return( result );
 
 on_error:
@@ -2952,7 +3406,6 @@ int message_handle_get_resource_file(
      libcerror_error_t **error )
 {
 	static char *function = "message_handle_get_resource_file";
-	int64_t timestamp     = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3020,46 +3473,20 @@ int message_handle_get_resource_file(
 
 		goto on_error;
 	}
-	if( libfcache_date_time_get_timestamp(
-	     &timestamp,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache timestamp.",
-		 function );
-
-		return( -1 );
-	}
-	if( libfcache_cache_set_value_by_index(
+	if( resource_file_cache_insert_resource_file(
 	     message_handle->resource_file_cache,
-	     message_handle->next_resource_file_cache_index,
-	     0,
-	     message_handle->next_resource_file_cache_index,
-	     timestamp,
-	     (intptr_t *) *resource_file,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &resource_file_free,
-	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     *resource_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set resource file in cache entry: %d.",
-		 function,
-		 message_handle->next_resource_file_cache_index );
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert resource file into resource file cache.",
+		 function );
 
 		goto on_error;
 	}
-	message_handle->next_resource_file_cache_index++;
-
-	if( message_handle->next_resource_file_cache_index == 16 )
-	{
-		message_handle->next_resource_file_cache_index = 0;
-	}
 	return( 1 );
 
 on_error:
@@ -3082,10 +3509,8 @@ int message_handle_get_resource_file_from_cache(
      resource_file_t **resource_file,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	static char *function                = "message_handle_get_resource_file_from_cache";
-	int cache_index                      = 0;
-	int result                           = 0;
+	static char *function = "message_handle_get_resource_file_from_cache";
+	int result            = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3109,68 +3534,23 @@ int message_handle_get_resource_file_from_cache(
 
 		return( -1 );
 	}
-	for( cache_index = 0;
-	     cache_index < 16;
-	     cache_index++ )
-	{
-		if( libfcache_cache_get_value_by_index(
-		     message_handle->resource_file_cache,
-		     cache_index,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d.",
-			 function,
-			 cache_index );
-
-			return( -1 );
-		}
-		if( cache_value != NULL )
-		{
-			if( libfcache_cache_value_get_value(
-			     cache_value,
-			     (intptr_t **) resource_file,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file from cache value: %d.",
-				 function,
-				 cache_index );
-
-				return( -1 );
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			if( ( resource_filename_length + 1 ) != ( *resource_file )->name_size )
-			{
-				*resource_file = NULL;
-			}
-			else if( system_string_compare(
-				  resource_filename,
-				  ( *resource_file )->name,
-				  resource_filename_length ) != 0 )
-			{
-				*resource_file = NULL;
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			result = 1;
+	result = resource_file_cache_get_resource_file(
+	          message_handle->resource_file_cache,
+	          resource_filename,
+	          resource_filename_length,
+	          resource_file,
+	          error );
 
-			break;
-		}
-	}
-	if( result == 0 )
+	if( result == -1 )
 	{
-		*resource_file = NULL;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from resource file cache.",
+		 function );
+
+		return( -1 );
 	}
 	return( result );
 }
@@ -3187,7 +3567,6 @@ int message_handle_get_mui_resource_file(
      libcerror_error_t **error )
 {
 	static char *function = "message_handle_get_mui_resource_file";
-	int64_t timestamp     = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3255,46 +3634,20 @@ int message_handle_get_mui_resource_file(
 
 		goto on_error;
 	}
-	if( libfcache_date_time_get_timestamp(
-	     &timestamp,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache timestamp.",
-		 function );
-
-		return( -1 );
-	}
-	if( libfcache_cache_set_value_by_index(
+	if( resource_file_cache_insert_resource_file(
 	     message_handle->mui_resource_file_cache,
-	     message_handle->next_mui_resource_file_cache_index,
-	     0,
-	     message_handle->next_mui_resource_file_cache_index,
-	     timestamp,
-	     (intptr_t *) *resource_file,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &resource_file_free,
-	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     *resource_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set resource file in cache entry: %d.",
-		 function,
-		 message_handle->next_mui_resource_file_cache_index );
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert resource file into MUI resource file cache.",
+		 function );
 
 		goto on_error;
 	}
-	message_handle->next_mui_resource_file_cache_index++;
-
-	if( message_handle->next_mui_resource_file_cache_index == 16 )
-	{
-		message_handle->next_mui_resource_file_cache_index = 0;
-	}
 	return( 1 );
 
 on_error:
@@ -3317,10 +3670,8 @@ int message_handle_get_mui_resource_file_from_cache(
      resource_file_t **resource_file,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	static char *function                = "message_handle_get_mui_resource_file_from_cache";
-	int cache_index                      = 0;
-	int result                           = 0;
+	static char *function = "message_handle_get_mui_resource_file_from_cache";
+	int result            = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3344,64 +3695,23 @@ int message_handle_get_mui_resource_file_from_cache(
 
 		return( -1 );
 	}
-	for( cache_index = 0;
-	     cache_index < 16;
-	     cache_index++ )
-	{
-		if( libfcache_cache_get_value_by_index(
-		     message_handle->mui_resource_file_cache,
-		     cache_index,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d.",
-			 function,
-			 cache_index );
-
-			return( -1 );
-		}
-		if( cache_value != NULL )
-		{
-			if( libfcache_cache_value_get_value(
-			     cache_value,
-			     (intptr_t **) resource_file,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file from cache value: %d.",
-				 function,
-				 cache_index );
+	result = resource_file_cache_get_resource_file(
+	          message_handle->mui_resource_file_cache,
+	          resource_filename,
+	          resource_filename_length,
+	          resource_file,
+	          error );
 
-				return( -1 );
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			if( ( resource_filename_length + 1 ) != ( *resource_file )->name_size )
-			{
-				*resource_file = NULL;
-			}
-			else if( system_string_compare(
-				  resource_filename,
-				  ( *resource_file )->name,
-				  resource_filename_length ) != 0 )
-			{
-				*resource_file = NULL;
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			result = 1;
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from MUI resource file cache.",
+		 function );
 
-			break;
-		}
+		return( -1 );
 	}
 	return( result );
 }
@@ -4016,8 +4326,8 @@ int message_handle_get_resource_file_by_provider_identifier(
 			{
 				if( message_handle_get_resource_file(
 				     message_handle,
-				     resource_filename,
-				     resource_filename_length,
+				     resource_filename_string_segment,
+				     resource_filename_string_segment_size - 1,
 				     resource_file_path,
 				     resource_file,
 				     error ) != 1 )
@@ -26,12 +26,14 @@
 #include <types.h>
 
 #include "evtxtools_libcerror.h"
-#include "evtxtools_libfcache.h"
 #include "evtxtools_libregf.h"
+#include "message_cache.h"
 #include "message_string.h"
 #include "path_handle.h"
 #include "registry_file.h"
+#include "registry_value_cache.h"
 #include "resource_file.h"
+#include "resource_file_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -109,25 +111,33 @@ struct message_handle
 	 */
 	libregf_key_t *control_set_2_eventlog_services_key;
 
+	/* The eventlog key name
+	 */
+	char *eventlog_key_name;
+
+	/* The eventlog key name length
+	 */
+	size_t eventlog_key_name_length;
+
+	/* The registry value cache
+	 */
+	registry_value_cache_t *registry_value_cache;
+
 	/* The resource files path
 	 */
 	const system_character_t *resource_files_path;
 
 	/* The resource file cache
 	 */
-	libfcache_cache_t *resource_file_cache;
-
-	/* The next available resource file cache index
-	 */
-	int next_resource_file_cache_index;
+	resource_file_cache_t *resource_file_cache;
 
 	/* The MUI resource file cache
 	 */
-	libfcache_cache_t *mui_resource_file_cache;
+	resource_file_cache_t *mui_resource_file_cache;
 
-	/* The next available MUI resource file cache index
+	/* The message cache
 	 */
-	int next_mui_resource_file_cache_index;
+	message_cache_t *message_cache;
 
 	/* The ascii codepage
 	 */
@@ -185,6 +195,11 @@ int message_handle_set_resource_files_path(
      const system_character_t *path,
      libcerror_error_t **error );
 
+int message_handle_set_maximum_number_of_cached_resource_files(
+     message_handle_t *message_handle,
+     int maximum_number_of_cached_resource_files,
+     libcerror_error_t **error );
+
 int message_handle_open_software_registry_file(
      message_handle_t *message_handle,
      libcerror_error_t **error );
@@ -194,6 +209,11 @@ int message_handle_open_system_registry_file(
      const char *eventlog_key_name,
      libcerror_error_t **error );
 
+int message_handle_set_eventlog_key_name(
+     message_handle_t *message_handle,
+     const char *eventlog_key_name,
+     libcerror_error_t **error );
+
 int message_handle_open_input(
      message_handle_t *message_handle,
      const char *eventlog_key_name,
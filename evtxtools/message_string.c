@@ -141,6 +141,16 @@ int message_string_free(
 			memory_free(
 			 ( *message_string )->string );
 		}
+		if( ( *message_string )->segments != NULL )
+		{
+			memory_free(
+			 ( *message_string )->segments );
+		}
+		if( ( *message_string )->segments_text != NULL )
+		{
+			memory_free(
+			 ( *message_string )->segments_text );
+		}
 		memory_free(
 		 *message_string );
 
@@ -149,6 +159,100 @@ int message_string_free(
 	return( result );
 }
 
+/* Clones the message string
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_clone(
+     message_string_t **destination_message_string,
+     message_string_t *source_message_string,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_clone";
+
+	if( destination_message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_message_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination message string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_message_string == NULL )
+	{
+		return( 1 );
+	}
+	if( message_string_initialize(
+	     destination_message_string,
+	     source_message_string->identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination message string.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_message_string->string != NULL )
+	{
+		( *destination_message_string )->string = system_string_allocate(
+		                                           source_message_string->string_size );
+
+		if( ( *destination_message_string )->string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination string.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     ( *destination_message_string )->string,
+		     source_message_string->string,
+		     source_message_string->string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_message_string )->string_size = source_message_string->string_size;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_message_string != NULL )
+	{
+		message_string_free(
+		 destination_message_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Retrieve the message string from the message table resource
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -285,24 +389,204 @@ on_error:
 	return( -1 );
 }
 
-/* Prints the message string to a FILE stream
+/* Appends a segment
  * Returns 1 if successful or -1 on error
  */
-int message_string_fprint(
+int message_string_append_segment(
+     message_string_t *message_string,
+     uint8_t segment_type,
+     message_string_segment_t **segment,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "message_string_append_segment";
+	int number_of_segments = 0;
+
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string->number_of_segments >= message_string->number_of_allocated_segments )
+	{
+		if( message_string->number_of_allocated_segments == 0 )
+		{
+			number_of_segments = MESSAGE_STRING_MINIMUM_NUMBER_OF_SEGMENTS;
+		}
+		else
+		{
+			number_of_segments = message_string->number_of_allocated_segments * 2;
+		}
+		if( ( number_of_segments < message_string->number_of_allocated_segments )
+		 || ( (size_t) number_of_segments > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( message_string_segment_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of segments value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                message_string->segments,
+		                sizeof( message_string_segment_t ) * number_of_segments );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize segments.",
+			 function );
+
+			return( -1 );
+		}
+		message_string->segments                     = (message_string_segment_t *) reallocation;
+		message_string->number_of_allocated_segments = number_of_segments;
+	}
+	*segment = &( message_string->segments[ message_string->number_of_segments ] );
+
+	if( memory_set(
+	     *segment,
+	     0,
+	     sizeof( message_string_segment_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment.",
+		 function );
+
+		*segment = NULL;
+
+		return( -1 );
+	}
+	( *segment )->type = segment_type;
+
+	message_string->number_of_segments += 1;
+
+	return( 1 );
+}
+
+/* Appends a character to the text segments
+ * The character is added to the last segment if it is a text segment
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_append_segment_text(
+     message_string_t *message_string,
+     system_character_t character,
+     libcerror_error_t **error )
+{
+	message_string_segment_t *segment = NULL;
+	static char *function             = "message_string_append_segment_text";
+
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string->segments_text == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message string - missing segments text.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every character of the string results in at most one character of the segments text
+	 */
+	if( message_string->segments_text_length >= message_string->string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid message string - segments text length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string->number_of_segments > 0 )
+	{
+		segment = &( message_string->segments[ message_string->number_of_segments - 1 ] );
+
+		if( segment->type != MESSAGE_STRING_SEGMENT_TYPE_TEXT )
+		{
+			segment = NULL;
+		}
+	}
+	if( segment == NULL )
+	{
+		if( message_string_append_segment(
+		     message_string,
+		     MESSAGE_STRING_SEGMENT_TYPE_TEXT,
+		     &segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append text segment.",
+			 function );
+
+			return( -1 );
+		}
+		segment->string_index = message_string->segments_text_length;
+	}
+	message_string->segments_text[ message_string->segments_text_length++ ] = character;
+
+	segment->string_length += 1;
+
+	return( 1 );
+}
+
+/* Compiles the string into segments
+ * The segments consist of text, conditional new lines and arguments that
+ * refer to the strings of the record. The string is compiled once and the
+ * segments are retained for subsequent formatting
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_compile(
      message_string_t *message_string,
-     libevtx_record_t *record,
-     FILE *stream,
      libcerror_error_t **error )
 {
-	system_character_t *value_string   = NULL;
-	static char *function              = "message_string_fprint";
+	message_string_segment_t *segment  = NULL;
+	static char *function              = "message_string_compile";
 	size_t conversion_specifier_length = 0;
-	size_t message_string_length       = 0;
 	size_t message_string_index        = 0;
-	size_t value_string_size           = 0;
-	system_character_t last_character  = 0;
-	int number_of_strings              = 0;
-	int result                         = 0;
+	size_t message_string_length       = 0;
+	system_character_t character       = 0;
 	int value_string_index             = 0;
 
 	if( message_string == NULL )
@@ -316,42 +600,46 @@ int message_string_fprint(
 
 		return( -1 );
 	}
-	if( libevtx_record_get_number_of_strings(
-	     record,
-	     &number_of_strings,
-	     error ) != 1 )
+	if( message_string->is_compiled != 0 )
+	{
+		return( 1 );
+	}
+	if( ( message_string->string == NULL )
+	 || ( message_string->string_size == 0 ) )
+	{
+		message_string->is_compiled = 1;
+
+		return( 1 );
+	}
+	message_string->segments_text = system_string_allocate(
+	                                 message_string->string_size );
+
+	if( message_string->segments_text == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of strings in record.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segments text.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	fprintf(
-	 stream,
-	 "Message format string\t\t: %" PRIs_SYSTEM "\n",
-	 message_string->string );
-#endif
-	fprintf(
-	 stream,
-	 "Message string\t\t\t: " );
-
 	message_string_length = message_string->string_size - 1;
-	message_string_index  = 0;
 
 	while( message_string_index < message_string_length )
 	{
-		if( ( ( message_string->string )[ message_string_index ] == (system_character_t) '%' )
+		character = ( message_string->string )[ message_string_index ];
+
+		if( ( character == (system_character_t) '%' )
 		 && ( ( message_string_index + 1 ) < message_string_length ) )
 		{
 /* TODO add support for more conversion specifiers */
+			character = ( message_string->string )[ message_string_index + 1 ];
+
 			/* Ignore %0 = end of string, %r = cariage return */
-			if( ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '0' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 'r' ) )
+			if( ( character == (system_character_t) '0' )
+			 || ( character == (system_character_t) 'r' ) )
 			{
 				message_string_index += 2;
 
@@ -362,69 +650,66 @@ int message_string_fprint(
 			 *  %! = !
 			 *  %% = %
 			 *  %. = .
+			 *  %b = <space>
+			 *  %t = <tab>
 			 */
-			if( ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) ' ' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '!' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '%' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '.' ) )
+			if( ( character == (system_character_t) ' ' )
+			 || ( character == (system_character_t) '!' )
+			 || ( character == (system_character_t) '%' )
+			 || ( character == (system_character_t) '.' )
+			 || ( character == (system_character_t) 'b' )
+			 || ( character == (system_character_t) 't' ) )
 			{
-				last_character = ( message_string->string )[ message_string_index + 1 ];
-
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
-
-				message_string_index += 2;
-
-				continue;
-			}
-			/* Replace %b = <space> */
-			if( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 'b' )
-			{
-				last_character = (system_character_t) ' ';
-
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
+				if( character == (system_character_t) 'b' )
+				{
+					character = (system_character_t) ' ';
+				}
+				else if( character == (system_character_t) 't' )
+				{
+					character = (system_character_t) '\t';
+				}
+				if( message_string_append_segment_text(
+				     message_string,
+				     character,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append segment text.",
+					 function );
 
+					goto on_error;
+				}
 				message_string_index += 2;
 
 				continue;
 			}
 			/* Replace %n = <new line> */
-			if( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 'n' )
+			if( character == (system_character_t) 'n' )
 			{
-				if( last_character != (system_character_t) '\n' )
+				if( message_string_append_segment(
+				     message_string,
+				     MESSAGE_STRING_SEGMENT_TYPE_NEW_LINE,
+				     &segment,
+				     error ) != 1 )
 				{
-					last_character = (system_character_t) '\n';
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append new line segment.",
+					 function );
 
-					fprintf(
-					 stream,
-					 "%c",
-					 last_character );
+					goto on_error;
 				}
 				message_string_index += 2;
 
 				continue;
 			}
-			/* Replace %t = <tab> */
-			if( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 't' )
-			{
-				last_character = (system_character_t) '\t';
-
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
-
-				message_string_index += 2;
-
-				continue;
-			}
-			if( ( ( message_string->string )[ message_string_index + 1 ] < (system_character_t) '1' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] > (system_character_t) '9' ) )
+			if( ( character < (system_character_t) '1' )
+			 || ( character > (system_character_t) '9' ) )
 			{
 				libcerror_error_set(
 				 error,
@@ -436,11 +721,11 @@ int message_string_fprint(
 
 				goto on_error;
 			}
-			value_string_index = (int) ( message_string->string )[ message_string_index + 1 ] - (int) '0';
+			value_string_index = (int) character - (int) '0';
 
 			conversion_specifier_length = 2;
 
-		 	if( ( ( message_string_index + 3 ) < message_string_length )
+		 	if( ( ( message_string_index + 2 ) < message_string_length )
 			 && ( ( message_string->string )[ message_string_index + 2 ] >= (system_character_t) '0' )
 			 && ( ( message_string->string )[ message_string_index + 2 ] <= (system_character_t) '9' ) )
 			{
@@ -451,7 +736,7 @@ int message_string_fprint(
 			}
 			value_string_index -= 1;
 
-		 	if( ( ( message_string_index + conversion_specifier_length + 3 ) < message_string_length )
+		 	if( ( ( message_string_index + conversion_specifier_length + 3 ) <= message_string_length )
 			 && ( ( message_string->string )[ message_string_index + conversion_specifier_length ] == (system_character_t) '!' ) )
 			{
 				if( ( ( message_string->string )[ message_string_index + conversion_specifier_length + 1 ] != (system_character_t) 's' )
@@ -469,63 +754,369 @@ int message_string_fprint(
 				}
 				conversion_specifier_length += 3;
 			}
-/* TODO remove index check after user data support */
-			if( value_string_index < number_of_strings )
+			if( message_string_append_segment(
+			     message_string,
+			     MESSAGE_STRING_SEGMENT_TYPE_ARGUMENT,
+			     &segment,
+			     error ) != 1 )
 			{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libevtx_record_get_utf16_string_size(
-					  record,
-					  value_string_index,
-					  &value_string_size,
-					  error );
-#else
-				result = libevtx_record_get_utf8_string_size(
-					  record,
-					  value_string_index,
-					  &value_string_size,
-					  error );
-#endif
-				if( result != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve string: %d size.",
-					 function,
-					 value_string_index );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append argument segment.",
+				 function );
+
+				goto on_error;
+			}
+			segment->string_index        = message_string_index;
+			segment->string_length       = conversion_specifier_length;
+			segment->value_string_index  = value_string_index;
+			segment->following_character = ( message_string->string )[ message_string_index + conversion_specifier_length ];
+
+			message_string_index += conversion_specifier_length;
+		}
+		else
+		{
+			/* Ignore \r characters
+			 * A \n character is a conditional new line since multiple \n characters are ignored
+			 */
+			if( character == (system_character_t) '\n' )
+			{
+				if( message_string_append_segment(
+				     message_string,
+				     MESSAGE_STRING_SEGMENT_TYPE_NEW_LINE,
+				     &segment,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append new line segment.",
+					 function );
 
 					goto on_error;
 				}
-				if( value_string_size > 0 )
+			}
+			else if( ( character != 0 )
+			      && ( character != (system_character_t) '\r' ) )
+			{
+				if( message_string_append_segment_text(
+				     message_string,
+				     character,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append segment text.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			message_string_index += 1;
+		}
+	}
+	message_string->is_compiled = 1;
+
+	return( 1 );
+
+on_error:
+	if( message_string->segments_text != NULL )
+	{
+		memory_free(
+		 message_string->segments_text );
+
+		message_string->segments_text = NULL;
+	}
+	message_string->segments_text_length = 0;
+	message_string->number_of_segments   = 0;
+
+	return( -1 );
+}
+
+/* Resizes a buffer to contain at least the required number of characters
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_resize_buffer(
+     system_character_t **buffer,
+     size_t *buffer_size,
+     size_t required_buffer_size,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "message_string_resize_buffer";
+	size_t safe_buffer_size = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *buffer != NULL )
+	 && ( required_buffer_size <= *buffer_size ) )
+	{
+		return( 1 );
+	}
+	safe_buffer_size = *buffer_size;
+
+	if( safe_buffer_size < 256 )
+	{
+		safe_buffer_size = 256;
+	}
+	while( safe_buffer_size < required_buffer_size )
+	{
+		safe_buffer_size *= 2;
+	}
+	if( safe_buffer_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                *buffer,
+	                sizeof( system_character_t ) * safe_buffer_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer      = (system_character_t *) reallocation;
+	*buffer_size = safe_buffer_size;
+
+	return( 1 );
+}
+
+/* Formats the message string with the strings of the record
+ * The formatted string is written into the buffer, which is resized if needed
+ * and can be reused for subsequent records
+ * If record is NULL the conversion specifiers are retained in the formatted string
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_format(
+     message_string_t *message_string,
+     libevtx_record_t *record,
+     system_character_t **buffer,
+     size_t *buffer_size,
+     size_t *formatted_string_length,
+     libcerror_error_t **error )
+{
+	message_string_segment_t *segment = NULL;
+	static char *function             = "message_string_format";
+	size_t buffer_index               = 0;
+	size_t value_string_size          = 0;
+	system_character_t last_character = 0;
+	int number_of_strings             = 0;
+	int result                        = 0;
+	int segment_index                 = 0;
+
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( formatted_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid formatted string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string_compile(
+	     message_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compile message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( record != NULL )
+	{
+		if( libevtx_record_get_number_of_strings(
+		     record,
+		     &number_of_strings,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of strings in record.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( message_string_resize_buffer(
+	     buffer,
+	     buffer_size,
+	     message_string->segments_text_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_index = 0;
+	     segment_index < message_string->number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( message_string->segments[ segment_index ] );
+
+		switch( segment->type )
+		{
+			case MESSAGE_STRING_SEGMENT_TYPE_TEXT:
+				if( message_string_resize_buffer(
+				     buffer,
+				     buffer_size,
+				     buffer_index + segment->string_length + 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize buffer.",
+					 function );
+
+					return( -1 );
+				}
+				if( memory_copy(
+				     &( ( *buffer )[ buffer_index ] ),
+				     &( ( message_string->segments_text )[ segment->string_index ] ),
+				     sizeof( system_character_t ) * segment->string_length ) == NULL )
 				{
-					value_string = system_string_allocate(
-							value_string_size );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy segment: %d text.",
+					 function,
+					 segment_index );
 
-					if( value_string == NULL )
+					return( -1 );
+				}
+				buffer_index += segment->string_length;
+
+				last_character = ( message_string->segments_text )[ segment->string_index + segment->string_length - 1 ];
+
+				break;
+
+			case MESSAGE_STRING_SEGMENT_TYPE_NEW_LINE:
+				/* Ignore multiple new lines */
+				if( last_character != (system_character_t) '\n' )
+				{
+					if( message_string_resize_buffer(
+					     buffer,
+					     buffer_size,
+					     buffer_index + 2,
+					     error ) != 1 )
 					{
 						libcerror_error_set(
 						 error,
-						 LIBCERROR_ERROR_DOMAIN_MEMORY,
-						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-						 "%s: unable to create value string.",
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize buffer.",
 						 function );
 
-						goto on_error;
+						return( -1 );
 					}
+					last_character = (system_character_t) '\n';
+
+					( *buffer )[ buffer_index++ ] = last_character;
+				}
+				break;
+
+			case MESSAGE_STRING_SEGMENT_TYPE_ARGUMENT:
+/* TODO remove index check after user data support */
+				if( segment->value_string_index < number_of_strings )
+				{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-					result = libevtx_record_get_utf16_string(
+					result = libevtx_record_get_utf16_string_size(
 						  record,
-						  value_string_index,
-						  (uint16_t *) value_string,
-						  value_string_size,
+						  segment->value_string_index,
+						  &value_string_size,
 						  error );
 #else
-					result = libevtx_record_get_utf8_string(
+					result = libevtx_record_get_utf8_string_size(
 						  record,
-						  value_string_index,
-						  (uint8_t *) value_string,
-						  value_string_size,
+						  segment->value_string_index,
+						  &value_string_size,
 						  error );
 #endif
 					if( result != 1 )
@@ -534,77 +1125,182 @@ int message_string_fprint(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve string: %d.",
+						 "%s: unable to retrieve string: %d size.",
 						 function,
-						 value_string_index );
+						 segment->value_string_index );
 
-						goto on_error;
+						return( -1 );
+					}
+					if( value_string_size > 0 )
+					{
+						if( message_string_resize_buffer(
+						     buffer,
+						     buffer_size,
+						     buffer_index + value_string_size,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+							 "%s: unable to resize buffer.",
+							 function );
+
+							return( -1 );
+						}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+						result = libevtx_record_get_utf16_string(
+							  record,
+							  segment->value_string_index,
+							  (uint16_t *) &( ( *buffer )[ buffer_index ] ),
+							  value_string_size,
+							  error );
+#else
+						result = libevtx_record_get_utf8_string(
+							  record,
+							  segment->value_string_index,
+							  (uint8_t *) &( ( *buffer )[ buffer_index ] ),
+							  value_string_size,
+							  error );
+#endif
+						if( result != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to retrieve string: %d.",
+							 function,
+							 segment->value_string_index );
+
+							return( -1 );
+						}
+						buffer_index += value_string_size - 1;
 					}
-					fprintf(
-					 stream,
-					 "%" PRIs_SYSTEM "",
-					 value_string );
-
-					memory_free(
-					 value_string );
-
-					value_string = NULL;
 				}
-				message_string_index += conversion_specifier_length;
-			}
-			else
-			{
-				do
+				else
 				{
-					fprintf(
-					 stream,
-					 "%" PRIc_SYSTEM "",
-					 ( message_string->string )[ message_string_index++ ] );
+					/* Print the conversion specifier if the record does not have the corresponding string
+					 */
+					if( message_string_resize_buffer(
+					     buffer,
+					     buffer_size,
+					     buffer_index + segment->string_length + 1,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize buffer.",
+						 function );
 
-					conversion_specifier_length--;
-				}
-				while( conversion_specifier_length > 0 );
+						return( -1 );
+					}
+					if( memory_copy(
+					     &( ( *buffer )[ buffer_index ] ),
+					     &( ( message_string->string )[ segment->string_index ] ),
+					     sizeof( system_character_t ) * segment->string_length ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+						 "%s: unable to copy segment: %d conversion specifier.",
+						 function,
+						 segment_index );
 
-				last_character = ( message_string->string )[ message_string_index ];
-			}
-		}
-		else
-		{
-			if( ( message_string->string )[ message_string_index ] != 0 )
-			{
-				if( ( message_string->string )[ message_string_index ] == (system_character_t) '\r' )
-				{
-					/* Ignore \r characters */
-				}
-				else if( ( ( message_string->string )[ message_string_index ] == (system_character_t) '\n' )
-				      && ( last_character == (system_character_t) '\n' ) )
-				{
-					/* Ignore multiple \n characters */
-				}
-				else
-				{
-					fprintf(
-					 stream,
-					 "%" PRIc_SYSTEM "",
-					 ( message_string->string )[ message_string_index ] );
+						return( -1 );
+					}
+					buffer_index += segment->string_length;
 
-					last_character = ( message_string->string )[ message_string_index ];
+					last_character = segment->following_character;
 				}
-			}
-			message_string_index += 1;
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported segment: %d type: %" PRIu8 ".",
+				 function,
+				 segment_index,
+				 segment->type );
+
+				return( -1 );
 		}
 	}
+	( *buffer )[ buffer_index ] = 0;
+
+	*formatted_string_length = buffer_index;
+
+	return( 1 );
+}
+
+/* Prints the message string to a FILE stream
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_fprint(
+     message_string_t *message_string,
+     libevtx_record_t *record,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	system_character_t *buffer     = NULL;
+	static char *function          = "message_string_fprint";
+	size_t buffer_size             = 0;
+	size_t formatted_string_length = 0;
+
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
 	fprintf(
 	 stream,
-	 "\n" );
+	 "Message format string\t\t: %" PRIs_SYSTEM "\n",
+	 message_string->string );
+#endif
+	if( message_string_format(
+	     message_string,
+	     record,
+	     &buffer,
+	     &buffer_size,
+	     &formatted_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to format message string.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 stream,
+	 "Message string\t\t\t: %" PRIs_SYSTEM "\n",
+	 buffer );
+
+	memory_free(
+	 buffer );
 
 	return( 1 );
 
 on_error:
-	if( value_string != NULL )
+	if( buffer != NULL )
 	{
 		memory_free(
-		 value_string );
+		 buffer );
 	}
 	return( -1 );
 }
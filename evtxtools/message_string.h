@@ -34,6 +34,42 @@
 extern "C" {
 #endif
 
+#define MESSAGE_STRING_MINIMUM_NUMBER_OF_SEGMENTS	8
+
+enum MESSAGE_STRING_SEGMENT_TYPES
+{
+	MESSAGE_STRING_SEGMENT_TYPE_TEXT	= 1,
+	MESSAGE_STRING_SEGMENT_TYPE_NEW_LINE	= 2,
+	MESSAGE_STRING_SEGMENT_TYPE_ARGUMENT	= 3
+};
+
+typedef struct message_string_segment message_string_segment_t;
+
+struct message_string_segment
+{
+	/* The segment type
+	 */
+	uint8_t type;
+
+	/* The index of the first character
+	 * For a text segment this is relative to the segments text
+	 * For an argument segment this is the conversion specifier relative to the string
+	 */
+	size_t string_index;
+
+	/* The number of characters
+	 */
+	size_t string_length;
+
+	/* The value string index of an argument segment
+	 */
+	int value_string_index;
+
+	/* The character following the conversion specifier of an argument segment
+	 */
+	system_character_t following_character;
+};
+
 typedef struct message_string message_string_t;
 
 struct message_string
@@ -49,6 +85,30 @@ struct message_string
 	/* The string size
 	 */
 	size_t string_size;
+
+	/* Value to indicate the string was compiled into segments
+	 */
+	uint8_t is_compiled;
+
+	/* The segments
+	 */
+	message_string_segment_t *segments;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The number of allocated segments
+	 */
+	int number_of_allocated_segments;
+
+	/* The text of the text segments
+	 */
+	system_character_t *segments_text;
+
+	/* The length of the text of the text segments
+	 */
+	size_t segments_text_length;
 };
 
 int message_string_initialize(
@@ -60,11 +120,45 @@ int message_string_free(
      message_string_t **message_string,
      libcerror_error_t **error );
 
+int message_string_clone(
+     message_string_t **destination_message_string,
+     message_string_t *source_message_string,
+     libcerror_error_t **error );
+
 int message_string_get_from_message_table_resource(
      message_string_t *message_string,
      libwrc_message_table_resource_t *message_table_resource,
      libcerror_error_t **error );
 
+int message_string_append_segment(
+     message_string_t *message_string,
+     uint8_t segment_type,
+     message_string_segment_t **segment,
+     libcerror_error_t **error );
+
+int message_string_append_segment_text(
+     message_string_t *message_string,
+     system_character_t character,
+     libcerror_error_t **error );
+
+int message_string_compile(
+     message_string_t *message_string,
+     libcerror_error_t **error );
+
+int message_string_resize_buffer(
+     system_character_t **buffer,
+     size_t *buffer_size,
+     size_t required_buffer_size,
+     libcerror_error_t **error );
+
+int message_string_format(
+     message_string_t *message_string,
+     libevtx_record_t *record,
+     system_character_t **buffer,
+     size_t *buffer_size,
+     size_t *formatted_string_length,
+     libcerror_error_t **error );
+
 int message_string_fprint(
      message_string_t *message_string,
      libevtx_record_t *record,
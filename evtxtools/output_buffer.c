@@ -0,0 +1,1018 @@
+/*
+ * Output buffer
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libfdatetime.h"
+#include "output_buffer.h"
+
+/* The initial size of the output buffer
+ */
+#define OUTPUT_BUFFER_INITIAL_SIZE	( 2 * OUTPUT_BUFFER_FLUSH_SIZE )
+
+static const char *output_buffer_month_names[ 12 ] = {
+	"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+	"Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
+/* Creates an output buffer
+ * Make sure the value output_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_initialize(
+     output_buffer_t **output_buffer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_initialize";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	*output_buffer = memory_allocate_structure(
+	                  output_buffer_t );
+
+	if( *output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output_buffer,
+	     0,
+	     sizeof( output_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output buffer.",
+		 function );
+
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+
+		return( -1 );
+	}
+	( *output_buffer )->buffer = system_string_allocate(
+	                              OUTPUT_BUFFER_INITIAL_SIZE );
+
+	if( ( *output_buffer )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *output_buffer )->stream      = stream;
+	( *output_buffer )->buffer_size = OUTPUT_BUFFER_INITIAL_SIZE;
+
+	return( 1 );
+
+on_error:
+	if( *output_buffer != NULL )
+	{
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output buffer
+ * Any data remaining in the buffer is discarded, use output_buffer_flush to write it
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_free(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_free";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		if( ( *output_buffer )->buffer != NULL )
+		{
+			memory_free(
+			 ( *output_buffer )->buffer );
+		}
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the output buffer so that it can contain at least the required buffer size
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_resize(
+     output_buffer_t *output_buffer,
+     size_t required_buffer_size,
+     libcerror_error_t **error )
+{
+	system_character_t *reallocation = NULL;
+	static char *function            = "output_buffer_resize";
+	size_t buffer_size               = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_buffer_size > ( (size_t) SSIZE_MAX / sizeof( system_character_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_buffer_size <= output_buffer->buffer_size )
+	{
+		return( 1 );
+	}
+	buffer_size = output_buffer->buffer_size;
+
+	if( buffer_size == 0 )
+	{
+		buffer_size = OUTPUT_BUFFER_INITIAL_SIZE;
+	}
+	while( buffer_size < required_buffer_size )
+	{
+		if( buffer_size > ( (size_t) SSIZE_MAX / ( 2 * sizeof( system_character_t ) ) ) )
+		{
+			buffer_size = required_buffer_size;
+
+			break;
+		}
+		buffer_size *= 2;
+	}
+	reallocation = (system_character_t *) memory_reallocate(
+	                                       output_buffer->buffer,
+	                                       sizeof( system_character_t ) * buffer_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->buffer      = reallocation;
+	output_buffer->buffer_size = buffer_size;
+
+	return( 1 );
+}
+
+/* Retrieves a pointer to the end of the buffer data with room for at least append buffer size characters
+ * The data is not part of the buffer until output_buffer_commit is called
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_get_append_buffer(
+     output_buffer_t *output_buffer,
+     size_t append_buffer_size,
+     system_character_t **append_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_get_append_buffer";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( append_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid append buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( append_buffer_size > ( (size_t) SSIZE_MAX - output_buffer->buffer_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid append buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_resize(
+	     output_buffer,
+	     output_buffer->buffer_offset + append_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*append_buffer = &( output_buffer->buffer[ output_buffer->buffer_offset ] );
+
+	return( 1 );
+}
+
+/* Adds string length characters written to the append buffer to the buffer data
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_commit(
+     output_buffer_t *output_buffer,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_commit";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > ( output_buffer->buffer_size - output_buffer->buffer_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->buffer_offset += string_length;
+
+	return( 1 );
+}
+
+/* Adds the string written to the append buffer to the buffer data
+ * Only the characters before the first end-of-string character within
+ * string size are added, since a string can be shorter than its size
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_commit_string(
+     output_buffer_t *output_buffer,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	system_character_t *string = NULL;
+	static char *function      = "output_buffer_commit_string";
+	size_t string_length       = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > ( output_buffer->buffer_size - output_buffer->buffer_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	string = &( output_buffer->buffer[ output_buffer->buffer_offset ] );
+
+	while( ( string_length < string_size )
+	    && ( string[ string_length ] != 0 ) )
+	{
+		string_length++;
+	}
+	output_buffer->buffer_offset += string_length;
+
+	return( 1 );
+}
+
+/* Appends a string
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_string(
+     output_buffer_t *output_buffer,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	system_character_t *append_buffer = NULL;
+	static char *function             = "output_buffer_append_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length == 0 )
+	{
+		return( 1 );
+	}
+	if( output_buffer_get_append_buffer(
+	     output_buffer,
+	     string_length,
+	     &append_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve append buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     append_buffer,
+	     string,
+	     string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->buffer_offset += string_length;
+
+	return( 1 );
+}
+
+/* Appends a narrow string
+ * The string is expected to only contain ASCII characters
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_narrow_string(
+     output_buffer_t *output_buffer,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	system_character_t *append_buffer = NULL;
+	static char *function             = "output_buffer_append_narrow_string";
+	size_t string_index               = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_get_append_buffer(
+	     output_buffer,
+	     string_length,
+	     &append_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve append buffer.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		append_buffer[ string_index ] = (system_character_t) string[ string_index ];
+	}
+	output_buffer->buffer_offset += string_length;
+
+	return( 1 );
+}
+
+/* Appends a 64-bit value in decimal representation
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_decimal_64bit(
+     output_buffer_t *output_buffer,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	system_character_t *append_buffer = NULL;
+	static char *function             = "output_buffer_append_decimal_64bit";
+	size_t number_of_digits           = 1;
+	size_t string_index               = 0;
+	uint64_t divider                  = value_64bit;
+
+	while( divider >= 10 )
+	{
+		divider /= 10;
+
+		number_of_digits++;
+	}
+	if( output_buffer_get_append_buffer(
+	     output_buffer,
+	     number_of_digits,
+	     &append_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve append buffer.",
+		 function );
+
+		return( -1 );
+	}
+	string_index = number_of_digits;
+
+	do
+	{
+		string_index--;
+
+		append_buffer[ string_index ] = (system_character_t) ( (uint8_t) '0' + (uint8_t) ( value_64bit % 10 ) );
+
+		value_64bit /= 10;
+	}
+	while( string_index > 0 );
+
+	output_buffer->buffer_offset += number_of_digits;
+
+	return( 1 );
+}
+
+/* Appends a 32-bit value in hexadecimal representation
+ * The value is formatted as 0x%08x
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_hexadecimal_32bit(
+     output_buffer_t *output_buffer,
+     uint32_t value_32bit,
+     libcerror_error_t **error )
+{
+	system_character_t *append_buffer = NULL;
+	static char *function             = "output_buffer_append_hexadecimal_32bit";
+	size_t string_index               = 0;
+	uint8_t nibble                    = 0;
+
+	if( output_buffer_get_append_buffer(
+	     output_buffer,
+	     10,
+	     &append_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve append buffer.",
+		 function );
+
+		return( -1 );
+	}
+	append_buffer[ 0 ] = (system_character_t) '0';
+	append_buffer[ 1 ] = (system_character_t) 'x';
+
+	for( string_index = 9;
+	     string_index >= 2;
+	     string_index-- )
+	{
+		nibble = (uint8_t) ( value_32bit & 0x0000000fUL );
+
+		if( nibble < 10 )
+		{
+			append_buffer[ string_index ] = (system_character_t) ( (uint8_t) '0' + nibble );
+		}
+		else
+		{
+			append_buffer[ string_index ] = (system_character_t) ( (uint8_t) 'a' + nibble - 10 );
+		}
+		value_32bit >>= 4;
+	}
+	output_buffer->buffer_offset += 10;
+
+	return( 1 );
+}
+
+/* Copies a decimal value of a fixed number of digits with leading zeros to a string
+ */
+static void output_buffer_copy_digits(
+             system_character_t *string,
+             uint32_t value_32bit,
+             size_t number_of_digits )
+{
+	while( number_of_digits > 0 )
+	{
+		number_of_digits--;
+
+		string[ number_of_digits ] = (system_character_t) ( (uint8_t) '0' + (uint8_t) ( value_32bit % 10 ) );
+
+		value_32bit /= 10;
+	}
+}
+
+/* Appends a FILETIME value using the libfdatetime string representation
+ * Returns 1 if successful or -1 on error
+ */
+static int output_buffer_append_filetime_with_libfdatetime(
+            output_buffer_t *output_buffer,
+            uint64_t filetime,
+            libcerror_error_t **error )
+{
+	system_character_t filetime_string[ 48 ];
+
+	libfdatetime_filetime_t *fdatetime_filetime = NULL;
+	static char *function                       = "output_buffer_append_filetime_with_libfdatetime";
+	int result                                  = 0;
+
+	if( libfdatetime_filetime_initialize(
+	     &fdatetime_filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filetime.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdatetime_filetime_copy_from_64bit(
+	     fdatetime_filetime,
+	     filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy filetime from 64-bit.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfdatetime_filetime_copy_to_utf16_string(
+		  fdatetime_filetime,
+		  (uint16_t *) filetime_string,
+		  48,
+		  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+		  error );
+#else
+	result = libfdatetime_filetime_copy_to_utf8_string(
+		  fdatetime_filetime,
+		  (uint8_t *) filetime_string,
+		  48,
+		  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy filetime to string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdatetime_filetime_free(
+	     &fdatetime_filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free filetime.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_string(
+	     output_buffer,
+	     filetime_string,
+	     system_string_length(
+	      filetime_string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filetime string.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( fdatetime_filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &fdatetime_filetime,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a FILETIME value in the ctime representation with nano seconds
+ * The value is formatted as: Mon DD, YYYY hh:mm:ss.nnnnnnnnn
+ * The date and time without the fraction of second is cached since
+ * consecutive records often have a timestamp within the same second
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_filetime(
+     output_buffer_t *output_buffer,
+     uint64_t filetime,
+     libcerror_error_t **error )
+{
+	system_character_t *append_buffer = NULL;
+	const char *month_name            = NULL;
+	static char *function             = "output_buffer_append_filetime";
+	size_t string_index               = 0;
+	uint64_t number_of_days           = 0;
+	uint64_t number_of_seconds        = 0;
+	uint32_t day_of_era               = 0;
+	uint32_t day_of_month             = 0;
+	uint32_t day_of_year              = 0;
+	uint32_t era                      = 0;
+	uint32_t month                    = 0;
+	uint32_t month_of_year            = 0;
+	uint32_t seconds_of_day           = 0;
+	uint32_t year                     = 0;
+	uint32_t year_of_era              = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	/* A FILETIME of 0 is represented as not set by libfdatetime and must not
+	 * be served from the cached date and time of the first second of 1601
+	 */
+	if( filetime == 0 )
+	{
+		return( output_buffer_append_filetime_with_libfdatetime(
+		         output_buffer,
+		         filetime,
+		         error ) );
+	}
+	number_of_seconds = filetime / 10000000UL;
+
+	if( ( output_buffer->cached_filetime_string_length == 0 )
+	 || ( output_buffer->cached_filetime_seconds != number_of_seconds ) )
+	{
+		number_of_days = number_of_seconds / 86400;
+		seconds_of_day = (uint32_t) ( number_of_seconds % 86400 );
+
+		/* Determine the date relative to March 1, 0000, where 584694 is the number of days
+		 * from March 1, 0000 to January 1, 1601
+		 */
+		number_of_days += 584694;
+
+		era         = (uint32_t) ( number_of_days / 146097 );
+		day_of_era  = (uint32_t) ( number_of_days % 146097 );
+		year_of_era = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+		year        = year_of_era + ( era * 400 );
+		day_of_year = day_of_era - ( ( 365 * year_of_era ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+		month       = ( ( 5 * day_of_year ) + 2 ) / 153;
+
+		day_of_month = day_of_year - ( ( ( 153 * month ) + 2 ) / 5 ) + 1;
+
+		if( month < 10 )
+		{
+			month_of_year = month + 3;
+		}
+		else
+		{
+			month_of_year = month - 9;
+		}
+		if( month_of_year <= 2 )
+		{
+			year += 1;
+		}
+		/* Leave unusual values to libfdatetime
+		 */
+		if( year > 9999 )
+		{
+			return( output_buffer_append_filetime_with_libfdatetime(
+			         output_buffer,
+			         filetime,
+			         error ) );
+		}
+		month_name = output_buffer_month_names[ month_of_year - 1 ];
+
+		output_buffer->cached_filetime_string[ 0 ]  = (system_character_t) month_name[ 0 ];
+		output_buffer->cached_filetime_string[ 1 ]  = (system_character_t) month_name[ 1 ];
+		output_buffer->cached_filetime_string[ 2 ]  = (system_character_t) month_name[ 2 ];
+		output_buffer->cached_filetime_string[ 3 ]  = (system_character_t) ' ';
+
+		output_buffer_copy_digits(
+		 &( output_buffer->cached_filetime_string[ 4 ] ),
+		 day_of_month,
+		 2 );
+
+		output_buffer->cached_filetime_string[ 6 ]  = (system_character_t) ',';
+		output_buffer->cached_filetime_string[ 7 ]  = (system_character_t) ' ';
+
+		output_buffer_copy_digits(
+		 &( output_buffer->cached_filetime_string[ 8 ] ),
+		 year,
+		 4 );
+
+		output_buffer->cached_filetime_string[ 12 ] = (system_character_t) ' ';
+
+		output_buffer_copy_digits(
+		 &( output_buffer->cached_filetime_string[ 13 ] ),
+		 seconds_of_day / 3600,
+		 2 );
+
+		output_buffer->cached_filetime_string[ 15 ] = (system_character_t) ':';
+
+		output_buffer_copy_digits(
+		 &( output_buffer->cached_filetime_string[ 16 ] ),
+		 ( seconds_of_day / 60 ) % 60,
+		 2 );
+
+		output_buffer->cached_filetime_string[ 18 ] = (system_character_t) ':';
+
+		output_buffer_copy_digits(
+		 &( output_buffer->cached_filetime_string[ 19 ] ),
+		 seconds_of_day % 60,
+		 2 );
+
+		output_buffer->cached_filetime_seconds       = number_of_seconds;
+		output_buffer->cached_filetime_string_length = 21;
+	}
+	if( output_buffer_get_append_buffer(
+	     output_buffer,
+	     output_buffer->cached_filetime_string_length + 10,
+	     &append_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve append buffer.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < output_buffer->cached_filetime_string_length;
+	     string_index++ )
+	{
+		append_buffer[ string_index ] = output_buffer->cached_filetime_string[ string_index ];
+	}
+	append_buffer[ string_index++ ] = (system_character_t) '.';
+
+	output_buffer_copy_digits(
+	 &( append_buffer[ string_index ] ),
+	 (uint32_t) ( filetime % 10000000UL ) * 100,
+	 9 );
+
+	output_buffer->buffer_offset += string_index + 9;
+
+	return( 1 );
+}
+
+/* Writes the buffer data to the stream and empties the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_flush(
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_flush";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t buffer_index   = 0;
+	int print_count       = 0;
+#endif
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->buffer_offset == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* Wide character output is converted by the stream. Since the conversion
+	 * stops at an end-of-string character the buffer data is written in
+	 * segments and embedded end-of-string characters are written separately
+	 */
+	if( output_buffer_resize(
+	     output_buffer,
+	     output_buffer->buffer_offset + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->buffer[ output_buffer->buffer_offset ] = 0;
+
+	while( buffer_index < output_buffer->buffer_offset )
+	{
+		if( output_buffer->buffer[ buffer_index ] == 0 )
+		{
+			print_count = fputc(
+			               0,
+			               output_buffer->stream );
+
+			buffer_index += 1;
+		}
+		else
+		{
+			print_count = fprintf(
+			               output_buffer->stream,
+			               "%" PRIs_SYSTEM "",
+			               &( output_buffer->buffer[ buffer_index ] ) );
+
+			buffer_index += system_string_length(
+			                 &( output_buffer->buffer[ buffer_index ] ) );
+		}
+		if( print_count < 0 )
+		{
+			break;
+		}
+	}
+	if( buffer_index < output_buffer->buffer_offset )
+#else
+	if( fwrite(
+	     output_buffer->buffer,
+	     sizeof( system_character_t ),
+	     output_buffer->buffer_offset,
+	     output_buffer->stream ) != output_buffer->buffer_offset )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer to stream.",
+		 function );
+
+		output_buffer->buffer_offset = 0;
+
+		return( -1 );
+	}
+	output_buffer->buffer_offset = 0;
+
+	return( 1 );
+}
+
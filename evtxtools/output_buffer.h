@@ -0,0 +1,138 @@
+/*
+ * Output buffer
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _OUTPUT_BUFFER_H )
+#define _OUTPUT_BUFFER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the output buffer after which the output should be flushed
+ */
+#define OUTPUT_BUFFER_FLUSH_SIZE		( 64 * 1024 )
+
+typedef struct output_buffer output_buffer_t;
+
+struct output_buffer
+{
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* The buffer
+	 */
+	system_character_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The buffer offset
+	 */
+	size_t buffer_offset;
+
+	/* The number of seconds of the cached FILETIME string
+	 */
+	uint64_t cached_filetime_seconds;
+
+	/* The cached FILETIME string without the fraction of second
+	 */
+	system_character_t cached_filetime_string[ 32 ];
+
+	/* The cached FILETIME string length, where 0 represents no cached string
+	 */
+	size_t cached_filetime_string_length;
+};
+
+int output_buffer_initialize(
+     output_buffer_t **output_buffer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int output_buffer_free(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error );
+
+int output_buffer_resize(
+     output_buffer_t *output_buffer,
+     size_t required_buffer_size,
+     libcerror_error_t **error );
+
+int output_buffer_get_append_buffer(
+     output_buffer_t *output_buffer,
+     size_t append_buffer_size,
+     system_character_t **append_buffer,
+     libcerror_error_t **error );
+
+int output_buffer_commit(
+     output_buffer_t *output_buffer,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int output_buffer_commit_string(
+     output_buffer_t *output_buffer,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int output_buffer_append_string(
+     output_buffer_t *output_buffer,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int output_buffer_append_narrow_string(
+     output_buffer_t *output_buffer,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int output_buffer_append_decimal_64bit(
+     output_buffer_t *output_buffer,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+int output_buffer_append_hexadecimal_32bit(
+     output_buffer_t *output_buffer,
+     uint32_t value_32bit,
+     libcerror_error_t **error );
+
+int output_buffer_append_filetime(
+     output_buffer_t *output_buffer,
+     uint64_t filetime,
+     libcerror_error_t **error );
+
+int output_buffer_flush(
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _OUTPUT_BUFFER_H ) */
+
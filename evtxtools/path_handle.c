@@ -26,6 +26,12 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && defined( HAVE_WCTYPE_H )
+#include <wctype.h>
+#else
+#include <ctype.h>
+#endif
+
 #include "evtxtools_libcdirectory.h"
 #include "evtxtools_libcerror.h"
 #include "path_handle.h"
@@ -126,6 +132,19 @@ int path_handle_free(
 	}
 	if( *path_handle != NULL )
 	{
+		if( path_handle_empty_directory_cache(
+		     *path_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty directory cache.",
+			 function );
+
+			result = -1;
+		}
 		if( ( *path_handle )->system_root_path != NULL )
 		{
 			memory_free(
@@ -139,255 +158,620 @@ int path_handle_free(
 	return( result );
 }
 
-/* Retrieves the name of a directory entry by name ignoring case
- * If a corresponding entry is found entry name is update
- * This function is needed to find case insensitive directory entries on a case sensitive system
- * Return 1 if successful, 0 if no corresponding entry was found or -1 on error
+/* Calculates the hash of a name
+ * The hash is a 32-bit FNV-1a over the case folded characters
+ * The characters are folded with tolower or towlower, like the caseless
+ * string compare, so that names that compare equal have the same hash
+ * Returns the hash
  */
-int path_handle_get_directory_entry_name_by_name_no_case(
-     path_handle_t *path_handle,
+uint32_t path_handle_calculate_name_hash(
+          const system_character_t *name,
+          size_t name_length )
+{
+	size_t name_index    = 0;
+	uint32_t hash        = 0x811c9dc5UL;
+	uint32_t value_32bit = 0;
+
+	if( name == NULL )
+	{
+		return( hash );
+	}
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		value_32bit = (uint32_t) towlower(
+		                          (wint_t) name[ name_index ] );
+#else
+		value_32bit = (uint32_t) (uint8_t) tolower(
+		                                    (int) (uint8_t) name[ name_index ] );
+#endif
+		hash ^= value_32bit;
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Creates a directory
+ * Make sure the value directory is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int path_handle_directory_initialize(
+     path_handle_directory_t **directory,
      const system_character_t *path,
      size_t path_length,
-     system_character_t *entry_name,
-     size_t entry_name_size,
-     uint8_t entry_type,
      libcerror_error_t **error )
 {
-	libcdirectory_directory_t *directory             = NULL;
-	libcdirectory_directory_entry_t *directory_entry = NULL;
-	system_character_t *directory_entry_name         = NULL;
-	static char *function                            = "path_handle_get_directory_entry_name_by_name_no_case";
-	size_t directory_entry_name_length               = 0;
-	int result                                       = 0;
+	static char *function = "path_handle_directory_initialize";
 
-	if( path_handle == NULL )
+	if( directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path handle.",
+		 "%s: invalid directory.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_length > (size_t) SSIZE_MAX )
+	if( *directory != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( entry_name == NULL )
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid entry name.",
+		 "%s: invalid path.",
 		 function );
 
 		return( -1 );
 	}
-	if( entry_name_size > (size_t) SSIZE_MAX )
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid entry name size value exceeds maximum.",
+		 "%s: invalid path length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( entry_name == NULL )
+	*directory = memory_allocate_structure(
+	              path_handle_directory_t );
+
+	if( *directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid entry name.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdirectory_directory_initialize(
-	     &directory,
-	     error ) != 1 )
+	if( memory_set(
+	     *directory,
+	     0,
+	     sizeof( path_handle_directory_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create directory.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory.",
 		 function );
 
-		goto on_error;
+		memory_free(
+		 *directory );
+
+		*directory = NULL;
+
+		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcdirectory_directory_open_wide(
-		  directory,
-		  path,
-		  error );
-#else
-	result = libcdirectory_directory_open(
-		  directory,
-		  path,
-		  error );
-#endif
-	if( result != 1 )
+	( *directory )->path = system_string_allocate(
+	                        path_length + 1 );
+
+	if( ( *directory )->path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
-		 function,
-		 path );
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
 
 		goto on_error;
 	}
-	if( libcdirectory_directory_entry_initialize(
-	     &directory_entry,
-	     error ) != 1 )
+	if( system_string_copy(
+	     ( *directory )->path,
+	     path,
+	     path_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcdirectory_directory_has_entry_wide(
-		  directory,
-		  directory_entry,
-		  entry_name,
-		  entry_name_size - 1,
-		  entry_type,
-		  LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
-		  error );
-#else
-	result = libcdirectory_directory_has_entry(
-		  directory,
-		  directory_entry,
-		  entry_name,
-		  entry_name_size - 1,
-		  entry_type,
-		  LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
-		  error );
-#endif
-	if( result == -1 )
+	( *directory )->path[ path_length ] = 0;
+
+	( *directory )->path_length = path_length;
+	( *directory )->hash        = path_handle_calculate_name_hash(
+	                               path,
+	                               path_length );
+
+	return( 1 );
+
+on_error:
+	if( *directory != NULL )
+	{
+		path_handle_directory_free(
+		 directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a directory
+ * Returns 1 if successful or -1 on error
+ */
+int path_handle_directory_free(
+     path_handle_directory_t **directory,
+     libcerror_error_t **error )
+{
+	static char *function = "path_handle_directory_free";
+	int entry_index       = 0;
+
+	if( directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
-		 function,
-		 entry_name );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
+	if( *directory != NULL )
 	{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcdirectory_directory_entry_get_name_wide(
-			  directory_entry,
-			  (wchar_t **) &directory_entry_name,
-			  error );
-#else
-		result = libcdirectory_directory_entry_get_name(
-			  directory_entry,
-			  (char **) &directory_entry_name,
-			  error );
-#endif
-		if( result != 1 )
+		if( ( *directory )->entries != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry name.",
-			 function );
-
-			goto on_error;
+			for( entry_index = 0;
+			     entry_index < ( *directory )->number_of_entries;
+			     entry_index++ )
+			{
+				if( ( *directory )->entries[ entry_index ].name != NULL )
+				{
+					memory_free(
+					 ( *directory )->entries[ entry_index ].name );
+				}
+			}
+			memory_free(
+			 ( *directory )->entries );
 		}
-		directory_entry_name_length = system_string_length(
-					       directory_entry_name );
+		if( ( *directory )->buckets != NULL )
+		{
+			memory_free(
+			 ( *directory )->buckets );
+		}
+		if( ( *directory )->path != NULL )
+		{
+			memory_free(
+			 ( *directory )->path );
+		}
+		memory_free(
+		 *directory );
+
+		*directory = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an entry to a directory
+ * Returns 1 if successful or -1 on error
+ */
+int path_handle_directory_append_entry(
+     path_handle_directory_t *directory,
+     const system_character_t *name,
+     size_t name_length,
+     uint8_t type,
+     libcerror_error_t **error )
+{
+	path_handle_directory_entry_t *directory_entry = NULL;
+	void *reallocation                             = NULL;
+	static char *function                          = "path_handle_directory_append_entry";
+	int number_of_entries                          = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
 
-		if( ( directory_entry_name_length + 1 ) != entry_name_size )
+		return( -1 );
+	}
+	if( directory->number_of_entries >= directory->number_of_allocated_entries )
+	{
+		if( directory->number_of_allocated_entries == 0 )
+		{
+			number_of_entries = 256;
+		}
+		else
+		{
+			number_of_entries = directory->number_of_allocated_entries * 2;
+		}
+		if( ( number_of_entries < directory->number_of_allocated_entries )
+		 || ( (size_t) number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( path_handle_directory_entry_t ) ) ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: entry name length value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( system_string_copy(
-		     entry_name,
-		     directory_entry_name,
-		     directory_entry_name_length ) == NULL )
+		reallocation = memory_reallocate(
+		                directory->entries,
+		                sizeof( path_handle_directory_entry_t ) * number_of_entries );
+
+		if( reallocation == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set entry name.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
+		directory->entries                     = (path_handle_directory_entry_t *) reallocation;
+		directory->number_of_allocated_entries = number_of_entries;
 	}
-	if( libcdirectory_directory_entry_free(
-	     &directory_entry,
-	     error ) != 1 )
+	directory_entry = &( directory->entries[ directory->number_of_entries ] );
+
+	directory_entry->name = system_string_allocate(
+	                         name_length + 1 );
+
+	if( directory_entry->name == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdirectory_directory_close(
-	     directory,
-	     error ) != 0 )
+	if( system_string_copy(
+	     directory_entry->name,
+	     name,
+	     name_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close directory.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
 		 function );
 
-		goto on_error;
+		memory_free(
+		 directory_entry->name );
+
+		directory_entry->name = NULL;
+
+		return( -1 );
 	}
-	if( libcdirectory_directory_free(
-	     &directory,
-	     error ) != 1 )
+	directory_entry->name[ name_length ] = 0;
+
+	directory_entry->name_length      = name_length;
+	directory_entry->type             = type;
+	directory_entry->next_entry_index = -1;
+	directory_entry->hash             = path_handle_calculate_name_hash(
+	                                     name,
+	                                     name_length );
+
+	directory->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Reads the entries of a directory
+ * The entries are indexed by the hash of their case folded name
+ * Returns 1 if successful or -1 on error
+ */
+int path_handle_directory_read(
+     path_handle_directory_t *directory,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_t *cdirectory            = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	system_character_t *directory_entry_name         = NULL;
+	static char *function                            = "path_handle_directory_read";
+	size_t directory_entry_name_length               = 0;
+	uint8_t directory_entry_type                     = 0;
+	int bucket_index                                 = 0;
+	int entry_index                                  = 0;
+	int number_of_buckets                            = 0;
+	int result                                       = 0;
+
+	if( directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free directory.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( result );
+	if( directory->buckets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory - buckets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_directory_initialize(
+	     &cdirectory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcdirectory_directory_open_wide(
+		  cdirectory,
+		  directory->path,
+		  error );
+#else
+	result = libcdirectory_directory_open(
+		  cdirectory,
+		  directory->path,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 directory->path );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		result = libcdirectory_directory_read_entry(
+		          cdirectory,
+		          directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_type(
+		     directory_entry,
+		     &directory_entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry type.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcdirectory_directory_entry_get_name_wide(
+			  directory_entry,
+			  (wchar_t **) &directory_entry_name,
+			  error );
+#else
+		result = libcdirectory_directory_entry_get_name(
+			  directory_entry,
+			  (char **) &directory_entry_name,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			goto on_error;
+		}
+		directory_entry_name_length = system_string_length(
+		                               directory_entry_name );
+
+		if( path_handle_directory_append_entry(
+		     directory,
+		     directory_entry_name,
+		     directory_entry_name_length,
+		     directory_entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory entry: %" PRIs_SYSTEM ".",
+			 function,
+			 directory_entry_name );
+
+			goto on_error;
+		}
+	}
+	while( result == 1 );
+
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_close(
+	     cdirectory,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_free(
+	     &cdirectory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
+		 function );
+
+		goto on_error;
+	}
+	/* Use a power of 2 number of buckets of at least twice the number of entries
+	 */
+	number_of_buckets = 16;
+
+	while( number_of_buckets < ( directory->number_of_entries * 2 ) )
+	{
+		number_of_buckets *= 2;
+	}
+	directory->buckets = (int *) memory_allocate(
+	                              sizeof( int ) * number_of_buckets );
+
+	if( directory->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	directory->number_of_buckets = number_of_buckets;
+
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		directory->buckets[ bucket_index ] = -1;
+	}
+	for( entry_index = 0;
+	     entry_index < directory->number_of_entries;
+	     entry_index++ )
+	{
+		bucket_index = (int) ( directory->entries[ entry_index ].hash & (uint32_t) ( number_of_buckets - 1 ) );
+
+		directory->entries[ entry_index ].next_entry_index = directory->buckets[ bucket_index ];
+		directory->buckets[ bucket_index ]                 = entry_index;
+	}
+	return( 1 );
 
 on_error:
 	if( directory_entry != NULL )
@@ -396,12 +780,411 @@ on_error:
 		 &directory_entry,
 		 NULL );
 	}
-	if( directory != NULL )
+	if( cdirectory != NULL )
 	{
 		libcdirectory_directory_free(
-		 &directory,
+		 &cdirectory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific entry of a directory by name ignoring case
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int path_handle_directory_get_entry_by_name_no_case(
+     path_handle_directory_t *directory,
+     const system_character_t *name,
+     size_t name_length,
+     uint8_t type,
+     path_handle_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	path_handle_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                               = "path_handle_directory_get_entry_by_name_no_case";
+	uint32_t hash                                       = 0;
+	int entry_index                                     = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory - missing buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	hash = path_handle_calculate_name_hash(
+	        name,
+	        name_length );
+
+	entry_index = directory->buckets[ hash & (uint32_t) ( directory->number_of_buckets - 1 ) ];
+
+	while( entry_index != -1 )
+	{
+		safe_directory_entry = &( directory->entries[ entry_index ] );
+
+		if( ( safe_directory_entry->hash == hash )
+		 && ( safe_directory_entry->type == type )
+		 && ( safe_directory_entry->name_length == name_length )
+		 && ( system_string_compare_no_case(
+		       safe_directory_entry->name,
+		       name,
+		       name_length ) == 0 ) )
+		{
+			*directory_entry = safe_directory_entry;
+
+			return( 1 );
+		}
+		entry_index = safe_directory_entry->next_entry_index;
+	}
+	return( 0 );
+}
+
+/* Empties the directory cache
+ * Returns 1 if successful or -1 on error
+ */
+int path_handle_empty_directory_cache(
+     path_handle_t *path_handle,
+     libcerror_error_t **error )
+{
+	path_handle_directory_t *directory = NULL;
+	static char *function              = "path_handle_empty_directory_cache";
+	int bucket_index                   = 0;
+	int result                         = 1;
+
+	if( path_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < PATH_HANDLE_NUMBER_OF_DIRECTORY_BUCKETS;
+	     bucket_index++ )
+	{
+		while( path_handle->directories[ bucket_index ] != NULL )
+		{
+			directory = path_handle->directories[ bucket_index ];
+
+			path_handle->directories[ bucket_index ] = directory->next_directory;
+
+			if( path_handle_directory_free(
+			     &directory,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	return( result );
+}
+
+/* Retrieves a specific directory
+ * The directory is read on first use and retained in the directory cache
+ * Returns 1 if successful or -1 on error
+ */
+int path_handle_get_directory(
+     path_handle_t *path_handle,
+     const system_character_t *path,
+     size_t path_length,
+     path_handle_directory_t **directory,
+     libcerror_error_t **error )
+{
+	path_handle_directory_t *safe_directory = NULL;
+	static char *function                   = "path_handle_get_directory";
+	uint32_t hash                           = 0;
+	int bucket_index                        = 0;
+
+	if( path_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	hash = path_handle_calculate_name_hash(
+	        path,
+	        path_length );
+
+	bucket_index = (int) ( hash % PATH_HANDLE_NUMBER_OF_DIRECTORY_BUCKETS );
+
+	/* The path is compared case sensitive since the directory is read
+	 * from a case sensitive file system
+	 */
+	safe_directory = path_handle->directories[ bucket_index ];
+
+	while( safe_directory != NULL )
+	{
+		if( ( safe_directory->hash == hash )
+		 && ( safe_directory->path_length == path_length )
+		 && ( system_string_compare(
+		       safe_directory->path,
+		       path,
+		       path_length ) == 0 ) )
+		{
+			*directory = safe_directory;
+
+			return( 1 );
+		}
+		safe_directory = safe_directory->next_directory;
+	}
+	if( path_handle_directory_initialize(
+	     &safe_directory,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( path_handle_directory_read(
+	     safe_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory: %" PRIs_SYSTEM ".",
+		 function,
+		 safe_directory->path );
+
+		goto on_error;
+	}
+	safe_directory->next_directory           = path_handle->directories[ bucket_index ];
+	path_handle->directories[ bucket_index ] = safe_directory;
+
+	*directory = safe_directory;
+
+	return( 1 );
+
+on_error:
+	if( safe_directory != NULL )
+	{
+		path_handle_directory_free(
+		 &safe_directory,
 		 NULL );
 	}
 	return( -1 );
 }
 
+/* Retrieves the name of a directory entry by name ignoring case
+ * If a corresponding entry is found entry name is update
+ * This function is needed to find case insensitive directory entries on a case sensitive system
+ * The directory listing is read once and cached in the path handle
+ * Return 1 if successful, 0 if no corresponding entry was found or -1 on error
+ */
+int path_handle_get_directory_entry_name_by_name_no_case(
+     path_handle_t *path_handle,
+     const system_character_t *path,
+     size_t path_length,
+     system_character_t *entry_name,
+     size_t entry_name_size,
+     uint8_t entry_type,
+     libcerror_error_t **error )
+{
+	path_handle_directory_t *directory             = NULL;
+	path_handle_directory_entry_t *directory_entry = NULL;
+	static char *function                          = "path_handle_get_directory_entry_name_by_name_no_case";
+	int result                                     = 0;
+
+	if( path_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_name_size == 0 )
+	 || ( entry_name_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Some callers pass the path length including the end-of-string character
+	 */
+	if( ( path_length > 0 )
+	 && ( path[ path_length - 1 ] == 0 ) )
+	{
+		path_length -= 1;
+	}
+	if( path_handle_get_directory(
+	     path_handle,
+	     path,
+	     path_length,
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	result = path_handle_directory_get_entry_by_name_no_case(
+	          directory,
+	          entry_name,
+	          entry_name_size - 1,
+	          entry_type,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
+		 function,
+		 entry_name );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( system_string_copy(
+		     entry_name,
+		     directory_entry->name,
+		     directory_entry->name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set entry name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
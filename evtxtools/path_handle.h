@@ -31,6 +31,74 @@
 extern "C" {
 #endif
 
+#define PATH_HANDLE_NUMBER_OF_DIRECTORY_BUCKETS		64
+
+typedef struct path_handle_directory_entry path_handle_directory_entry_t;
+
+struct path_handle_directory_entry
+{
+	/* The hash of the case folded name
+	 */
+	uint32_t hash;
+
+	/* The name
+	 */
+	system_character_t *name;
+
+	/* The name length
+	 */
+	size_t name_length;
+
+	/* The entry type
+	 */
+	uint8_t type;
+
+	/* The index of the next entry in the same bucket, where -1 represents none
+	 */
+	int next_entry_index;
+};
+
+typedef struct path_handle_directory path_handle_directory_t;
+
+struct path_handle_directory
+{
+	/* The hash of the case folded path
+	 */
+	uint32_t hash;
+
+	/* The path
+	 */
+	system_character_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The entries
+	 */
+	path_handle_directory_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The index of the first entry per bucket, where -1 represents none
+	 */
+	int *buckets;
+
+	/* The number of buckets
+	 */
+	int number_of_buckets;
+
+	/* The next directory in the same bucket
+	 */
+	path_handle_directory_t *next_directory;
+};
+
 typedef struct path_handle path_handle_t;
 
 struct path_handle
@@ -42,8 +110,45 @@ struct path_handle
 	/* The %SystemRoot% path size
 	 */
 	size_t system_root_path_size;
+
+	/* The cached directories
+	 */
+	path_handle_directory_t *directories[ PATH_HANDLE_NUMBER_OF_DIRECTORY_BUCKETS ];
 };
 
+uint32_t path_handle_calculate_name_hash(
+          const system_character_t *name,
+          size_t name_length );
+
+int path_handle_directory_initialize(
+     path_handle_directory_t **directory,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int path_handle_directory_free(
+     path_handle_directory_t **directory,
+     libcerror_error_t **error );
+
+int path_handle_directory_append_entry(
+     path_handle_directory_t *directory,
+     const system_character_t *name,
+     size_t name_length,
+     uint8_t type,
+     libcerror_error_t **error );
+
+int path_handle_directory_read(
+     path_handle_directory_t *directory,
+     libcerror_error_t **error );
+
+int path_handle_directory_get_entry_by_name_no_case(
+     path_handle_directory_t *directory,
+     const system_character_t *name,
+     size_t name_length,
+     uint8_t type,
+     path_handle_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
 int path_handle_initialize(
      path_handle_t **path_handle,
      libcerror_error_t **error );
@@ -52,6 +157,17 @@ int path_handle_free(
      path_handle_t **path_handle,
      libcerror_error_t **error );
 
+int path_handle_empty_directory_cache(
+     path_handle_t *path_handle,
+     libcerror_error_t **error );
+
+int path_handle_get_directory(
+     path_handle_t *path_handle,
+     const system_character_t *path,
+     size_t path_length,
+     path_handle_directory_t **directory,
+     libcerror_error_t **error );
+
 int path_handle_get_directory_entry_name_by_name_no_case(
      path_handle_t *path_handle,
      const system_character_t *path,
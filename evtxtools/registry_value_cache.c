@@ -0,0 +1,704 @@
+/*
+ * Registry value cache
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && defined( HAVE_WCTYPE_H )
+#include <wctype.h>
+#endif
+
+#include <ctype.h>
+
+#include "evtxtools_libcerror.h"
+#include "registry_value_cache.h"
+
+/* Calculates the hash of the registry value cache key values
+ * The hash is a 32-bit FNV-1a over the case folded characters, since
+ * Windows Registry key and value names are case insensitive
+ * The characters are folded with tolower or towlower, like the caseless
+ * string compare, so that names that compare equal have the same hash
+ * Returns the hash
+ */
+uint32_t registry_value_cache_calculate_hash(
+          uint8_t key_type,
+          const char *parent_key_name,
+          size_t parent_key_name_length,
+          const system_character_t *key_name,
+          size_t key_name_length,
+          const system_character_t *value_name,
+          size_t value_name_length )
+{
+	size_t string_index  = 0;
+	uint32_t hash        = 0x811c9dc5UL;
+	uint32_t value_32bit = 0;
+
+	hash ^= key_type;
+	hash *= 0x01000193UL;
+
+	if( parent_key_name != NULL )
+	{
+		for( string_index = 0;
+		     string_index < parent_key_name_length;
+		     string_index++ )
+		{
+			value_32bit = (uint32_t) (uint8_t) tolower(
+			                                    (int) (uint8_t) parent_key_name[ string_index ] );
+			hash ^= value_32bit;
+			hash *= 0x01000193UL;
+		}
+	}
+	hash ^= (uint32_t) '\\';
+	hash *= 0x01000193UL;
+
+	if( key_name != NULL )
+	{
+		for( string_index = 0;
+		     string_index < key_name_length;
+		     string_index++ )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			value_32bit = (uint32_t) towlower(
+			                          (wint_t) key_name[ string_index ] );
+#else
+			value_32bit = (uint32_t) (uint8_t) tolower(
+			                                    (int) (uint8_t) key_name[ string_index ] );
+#endif
+			hash ^= value_32bit;
+			hash *= 0x01000193UL;
+		}
+	}
+	hash ^= (uint32_t) '\\';
+	hash *= 0x01000193UL;
+
+	if( value_name != NULL )
+	{
+		for( string_index = 0;
+		     string_index < value_name_length;
+		     string_index++ )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			value_32bit = (uint32_t) towlower(
+			                          (wint_t) value_name[ string_index ] );
+#else
+			value_32bit = (uint32_t) (uint8_t) tolower(
+			                                    (int) (uint8_t) value_name[ string_index ] );
+#endif
+			hash ^= value_32bit;
+			hash *= 0x01000193UL;
+		}
+	}
+	return( hash );
+}
+
+/* Frees a registry value cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int registry_value_cache_entry_free(
+     registry_value_cache_entry_t **registry_value_cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "registry_value_cache_entry_free";
+
+	if( registry_value_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry value cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *registry_value_cache_entry != NULL )
+	{
+		if( ( *registry_value_cache_entry )->value_string != NULL )
+		{
+			memory_free(
+			 ( *registry_value_cache_entry )->value_string );
+		}
+		if( ( *registry_value_cache_entry )->value_name != NULL )
+		{
+			memory_free(
+			 ( *registry_value_cache_entry )->value_name );
+		}
+		if( ( *registry_value_cache_entry )->key_name != NULL )
+		{
+			memory_free(
+			 ( *registry_value_cache_entry )->key_name );
+		}
+		if( ( *registry_value_cache_entry )->parent_key_name != NULL )
+		{
+			memory_free(
+			 ( *registry_value_cache_entry )->parent_key_name );
+		}
+		memory_free(
+		 *registry_value_cache_entry );
+
+		*registry_value_cache_entry = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates a registry value cache
+ * Make sure the value registry_value_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int registry_value_cache_initialize(
+     registry_value_cache_t **registry_value_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "registry_value_cache_initialize";
+
+	if( registry_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *registry_value_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid registry value cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*registry_value_cache = memory_allocate_structure(
+	                         registry_value_cache_t );
+
+	if( *registry_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create registry value cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *registry_value_cache,
+	     0,
+	     sizeof( registry_value_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear registry value cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *registry_value_cache != NULL )
+	{
+		memory_free(
+		 *registry_value_cache );
+
+		*registry_value_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a registry value cache
+ * Returns 1 if successful or -1 on error
+ */
+int registry_value_cache_free(
+     registry_value_cache_t **registry_value_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "registry_value_cache_free";
+	int result            = 1;
+
+	if( registry_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *registry_value_cache != NULL )
+	{
+		if( registry_value_cache_empty(
+		     *registry_value_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty registry value cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *registry_value_cache );
+
+		*registry_value_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a registry value cache
+ * Returns 1 if successful or -1 on error
+ */
+int registry_value_cache_empty(
+     registry_value_cache_t *registry_value_cache,
+     libcerror_error_t **error )
+{
+	registry_value_cache_entry_t *registry_value_cache_entry = NULL;
+	static char *function                                    = "registry_value_cache_empty";
+	int bucket_index                                         = 0;
+	int result                                               = 1;
+
+	if( registry_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry value cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < REGISTRY_VALUE_CACHE_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		while( registry_value_cache->buckets[ bucket_index ] != NULL )
+		{
+			registry_value_cache_entry = registry_value_cache->buckets[ bucket_index ];
+
+			registry_value_cache->buckets[ bucket_index ] = registry_value_cache_entry->next_entry;
+
+			if( registry_value_cache_entry_free(
+			     &registry_value_cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free registry value cache entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	registry_value_cache->number_of_entries = 0;
+
+	return( result );
+}
+
+/* Retrieves a specific registry value cache entry
+ * The names are compared case insensitive
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int registry_value_cache_get_entry(
+     registry_value_cache_t *registry_value_cache,
+     uint8_t key_type,
+     const char *parent_key_name,
+     size_t parent_key_name_length,
+     const system_character_t *key_name,
+     size_t key_name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     registry_value_cache_entry_t **registry_value_cache_entry,
+     libcerror_error_t **error )
+{
+	registry_value_cache_entry_t *safe_registry_value_cache_entry = NULL;
+	static char *function                                         = "registry_value_cache_get_entry";
+	uint32_t hash                                                 = 0;
+
+	if( registry_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key name.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value name.",
+		 function );
+
+		return( -1 );
+	}
+	if( registry_value_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry value cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	hash = registry_value_cache_calculate_hash(
+	        key_type,
+	        parent_key_name,
+	        parent_key_name_length,
+	        key_name,
+	        key_name_length,
+	        value_name,
+	        value_name_length );
+
+	safe_registry_value_cache_entry = registry_value_cache->buckets[ hash % REGISTRY_VALUE_CACHE_NUMBER_OF_BUCKETS ];
+
+	while( safe_registry_value_cache_entry != NULL )
+	{
+		if( ( safe_registry_value_cache_entry->hash == hash )
+		 && ( safe_registry_value_cache_entry->key_type == key_type )
+		 && ( safe_registry_value_cache_entry->key_name_length == key_name_length )
+		 && ( safe_registry_value_cache_entry->value_name_length == value_name_length )
+		 && ( system_string_compare_no_case(
+		       safe_registry_value_cache_entry->key_name,
+		       key_name,
+		       key_name_length ) == 0 )
+		 && ( system_string_compare_no_case(
+		       safe_registry_value_cache_entry->value_name,
+		       value_name,
+		       value_name_length ) == 0 ) )
+		{
+			if( ( ( parent_key_name == NULL )
+			   && ( safe_registry_value_cache_entry->parent_key_name == NULL ) )
+			 || ( ( parent_key_name != NULL )
+			   && ( safe_registry_value_cache_entry->parent_key_name != NULL )
+			   && ( safe_registry_value_cache_entry->parent_key_name_length == parent_key_name_length )
+			   && ( narrow_string_compare_no_case(
+			         safe_registry_value_cache_entry->parent_key_name,
+			         parent_key_name,
+			         parent_key_name_length ) == 0 ) ) )
+			{
+				*registry_value_cache_entry = safe_registry_value_cache_entry;
+
+				return( 1 );
+			}
+		}
+		safe_registry_value_cache_entry = safe_registry_value_cache_entry->next_entry;
+	}
+	return( 0 );
+}
+
+/* Inserts a value into the registry value cache
+ * A value string of NULL records that the value is not available
+ * Returns 1 if successful or -1 on error
+ */
+int registry_value_cache_insert_value(
+     registry_value_cache_t *registry_value_cache,
+     uint8_t key_type,
+     const char *parent_key_name,
+     size_t parent_key_name_length,
+     const system_character_t *key_name,
+     size_t key_name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const system_character_t *value_string,
+     size_t value_string_size,
+     libcerror_error_t **error )
+{
+	registry_value_cache_entry_t *registry_value_cache_entry = NULL;
+	static char *function                                    = "registry_value_cache_insert_value";
+	int bucket_index                                         = 0;
+
+	if( registry_value_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry value cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key name.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_string != NULL )
+	 && ( ( value_string_size == 0 )
+	  || ( value_string_size > (size_t) SSIZE_MAX ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	registry_value_cache_entry = memory_allocate_structure(
+	                              registry_value_cache_entry_t );
+
+	if( registry_value_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create registry value cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     registry_value_cache_entry,
+	     0,
+	     sizeof( registry_value_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear registry value cache entry.",
+		 function );
+
+		memory_free(
+		 registry_value_cache_entry );
+
+		return( -1 );
+	}
+	if( parent_key_name != NULL )
+	{
+		registry_value_cache_entry->parent_key_name = narrow_string_allocate(
+		                                               parent_key_name_length + 1 );
+
+		if( registry_value_cache_entry->parent_key_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create parent key name.",
+			 function );
+
+			goto on_error;
+		}
+		if( narrow_string_copy(
+		     registry_value_cache_entry->parent_key_name,
+		     parent_key_name,
+		     parent_key_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy parent key name.",
+			 function );
+
+			goto on_error;
+		}
+		registry_value_cache_entry->parent_key_name[ parent_key_name_length ] = 0;
+
+		registry_value_cache_entry->parent_key_name_length = parent_key_name_length;
+	}
+	registry_value_cache_entry->key_name = system_string_allocate(
+	                                        key_name_length + 1 );
+
+	if( registry_value_cache_entry->key_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key name.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     registry_value_cache_entry->key_name,
+	     key_name,
+	     key_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key name.",
+		 function );
+
+		goto on_error;
+	}
+	registry_value_cache_entry->key_name[ key_name_length ] = 0;
+
+	registry_value_cache_entry->key_name_length = key_name_length;
+
+	registry_value_cache_entry->value_name = system_string_allocate(
+	                                          value_name_length + 1 );
+
+	if( registry_value_cache_entry->value_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value name.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     registry_value_cache_entry->value_name,
+	     value_name,
+	     value_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy value name.",
+		 function );
+
+		goto on_error;
+	}
+	registry_value_cache_entry->value_name[ value_name_length ] = 0;
+
+	registry_value_cache_entry->value_name_length = value_name_length;
+
+	if( value_string != NULL )
+	{
+		registry_value_cache_entry->value_string = system_string_allocate(
+		                                            value_string_size );
+
+		if( registry_value_cache_entry->value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     registry_value_cache_entry->value_string,
+		     value_string,
+		     value_string_size - 1 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value string.",
+			 function );
+
+			goto on_error;
+		}
+		registry_value_cache_entry->value_string[ value_string_size - 1 ] = 0;
+
+		registry_value_cache_entry->value_string_size = value_string_size;
+	}
+	registry_value_cache_entry->hash = registry_value_cache_calculate_hash(
+	                                    key_type,
+	                                    parent_key_name,
+	                                    parent_key_name_length,
+	                                    key_name,
+	                                    key_name_length,
+	                                    value_name,
+	                                    value_name_length );
+
+	registry_value_cache_entry->key_type = key_type;
+
+	bucket_index = (int) ( registry_value_cache_entry->hash % REGISTRY_VALUE_CACHE_NUMBER_OF_BUCKETS );
+
+	registry_value_cache_entry->next_entry        = registry_value_cache->buckets[ bucket_index ];
+	registry_value_cache->buckets[ bucket_index ] = registry_value_cache_entry;
+
+	registry_value_cache->number_of_entries += 1;
+
+	return( 1 );
+
+on_error:
+	if( registry_value_cache_entry != NULL )
+	{
+		registry_value_cache_entry_free(
+		 &registry_value_cache_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,159 @@
+/*
+ * Registry value cache
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _REGISTRY_VALUE_CACHE_H )
+#define _REGISTRY_VALUE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define REGISTRY_VALUE_CACHE_NUMBER_OF_BUCKETS		256
+
+enum REGISTRY_VALUE_CACHE_KEY_TYPES
+{
+	REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE		= 1,
+	REGISTRY_VALUE_CACHE_KEY_TYPE_PROVIDER_IDENTIFIER	= 2
+};
+
+typedef struct registry_value_cache_entry registry_value_cache_entry_t;
+
+struct registry_value_cache_entry
+{
+	/* The hash of the key values
+	 */
+	uint32_t hash;
+
+	/* The key type
+	 */
+	uint8_t key_type;
+
+	/* The parent key name
+	 */
+	char *parent_key_name;
+
+	/* The parent key name length
+	 */
+	size_t parent_key_name_length;
+
+	/* The key name
+	 */
+	system_character_t *key_name;
+
+	/* The key name length
+	 */
+	size_t key_name_length;
+
+	/* The value name
+	 */
+	system_character_t *value_name;
+
+	/* The value name length
+	 */
+	size_t value_name_length;
+
+	/* The value string, where NULL represents the value is not available
+	 */
+	system_character_t *value_string;
+
+	/* The value string size
+	 */
+	size_t value_string_size;
+
+	/* The next entry in the same bucket
+	 */
+	registry_value_cache_entry_t *next_entry;
+};
+
+typedef struct registry_value_cache registry_value_cache_t;
+
+struct registry_value_cache
+{
+	/* The buckets
+	 */
+	registry_value_cache_entry_t *buckets[ REGISTRY_VALUE_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+uint32_t registry_value_cache_calculate_hash(
+          uint8_t key_type,
+          const char *parent_key_name,
+          size_t parent_key_name_length,
+          const system_character_t *key_name,
+          size_t key_name_length,
+          const system_character_t *value_name,
+          size_t value_name_length );
+
+int registry_value_cache_entry_free(
+     registry_value_cache_entry_t **registry_value_cache_entry,
+     libcerror_error_t **error );
+
+int registry_value_cache_initialize(
+     registry_value_cache_t **registry_value_cache,
+     libcerror_error_t **error );
+
+int registry_value_cache_free(
+     registry_value_cache_t **registry_value_cache,
+     libcerror_error_t **error );
+
+int registry_value_cache_empty(
+     registry_value_cache_t *registry_value_cache,
+     libcerror_error_t **error );
+
+int registry_value_cache_get_entry(
+     registry_value_cache_t *registry_value_cache,
+     uint8_t key_type,
+     const char *parent_key_name,
+     size_t parent_key_name_length,
+     const system_character_t *key_name,
+     size_t key_name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     registry_value_cache_entry_t **registry_value_cache_entry,
+     libcerror_error_t **error );
+
+int registry_value_cache_insert_value(
+     registry_value_cache_t *registry_value_cache,
+     uint8_t key_type,
+     const char *parent_key_name,
+     size_t parent_key_name_length,
+     const system_character_t *key_name,
+     size_t key_name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const system_character_t *value_string,
+     size_t value_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _REGISTRY_VALUE_CACHE_H ) */
+
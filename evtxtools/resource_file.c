@@ -261,6 +261,7 @@ int resource_file_free(
 }
 
 /* Opens the resource file
+ * The resource stream is opened on first use by resource_file_open_resource_stream
  * Returns 1 if successful or -1 on error
  */
 int resource_file_open(
@@ -268,8 +269,7 @@ int resource_file_open(
      const system_character_t *filename,
      libcerror_error_t **error )
 {
-	static char *function    = "resource_file_open";
-	uint32_t virtual_address = 0;
+	static char *function = "resource_file_open";
 
 	if( resource_file == NULL )
 	{
@@ -314,14 +314,59 @@ int resource_file_open(
 		 "%s: unable to open EXE file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libexe_file_get_section_by_name(
-	     resource_file->exe_file,
-	     ".rsrc",
-	     5,
-	     &( resource_file->resource_section ),
-	     error ) != 1 )
+	resource_file->is_open = 1;
+
+	return( 1 );
+}
+
+/* Opens the resource stream of the resource file
+ * This reads the resource directory tree from the resource (.rsrc) section
+ * Returns 1 if successful, 0 if the file has no resource section or -1 on error
+ */
+int resource_file_open_resource_stream(
+     resource_file_t *resource_file,
+     libcerror_error_t **error )
+{
+	static char *function    = "resource_file_open_resource_stream";
+	uint32_t virtual_address = 0;
+	int result               = 0;
+
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid resource file - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file->resource_stream_is_open != 0 )
+	{
+		return( 1 );
+	}
+	result = libexe_file_get_section_by_name(
+	          resource_file->exe_file,
+	          ".rsrc",
+	          5,
+	          &( resource_file->resource_section ),
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -332,6 +377,10 @@ int resource_file_open(
 
 		goto on_error;
 	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
 	if( libexe_section_get_virtual_address(
 	     resource_file->resource_section,
 	     &virtual_address,
@@ -389,7 +438,7 @@ int resource_file_open(
 
 		goto on_error;
 	}
-	resource_file->is_open = 1;
+	resource_file->resource_stream_is_open = 1;
 
 	return( 1 );
 
@@ -406,10 +455,6 @@ on_error:
 		 &( resource_file->resource_section ),
 		 NULL );
 	}
-	libexe_file_close(
-	 resource_file->exe_file,
-	 NULL );
-
 	return( -1 );
 }
 
@@ -497,18 +542,22 @@ int resource_file_close(
 				result = -1;
 			}
 		}
-		if( libwrc_stream_close(
-		     resource_file->resource_stream,
-		     error ) != 0 )
+		if( resource_file->resource_stream_is_open != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close resource stream.",
-			 function );
+			if( libwrc_stream_close(
+			     resource_file->resource_stream,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close resource stream.",
+				 function );
 
-			result = -1;
+				result = -1;
+			}
+			resource_file->resource_stream_is_open = 0;
 		}
 		if( resource_file->resource_section_file_io_handle != NULL )
 		{
@@ -555,7 +604,10 @@ int resource_file_close(
 
 			result = -1;
 		}
-		resource_file->is_open = 0;
+		resource_file->message_table_resource_read = 0;
+		resource_file->mui_resource_read           = 0;
+		resource_file->wevt_manifest_read          = 0;
+		resource_file->is_open                     = 0;
 	}
 	return( result );
 }
@@ -713,6 +765,25 @@ int resource_file_get_message_table_resource(
 
 		return( -1 );
 	}
+	result = resource_file_open_resource_stream(
+	          resource_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open resource stream.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
 	result = libwrc_stream_get_resource_by_type(
 	          resource_file->resource_stream,
 	          LIBWRC_RESOURCE_TYPE_MESSAGE_TABLE,
@@ -1174,7 +1245,7 @@ int resource_file_get_message_string(
 
 		return( -1 );
 	}
-	if( resource_file->message_table_resource == NULL )
+	if( resource_file->message_table_resource_read == 0 )
 	{
 		result = resource_file_get_message_table_resource(
 		          resource_file,
@@ -1192,11 +1263,17 @@ int resource_file_get_message_string(
 
 			goto on_error;
 		}
-		else if( result == 0 )
+		resource_file->message_table_resource_read = 1;
+
+		if( result == 0 )
 		{
 			return( 0 );
 		}
 	}
+	else if( resource_file->message_table_resource == NULL )
+	{
+		return( 0 );
+	}
 	result = resource_file_get_message_string_from_cache(
 	          resource_file,
 	          message_string_identifier,
@@ -1365,6 +1442,25 @@ int resource_file_get_mui_resource(
 
 		return( -1 );
 	}
+	result = resource_file_open_resource_stream(
+	          resource_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open resource stream.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
 	result = libwrc_stream_get_resource_by_utf8_name(
 	          resource_file->resource_stream,
 	          (uint8_t *) "MUI",
@@ -1722,7 +1818,7 @@ int resource_file_get_mui_file_type(
 
 		return( -1 );
 	}
-	if( resource_file->mui_resource == NULL )
+	if( resource_file->mui_resource_read == 0 )
 	{
 		result = resource_file_get_mui_resource(
 		          resource_file,
@@ -1740,11 +1836,17 @@ int resource_file_get_mui_file_type(
 
 			return( -1 );
 		}
-		else if( result == 0 )
+		resource_file->mui_resource_read = 1;
+
+		if( result == 0 )
 		{
 			return( 0 );
 		}
 	}
+	else if( resource_file->mui_resource == NULL )
+	{
+		return( 0 );
+	}
 	if( libwrc_mui_resource_get_file_type(
 	     resource_file->mui_resource,
 	     file_type,
@@ -1806,6 +1908,25 @@ int resource_file_get_wevt_manifest(
 
 		return( -1 );
 	}
+	result = resource_file_open_resource_stream(
+	          resource_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open resource stream.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
 	result = libwrc_stream_get_resource_by_utf8_name(
 	          resource_file->resource_stream,
 	          (uint8_t *) "WEVT_TEMPLATE",
@@ -2165,7 +2286,7 @@ int resource_file_get_provider(
 
 		return( -1 );
 	}
-	if( resource_file->wevt_manifest == NULL )
+	if( resource_file->wevt_manifest_read == 0 )
 	{
 		result = resource_file_get_wevt_manifest(
 		          resource_file,
@@ -2183,11 +2304,17 @@ int resource_file_get_provider(
 
 			return( -1 );
 		}
-		else if( result == 0 )
+		resource_file->wevt_manifest_read = 1;
+
+		if( result == 0 )
 		{
 			return( 0 );
 		}
 	}
+	else if( resource_file->wevt_manifest == NULL )
+	{
+		return( 0 );
+	}
 	result = libfwevt_manifest_get_provider_by_identifier(
 	          resource_file->wevt_manifest,
 	          provider_identifier,
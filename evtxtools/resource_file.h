@@ -65,6 +65,11 @@ struct resource_file
 	 */
 	libwrc_stream_t *resource_stream;
 
+	/* Value to indicate if the resource stream is open
+	 * The resource stream is opened on first use since it reads the resource directory tree
+	 */
+	uint8_t resource_stream_is_open;
+
 	/* The preferred language identifier
 	 */
 	uint32_t preferred_language_identifier;
@@ -73,14 +78,26 @@ struct resource_file
 	 */
 	libwrc_message_table_resource_t *message_table_resource;
 
+	/* Value to indicate the message table resource was read or is not available
+	 */
+	uint8_t message_table_resource_read;
+
 	/* The MUI resource
 	 */
 	libwrc_mui_resource_t *mui_resource;
 
+	/* Value to indicate the MUI resource was read or is not available
+	 */
+	uint8_t mui_resource_read;
+
 	/* The instrumentation manifest stored in a WEVT_TEMPLATE resource
 	 */
 	libfwevt_manifest_t *wevt_manifest;
 
+	/* Value to indicate the WEVT manifest was read or is not available
+	 */
+	uint8_t wevt_manifest_read;
+
 	/* The message string cache
 	 */
 	libfcache_cache_t *message_string_cache;
@@ -112,6 +129,10 @@ int resource_file_close(
      resource_file_t *resource_file,
      libcerror_error_t **error );
 
+int resource_file_open_resource_stream(
+     resource_file_t *resource_file,
+     libcerror_error_t **error );
+
 int resource_file_set_name(
      resource_file_t *resource_file,
      const system_character_t *name,
@@ -0,0 +1,532 @@
+/*
+ * Resource file cache
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "resource_file.h"
+#include "resource_file_cache.h"
+
+/* Calculates the hash of a resource file name
+ * The hash is a 32-bit FNV-1a over the case folded characters, since
+ * Windows file names are case insensitive
+ * Returns the hash
+ */
+uint32_t resource_file_cache_calculate_hash(
+          const system_character_t *resource_filename,
+          size_t resource_filename_length )
+{
+	size_t resource_filename_index = 0;
+	uint32_t hash                  = 0x811c9dc5UL;
+	uint32_t value_32bit           = 0;
+
+	if( resource_filename == NULL )
+	{
+		return( hash );
+	}
+	for( resource_filename_index = 0;
+	     resource_filename_index < resource_filename_length;
+	     resource_filename_index++ )
+	{
+		value_32bit = (uint32_t) resource_filename[ resource_filename_index ];
+
+		if( ( value_32bit >= (uint32_t) 'A' )
+		 && ( value_32bit <= (uint32_t) 'Z' ) )
+		{
+			value_32bit += (uint32_t) 'a' - (uint32_t) 'A';
+		}
+		hash ^= value_32bit;
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Creates a resource file cache
+ * Make sure the value resource_file_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_initialize(
+     resource_file_cache_t **resource_file_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_initialize";
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_file_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource file cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*resource_file_cache = memory_allocate_structure(
+	                        resource_file_cache_t );
+
+	if( *resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create resource file cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *resource_file_cache,
+	     0,
+	     sizeof( resource_file_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear resource file cache.",
+		 function );
+
+		goto on_error;
+	}
+	( *resource_file_cache )->maximum_number_of_entries = RESOURCE_FILE_CACHE_MAXIMUM_NUMBER_OF_ENTRIES;
+
+	return( 1 );
+
+on_error:
+	if( *resource_file_cache != NULL )
+	{
+		memory_free(
+		 *resource_file_cache );
+
+		*resource_file_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a resource file cache
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_free(
+     resource_file_cache_t **resource_file_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_free";
+	int result            = 1;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_file_cache != NULL )
+	{
+		if( resource_file_cache_empty(
+		     *resource_file_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty resource file cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *resource_file_cache );
+
+		*resource_file_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a resource file cache
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_empty(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *resource_file_cache_entry = NULL;
+	static char *function                                  = "resource_file_cache_empty";
+	int result                                             = 1;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( resource_file_cache->most_recently_used_entry != NULL )
+	{
+		resource_file_cache_entry = resource_file_cache->most_recently_used_entry;
+
+		resource_file_cache->most_recently_used_entry = resource_file_cache_entry->less_recently_used_entry;
+
+		if( resource_file_free(
+		     &( resource_file_cache_entry->resource_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free resource file.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 resource_file_cache_entry );
+	}
+	if( memory_set(
+	     resource_file_cache->buckets,
+	     0,
+	     sizeof( resource_file_cache_entry_t * ) * RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		result = -1;
+	}
+	resource_file_cache->least_recently_used_entry = NULL;
+	resource_file_cache->number_of_entries         = 0;
+
+	return( result );
+}
+
+/* Sets the maximum number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_set_maximum_number_of_entries(
+     resource_file_cache_t *resource_file_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_set_maximum_number_of_entries";
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	resource_file_cache->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific resource file
+ * The resource file name is compared case insensitive and a resource file that
+ * is found becomes the most recently used entry
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int resource_file_cache_get_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *resource_file_cache_entry = NULL;
+	static char *function                                  = "resource_file_cache_get_resource_file";
+	uint32_t hash                                          = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	*resource_file = NULL;
+
+	hash = resource_file_cache_calculate_hash(
+	        resource_filename,
+	        resource_filename_length );
+
+	resource_file_cache_entry = resource_file_cache->buckets[ hash % RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS ];
+
+	while( resource_file_cache_entry != NULL )
+	{
+		if( ( resource_file_cache_entry->hash == hash )
+		 && ( resource_file_cache_entry->resource_file->name_size == ( resource_filename_length + 1 ) )
+		 && ( system_string_compare_no_case(
+		       resource_file_cache_entry->resource_file->name,
+		       resource_filename,
+		       resource_filename_length ) == 0 ) )
+		{
+			break;
+		}
+		resource_file_cache_entry = resource_file_cache_entry->next_entry;
+	}
+	if( resource_file_cache_entry == NULL )
+	{
+		return( 0 );
+	}
+	if( resource_file_cache_entry != resource_file_cache->most_recently_used_entry )
+	{
+		/* Unlink the entry from its current position in the recently used list
+		 */
+		resource_file_cache_entry->more_recently_used_entry->less_recently_used_entry = resource_file_cache_entry->less_recently_used_entry;
+
+		if( resource_file_cache_entry->less_recently_used_entry != NULL )
+		{
+			resource_file_cache_entry->less_recently_used_entry->more_recently_used_entry = resource_file_cache_entry->more_recently_used_entry;
+		}
+		else
+		{
+			resource_file_cache->least_recently_used_entry = resource_file_cache_entry->more_recently_used_entry;
+		}
+		resource_file_cache_entry->more_recently_used_entry = NULL;
+		resource_file_cache_entry->less_recently_used_entry = resource_file_cache->most_recently_used_entry;
+
+		resource_file_cache->most_recently_used_entry->more_recently_used_entry = resource_file_cache_entry;
+		resource_file_cache->most_recently_used_entry                           = resource_file_cache_entry;
+	}
+	*resource_file = resource_file_cache_entry->resource_file;
+
+	return( 1 );
+}
+
+/* Inserts a resource file
+ * The cache takes over management of the resource file. If the cache is full
+ * the least recently used resource file is freed
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_insert_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     resource_file_t *resource_file,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *resource_file_cache_entry = NULL;
+	resource_file_cache_entry_t **bucket_entry             = NULL;
+	static char *function                                  = "resource_file_cache_insert_resource_file";
+	uint32_t hash                                          = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( resource_file->name == NULL )
+	 || ( resource_file->name_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid resource file - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache->number_of_entries >= resource_file_cache->maximum_number_of_entries )
+	{
+		/* Remove the least recently used entry
+		 */
+		resource_file_cache_entry = resource_file_cache->least_recently_used_entry;
+
+		if( resource_file_cache_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid resource file cache - missing least recently used entry.",
+			 function );
+
+			return( -1 );
+		}
+		bucket_entry = &( resource_file_cache->buckets[ resource_file_cache_entry->hash % RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS ] );
+
+		while( *bucket_entry != resource_file_cache_entry )
+		{
+			bucket_entry = &( ( *bucket_entry )->next_entry );
+		}
+		*bucket_entry = resource_file_cache_entry->next_entry;
+
+		resource_file_cache->least_recently_used_entry = resource_file_cache_entry->more_recently_used_entry;
+
+		if( resource_file_cache->least_recently_used_entry != NULL )
+		{
+			resource_file_cache->least_recently_used_entry->less_recently_used_entry = NULL;
+		}
+		else
+		{
+			resource_file_cache->most_recently_used_entry = NULL;
+		}
+		resource_file_cache->number_of_entries -= 1;
+
+		if( resource_file_free(
+		     &( resource_file_cache_entry->resource_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free least recently used resource file.",
+			 function );
+
+			memory_free(
+			 resource_file_cache_entry );
+
+			return( -1 );
+		}
+		/* Reuse the entry of the removed resource file
+		 */
+	}
+	else
+	{
+		resource_file_cache_entry = memory_allocate_structure(
+		                             resource_file_cache_entry_t );
+
+		if( resource_file_cache_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create resource file cache entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	hash = resource_file_cache_calculate_hash(
+	        resource_file->name,
+	        resource_file->name_size - 1 );
+
+	resource_file_cache_entry->hash                     = hash;
+	resource_file_cache_entry->resource_file            = resource_file;
+	resource_file_cache_entry->next_entry               = resource_file_cache->buckets[ hash % RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS ];
+	resource_file_cache_entry->more_recently_used_entry = NULL;
+	resource_file_cache_entry->less_recently_used_entry = resource_file_cache->most_recently_used_entry;
+
+	resource_file_cache->buckets[ hash % RESOURCE_FILE_CACHE_NUMBER_OF_BUCKETS ] = resource_file_cache_entry;
+
+	if( resource_file_cache->most_recently_used_entry != NULL )
+	{
+		resource_file_cache->most_recently_used_entry->more_recently_used_entry = resource_file_cache_entry;
+	}
+	else
+	{
+		resource_file_cache->least_recently_used_entry = resource_file_cache_entry;
+	}
+	resource_file_cache->most_recently_used_entry = resource_file_cache_entry;
+
+	resource_file_cache->number_of_entries += 1;
+
+	return( 1 );
+}
+
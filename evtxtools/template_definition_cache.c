@@ -0,0 +1,487 @@
+/*
+ * Template definition cache
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+#include "template_definition_cache.h"
+
+/* Calculates the hash of the template definition cache key values
+ * The hash is a 32-bit FNV-1a over the provider identifier, the event identifier and version
+ * Returns the hash
+ */
+uint32_t template_definition_cache_calculate_hash(
+          const uint8_t *provider_identifier,
+          uint32_t event_identifier,
+          uint8_t event_version )
+{
+	size_t byte_index = 0;
+	uint32_t hash     = 0x811c9dc5UL;
+
+	if( provider_identifier != NULL )
+	{
+		for( byte_index = 0;
+		     byte_index < 16;
+		     byte_index++ )
+		{
+			hash ^= (uint32_t) provider_identifier[ byte_index ];
+			hash *= 0x01000193UL;
+		}
+	}
+	for( byte_index = 0;
+	     byte_index < 4;
+	     byte_index++ )
+	{
+		hash ^= event_identifier & 0x000000ffUL;
+		hash *= 0x01000193UL;
+
+		event_identifier >>= 8;
+	}
+	hash ^= (uint32_t) event_version;
+	hash *= 0x01000193UL;
+
+	return( hash );
+}
+
+/* Frees a template definition cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_entry_free(
+     template_definition_cache_entry_t **template_definition_cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "template_definition_cache_entry_free";
+	int result            = 1;
+
+	if( template_definition_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_definition_cache_entry != NULL )
+	{
+		if( ( *template_definition_cache_entry )->template_definition != NULL )
+		{
+			if( libevtx_template_definition_free(
+			     &( ( *template_definition_cache_entry )->template_definition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free template definition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *template_definition_cache_entry );
+
+		*template_definition_cache_entry = NULL;
+	}
+	return( result );
+}
+
+/* Creates a template definition cache
+ * Make sure the value template_definition_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_initialize(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "template_definition_cache_initialize";
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_definition_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid template definition cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*template_definition_cache = memory_allocate_structure(
+	                              template_definition_cache_t );
+
+	if( *template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create template definition cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *template_definition_cache,
+	     0,
+	     sizeof( template_definition_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template definition cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *template_definition_cache != NULL )
+	{
+		memory_free(
+		 *template_definition_cache );
+
+		*template_definition_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a template definition cache
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_free(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "template_definition_cache_free";
+	int result            = 1;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_definition_cache != NULL )
+	{
+		if( template_definition_cache_empty(
+		     *template_definition_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty template definition cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *template_definition_cache );
+
+		*template_definition_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a template definition cache
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_empty(
+     template_definition_cache_t *template_definition_cache,
+     libcerror_error_t **error )
+{
+	template_definition_cache_entry_t *template_definition_cache_entry = NULL;
+	static char *function                                              = "template_definition_cache_empty";
+	int bucket_index                                                   = 0;
+	int result                                                         = 1;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < TEMPLATE_DEFINITION_CACHE_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		while( template_definition_cache->buckets[ bucket_index ] != NULL )
+		{
+			template_definition_cache_entry = template_definition_cache->buckets[ bucket_index ];
+
+			template_definition_cache->buckets[ bucket_index ] = template_definition_cache_entry->next_entry;
+
+			if( template_definition_cache_entry_free(
+			     &template_definition_cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free template definition cache entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	template_definition_cache->number_of_entries = 0;
+
+	return( result );
+}
+
+/* Retrieves a specific template definition cache entry
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int template_definition_cache_get_entry(
+     template_definition_cache_t *template_definition_cache,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint8_t event_version,
+     template_definition_cache_entry_t **template_definition_cache_entry,
+     libcerror_error_t **error )
+{
+	template_definition_cache_entry_t *safe_template_definition_cache_entry = NULL;
+	static char *function                                                   = "template_definition_cache_get_entry";
+	uint32_t hash                                                           = 0;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid provider identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	hash = template_definition_cache_calculate_hash(
+	        provider_identifier,
+	        event_identifier,
+	        event_version );
+
+	safe_template_definition_cache_entry = template_definition_cache->buckets[ hash % TEMPLATE_DEFINITION_CACHE_NUMBER_OF_BUCKETS ];
+
+	while( safe_template_definition_cache_entry != NULL )
+	{
+		if( ( safe_template_definition_cache_entry->hash == hash )
+		 && ( safe_template_definition_cache_entry->event_identifier == event_identifier )
+		 && ( safe_template_definition_cache_entry->event_version == event_version )
+		 && ( memory_compare(
+		       safe_template_definition_cache_entry->provider_identifier,
+		       provider_identifier,
+		       16 ) == 0 ) )
+		{
+			*template_definition_cache_entry = safe_template_definition_cache_entry;
+
+			return( 1 );
+		}
+		safe_template_definition_cache_entry = safe_template_definition_cache_entry->next_entry;
+	}
+	return( 0 );
+}
+
+/* Inserts a template definition into the template definition cache
+ * The cache takes over management of the template definition
+ * A template definition of NULL records that the template definition is not available
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_insert_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint8_t event_version,
+     libevtx_template_definition_t *template_definition,
+     libcerror_error_t **error )
+{
+	template_definition_cache_entry_t *template_definition_cache_entry = NULL;
+	static char *function                                              = "template_definition_cache_insert_template_definition";
+	int bucket_index                                                   = 0;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid provider identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	template_definition_cache_entry = memory_allocate_structure(
+	                                   template_definition_cache_entry_t );
+
+	if( template_definition_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create template definition cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     template_definition_cache_entry,
+	     0,
+	     sizeof( template_definition_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template definition cache entry.",
+		 function );
+
+		memory_free(
+		 template_definition_cache_entry );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     template_definition_cache_entry->provider_identifier,
+	     provider_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier.",
+		 function );
+
+		memory_free(
+		 template_definition_cache_entry );
+
+		return( -1 );
+	}
+	template_definition_cache_entry->hash = template_definition_cache_calculate_hash(
+	                                         provider_identifier,
+	                                         event_identifier,
+	                                         event_version );
+
+	template_definition_cache_entry->event_identifier    = event_identifier;
+	template_definition_cache_entry->event_version       = event_version;
+	template_definition_cache_entry->template_definition = template_definition;
+
+	bucket_index = (int) ( template_definition_cache_entry->hash % TEMPLATE_DEFINITION_CACHE_NUMBER_OF_BUCKETS );
+
+	template_definition_cache_entry->next_entry        = template_definition_cache->buckets[ bucket_index ];
+	template_definition_cache->buckets[ bucket_index ] = template_definition_cache_entry;
+
+	template_definition_cache->number_of_entries += 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,123 @@
+/*
+ * Template definition cache
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _TEMPLATE_DEFINITION_CACHE_H )
+#define _TEMPLATE_DEFINITION_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define TEMPLATE_DEFINITION_CACHE_NUMBER_OF_BUCKETS	256
+
+typedef struct template_definition_cache_entry template_definition_cache_entry_t;
+
+struct template_definition_cache_entry
+{
+	/* The hash of the key values
+	 */
+	uint32_t hash;
+
+	/* The provider identifier
+	 */
+	uint8_t provider_identifier[ 16 ];
+
+	/* The event identifier
+	 */
+	uint32_t event_identifier;
+
+	/* The event version
+	 */
+	uint8_t event_version;
+
+	/* The template definition, where NULL represents the template definition is not available
+	 */
+	libevtx_template_definition_t *template_definition;
+
+	/* The next entry in the same bucket
+	 */
+	template_definition_cache_entry_t *next_entry;
+};
+
+typedef struct template_definition_cache template_definition_cache_t;
+
+struct template_definition_cache
+{
+	/* The buckets
+	 */
+	template_definition_cache_entry_t *buckets[ TEMPLATE_DEFINITION_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+uint32_t template_definition_cache_calculate_hash(
+          const uint8_t *provider_identifier,
+          uint32_t event_identifier,
+          uint8_t event_version );
+
+int template_definition_cache_entry_free(
+     template_definition_cache_entry_t **template_definition_cache_entry,
+     libcerror_error_t **error );
+
+int template_definition_cache_initialize(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error );
+
+int template_definition_cache_free(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error );
+
+int template_definition_cache_empty(
+     template_definition_cache_t *template_definition_cache,
+     libcerror_error_t **error );
+
+int template_definition_cache_get_entry(
+     template_definition_cache_t *template_definition_cache,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint8_t event_version,
+     template_definition_cache_entry_t **template_definition_cache_entry,
+     libcerror_error_t **error );
+
+int template_definition_cache_insert_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     uint8_t event_version,
+     libevtx_template_definition_t *template_definition,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _TEMPLATE_DEFINITION_CACHE_H ) */
+
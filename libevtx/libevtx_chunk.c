@@ -32,6 +32,7 @@
 #include "libevtx_libcdata.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libcnotify.h"
+#include "libevtx_memory.h"
 #include "libevtx_record_values.h"
 
 #include "evtx_chunk.h"
@@ -71,8 +72,8 @@ int libevtx_chunk_initialize(
 
 		return( -1 );
 	}
-	*chunk = memory_allocate_structure(
-	          libevtx_chunk_t );
+	*chunk = libevtx_memory_allocate_structure(
+	                  libevtx_chunk_t );
 
 	if( *chunk == NULL )
 	{
@@ -97,7 +98,7 @@ int libevtx_chunk_initialize(
 		 "%s: unable to clear chunk.",
 		 function );
 
-		memory_free(
+		libevtx_memory_free(
 		 *chunk );
 
 		*chunk = NULL;
@@ -144,7 +145,7 @@ on_error:
 			 NULL,
 			 NULL );
 		}
-		memory_free(
+		libevtx_memory_free(
 		 *chunk );
 
 		*chunk = NULL;
@@ -205,10 +206,10 @@ int libevtx_chunk_free(
 		}
 		if( ( *chunk )->data != NULL )
 		{
-			memory_free(
+			libevtx_memory_free(
 			 ( *chunk )->data );
 		}
-		memory_free(
+		libevtx_memory_free(
 		 *chunk );
 
 		*chunk = NULL;
@@ -307,8 +308,8 @@ int libevtx_chunk_read(
 #endif
 	chunk->file_offset = file_offset;
 
-	chunk->data = (uint8_t *) memory_allocate(
-	                           (size_t) io_handle->chunk_size );
+	chunk->data = (uint8_t *) libevtx_memory_allocate(
+	                                   (size_t) io_handle->chunk_size );
 
 	if( chunk->data == NULL )
 	{
@@ -334,11 +335,12 @@ int libevtx_chunk_read(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = libevtx_io_handle_read_chunk_data(
+	              io_handle,
 	              file_io_handle,
+	              file_offset,
 	              chunk->data,
 	              chunk->data_size,
-	              file_offset,
 	              error );
 
 	if( read_count != (ssize_t) chunk->data_size )
@@ -442,6 +444,8 @@ int libevtx_chunk_read(
 		 ( (evtx_chunk_header_t *) chunk_data )->checksum,
 		 stored_checksum );
 
+		chunk->first_event_record_number = first_event_record_number;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -784,7 +788,10 @@ int libevtx_chunk_read(
 			/* TODO mark this as corruption ? */
 		}
 	}
-	if( chunk_data_offset < chunk_data_size )
+	/* Scan the free space for recovered records unless recovery was disabled or deferred
+	 */
+	if( ( ( io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_SKIP_RECOVERY ) == 0 )
+	 && ( chunk_data_offset < chunk_data_size ) )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
 		free_space_size = chunk_data_size - chunk_data_offset;
@@ -945,7 +952,7 @@ on_error:
 	}
 	if( chunk->data != NULL )
 	{
-		memory_free(
+		libevtx_memory_free(
 		 chunk->data );
 
 		chunk->data = NULL;
@@ -51,6 +51,10 @@ struct libevtx_chunk
 	 */
 	off64_t file_offset;
 
+	/* The first event record number
+	 */
+	uint64_t first_event_record_number;
+
 	/* The records array
 	 */
 	libcdata_array_t *records_array;
@@ -30,8 +30,8 @@
 #include "libevtx_libcerror.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_memory.h"
 #include "libevtx_record_values.h"
-#include "libevtx_unused.h"
 
 /* Creates a chunks table
  * Make sure the value chunks_table is referencing, is set to NULL
@@ -79,8 +79,8 @@ int libevtx_chunks_table_initialize(
 
 		return( -1 );
 	}
-	*chunks_table = memory_allocate_structure(
-	                 libevtx_chunks_table_t );
+	*chunks_table = libevtx_memory_allocate_structure(
+	                         libevtx_chunks_table_t );
 
 	if( *chunks_table == NULL )
 	{
@@ -117,7 +117,7 @@ int libevtx_chunks_table_initialize(
 on_error:
 	if( *chunks_table != NULL )
 	{
-		memory_free(
+		libevtx_memory_free(
 		 *chunks_table );
 
 		*chunks_table = NULL;
@@ -148,7 +148,7 @@ int libevtx_chunks_table_free(
 	}
 	if( *chunks_table != NULL )
 	{
-		memory_free(
+		libevtx_memory_free(
 		 *chunks_table );
 
 		*chunks_table = NULL;
@@ -156,67 +156,76 @@ int libevtx_chunks_table_free(
 	return( result );
 }
 
-/* Reads a chunk
- * Callback function for the chunk vector
+/* Reads the record values of a specific record
+ * The record is identified by the index of the chunk that contains it
+ * and the offset of the record data relative to the start of the chunk
  * Returns 1 if successful or -1 on error
  */
-int libevtx_chunks_table_read_record(
-     intptr_t *io_handle,
+int libevtx_chunks_table_read_record_values(
+     libevtx_chunks_table_t *chunks_table,
      libbfio_handle_t *file_io_handle,
-     libfdata_list_element_t *list_element,
-     libfdata_cache_t *cache,
-     int data_range_file_index LIBEVTX_ATTRIBUTE_UNUSED,
-     off64_t data_range_offset,
-     size64_t data_range_size,
-     uint32_t data_range_flags LIBEVTX_ATTRIBUTE_UNUSED,
-     uint8_t read_flags LIBEVTX_ATTRIBUTE_UNUSED,
+     uint32_t chunk_index,
+     uint32_t record_chunk_data_offset,
+     libevtx_record_values_t **record_values,
      libcerror_error_t **error )
 {
 	libevtx_chunk_t *chunk                       = NULL;
-	libevtx_chunks_table_t *chunks_table         = NULL;
 	libevtx_record_values_t *chunk_record_values = NULL;
-	libevtx_record_values_t *record_values       = NULL;
-	static char *function                        = "libevtx_io_handle_read_chunk";
+	static char *function                        = "libevtx_chunks_table_read_record_values";
 	size_t calculated_chunk_data_offset          = 0;
 	size_t chunk_data_offset                     = 0;
 	uint16_t number_of_records                   = 0;
 	uint16_t record_index                        = 0;
 
-	LIBEVTX_UNREFERENCED_PARAMETER( data_range_file_index );
-	LIBEVTX_UNREFERENCED_PARAMETER( data_range_flags );
-	LIBEVTX_UNREFERENCED_PARAMETER( read_flags );
-
-	if( io_handle == NULL )
+	if( chunks_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid chunks table.",
 		 function );
 
 		return( -1 );
 	}
-	chunks_table = (libevtx_chunks_table_t *) io_handle;
-
-	/* The chunk index is stored in the data range size
-	*/
-	if( data_range_size > (uint64_t) UINT16_MAX )
+	if( chunk_index > (uint32_t) INT_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid data range size value out of bounds.",
+		 "%s: invalid chunk index value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record values value already set.",
+		 function );
+
+		return( -1 );
 	}
 	if( libfdata_vector_get_element_value_by_index(
 	     chunks_table->chunks_vector,
 	     (intptr_t *) file_io_handle,
 	     (libfdata_cache_t *) chunks_table->chunks_cache,
-	     (uint16_t) data_range_size,
+	     (int) chunk_index,
 	     (intptr_t **) &chunk,
 	     0,
 	     error ) != 1 )
@@ -225,9 +234,9 @@ int libevtx_chunks_table_read_record(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve chunk: %" PRIu64 ".",
+		 "%s: unable to retrieve chunk: %" PRIu32 ".",
 		 function,
-		 data_range_size );
+		 chunk_index );
 
 		goto on_error;
 	}
@@ -237,25 +246,24 @@ int libevtx_chunks_table_read_record(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing chunk: %" PRIu64 ".",
+		 "%s: missing chunk: %" PRIu32 ".",
 		 function,
-		 data_range_size );
+		 chunk_index );
 
 		goto on_error;
 	}
-	if( ( data_range_offset < chunk->file_offset )
-	 || ( data_range_offset >= (off64_t) ( chunk->file_offset + chunk->data_size ) ) )
+	if( (size_t) record_chunk_data_offset >= chunk->data_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid chunk file offset value out of bounds.",
+		 "%s: invalid record chunk data offset value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
-	calculated_chunk_data_offset = (size_t) ( data_range_offset - chunk->file_offset );
+	calculated_chunk_data_offset = (size_t) record_chunk_data_offset;
 
 	if( libevtx_chunk_get_number_of_records(
 	     chunk,
@@ -374,18 +382,19 @@ int libevtx_chunks_table_read_record(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: no record found at offset: %" PRIi64 ".",
+		 "%s: no record found in chunk: %" PRIu32 " at offset: %" PRIzd ".",
 		 function,
-		 data_range_offset );
+		 chunk_index,
+		 calculated_chunk_data_offset );
 
 		goto on_error;
 	}
 	/* The record values are managed by the chunk and freed after usage
 	 * A copy is created to make sure that the records values that are passed
-	 * to the records list can be managed by the list
+	 * to the records cache can be managed by the cache
 	 */
 	if( libevtx_record_values_clone(
-	     &record_values,
+	     record_values,
 	     chunk_record_values,
 	     error ) != 1 )
 	{
@@ -399,7 +408,7 @@ int libevtx_chunks_table_read_record(
 		goto on_error;
 	}
 	if( libevtx_record_values_read_xml_document(
-	     record_values,
+	     *record_values,
 	     chunks_table->io_handle,
 	     chunk->data,
 	     chunk->data_size,
@@ -414,31 +423,13 @@ int libevtx_chunks_table_read_record(
 
 		goto on_error;
 	}
-	if( libfdata_list_element_set_element_value(
-	     list_element,
-	     (intptr_t *) file_io_handle,
-	     cache,
-	     (intptr_t *) record_values,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_record_values_free,
-	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set record values as element value.",
-		 function );
-
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
-	if( record_values != NULL )
+	if( *record_values != NULL )
 	{
 		libevtx_record_values_free(
-		 &record_values,
+		 record_values,
 		 NULL );
 	}
 	return( -1 );
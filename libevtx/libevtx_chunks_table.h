@@ -30,6 +30,7 @@
 #include "libevtx_libcerror.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_record_values.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -63,16 +64,12 @@ int libevtx_chunks_table_free(
      libevtx_chunks_table_t **chunks_table,
      libcerror_error_t **error );
 
-int libevtx_chunks_table_read_record(
-     intptr_t *io_handle,
+int libevtx_chunks_table_read_record_values(
+     libevtx_chunks_table_t *chunks_table,
      libbfio_handle_t *file_io_handle,
-     libfdata_list_element_t *list_element,
-     libfdata_cache_t *cache,
-     int data_range_file_index,
-     off64_t data_range_offset,
-     size64_t data_range_size,
-     uint32_t data_range_flags,
-     uint8_t read_flags,
+     uint32_t chunk_index,
+     uint32_t record_chunk_data_offset,
+     libevtx_record_values_t **record_values,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -38,7 +38,9 @@
 #include "libevtx_libcnotify.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_memory.h"
 #include "libevtx_record.h"
+#include "libevtx_record_index.h"
 #include "libevtx_record_values.h"
 
 /* Creates a file
@@ -74,8 +76,8 @@ int libevtx_file_initialize(
 
 		return( -1 );
 	}
-	internal_file = memory_allocate_structure(
-	                 libevtx_internal_file_t );
+	internal_file = libevtx_memory_allocate_structure(
+	                         libevtx_internal_file_t );
 
 	if( internal_file == NULL )
 	{
@@ -100,7 +102,7 @@ int libevtx_file_initialize(
 		 "%s: unable to clear file.",
 		 function );
 
-		memory_free(
+		libevtx_memory_free(
 		 internal_file );
 
 		return( -1 );
@@ -143,7 +145,7 @@ on_error:
 			 &( internal_file->io_handle ),
 			 NULL );
 		}
-		memory_free(
+		libevtx_memory_free(
 		 internal_file );
 	}
 	return( -1 );
@@ -206,7 +208,7 @@ int libevtx_file_free(
 
 			result = -1;
 		}
-		memory_free(
+		libevtx_memory_free(
 		 internal_file );
 	}
 	return( result );
@@ -604,6 +606,18 @@ int libevtx_file_open_file_io_handle(
 
 		return( -1 );
 	}
+	if( ( ( access_flags & LIBEVTX_ACCESS_FLAG_NO_RECOVERY ) != 0 )
+	 && ( ( access_flags & LIBEVTX_ACCESS_FLAG_LAZY_RECOVERY ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags - no recovery and lazy recovery cannot be combined.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( access_flags & LIBEVTX_ACCESS_FLAG_READ ) != 0 )
 	{
 		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
@@ -641,6 +655,20 @@ int libevtx_file_open_file_io_handle(
 		}
 		file_io_handle_opened_in_library = 1;
 	}
+	internal_file->io_handle->flags &= (uint8_t) ~( LIBEVTX_IO_HANDLE_FLAG_SKIP_RECOVERY | LIBEVTX_IO_HANDLE_FLAG_LAZY_RECOVERY | LIBEVTX_IO_HANDLE_FLAG_READ_AHEAD );
+
+	if( ( access_flags & ( LIBEVTX_ACCESS_FLAG_NO_RECOVERY | LIBEVTX_ACCESS_FLAG_LAZY_RECOVERY ) ) != 0 )
+	{
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_SKIP_RECOVERY;
+	}
+	if( ( access_flags & LIBEVTX_ACCESS_FLAG_LAZY_RECOVERY ) != 0 )
+	{
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_LAZY_RECOVERY;
+	}
+	if( ( access_flags & LIBEVTX_ACCESS_FLAG_READ_AHEAD ) != 0 )
+	{
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_READ_AHEAD;
+	}
 	if( libevtx_file_open_read(
 	     internal_file,
 	     file_io_handle,
@@ -775,28 +803,41 @@ int libevtx_file_close(
 
 		result = -1;
 	}
-	if( libfdata_list_free(
-	     &( internal_file->recovered_records_list ),
+	if( libevtx_record_index_free(
+	     &( internal_file->recovered_records_index ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free recovered records list.",
+		 "%s: unable to free recovered records index.",
 		 function );
 
 		result = -1;
 	}
-	if( libfdata_list_free(
-	     &( internal_file->records_list ),
+	if( libevtx_record_index_free(
+	     &( internal_file->records_index ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free records list.",
+		 "%s: unable to free records index.",
+		 function );
+
+		result = -1;
+	}
+	if( libevtx_chunks_table_free(
+	     &( internal_file->chunks_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunks table.",
 		 function );
 
 		result = -1;
@@ -843,36 +884,32 @@ int libevtx_file_close(
 	return( result );
 }
 
-/* Opens a file for reading
- * Returns 1 if successful or -1 on error
+/* Reads a chunk and appends its records to the records and recovered records index
+ * Records in chunks that are part of the records index are only appended
+ * if read recovered only is not set
+ * The chunk is returned, also when it could not be read, since its data size
+ * is needed to determine the offset of the next chunk
+ * Returns 1 if successful, 0 if the chunk could not be read or -1 on error
  */
-int libevtx_file_open_read(
+int libevtx_file_read_chunk_records(
      libevtx_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t chunk_index,
+     uint8_t read_recovered_only,
+     uint64_t *previous_record_identifier,
+     libevtx_chunk_t **chunk,
      libcerror_error_t **error )
 {
-	libevtx_chunk_t *chunk                 = NULL;
 	libevtx_record_values_t *record_values = NULL;
-	libevtx_chunks_table_t *chunks_table   = NULL;
-	static char *function                  = "libevtx_file_open_read";
-	off64_t file_offset                    = 0;
-	size64_t file_size                     = 0;
-	uint16_t chunk_index                   = 0;
-	uint16_t number_of_chunks              = 0;
+	static char *function                  = "libevtx_file_read_chunk_records";
 	uint16_t number_of_records             = 0;
 	uint16_t record_index                  = 0;
-	int element_index                      = 0;
+	uint8_t is_indexed_chunk               = 0;
+	int entry_index                        = 0;
+	int first_entry_index                  = 0;
+	int number_of_entries                  = 0;
 	int result                             = 0;
-	int segment_index                      = 0;
-
-#if defined( HAVE_VERBOSE_OUTPUT )
-	uint64_t previous_record_identifier    = 0;
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t *trailing_data                 = NULL;
-	size_t trailing_data_size              = 0;
-	ssize_t read_count                     = 0;
-#endif
 
 	if( internal_file == NULL )
 	{
@@ -896,525 +933,722 @@ int libevtx_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->chunks_vector != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - chunks vector already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( internal_file->chunks_cache != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - chunks cache already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( internal_file->records_list != NULL )
+	if( previous_record_identifier == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - records list already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous record identifier.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->recovered_records_list != NULL )
+	if( chunk == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - recovered records list already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->records_cache != NULL )
+	if( *chunk != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - records cache already set.",
+		 "%s: invalid chunk value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &file_size,
+	if( libevtx_chunk_initialize(
+	     chunk,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk: %" PRIu32 ".",
+		 function,
+		 chunk_index );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
-	}
-#endif
-	if( libevtx_io_handle_read_file_header(
-	     internal_file->io_handle,
-	     file_io_handle,
-	     0,
-	     error ) != 1 )
+	result = libevtx_chunk_read(
+	          *chunk,
+	          internal_file->io_handle,
+	          file_io_handle,
+	          file_offset,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
-		 function );
-
-		goto on_error;
-	}
-	internal_file->io_handle->chunks_data_size = file_size
-	                                           - internal_file->io_handle->chunks_data_offset;
-
-/* TODO clone function ? */
-	if( libfdata_vector_initialize(
-	     &( internal_file->chunks_vector ),
-	     (size64_t) internal_file->io_handle->chunk_size,
-	     (intptr_t *) internal_file->io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_io_handle_read_chunk,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create chunks vector.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_append_segment(
-	     internal_file->chunks_vector,
-	     &segment_index,
-	     0,
-	     internal_file->io_handle->chunks_data_offset,
-	     internal_file->io_handle->chunks_data_size,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to chunks vector.",
-		 function );
+		 "%s: unable to read chunk: %" PRIu32 ".",
+		 function,
+		 chunk_index );
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
-	     &( internal_file->chunks_cache ),
-	     LIBEVTX_MAXIMUM_CACHE_ENTRIES_CHUNKS,
-	     error ) != 1 )
+	/* If the file is not dirty, records found in chunks outside the indicated
+	 * range are considered recovered
+	 */
+	if( ( chunk_index < internal_file->io_handle->number_of_chunks )
+	 || ( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create chunks cache.",
-		 function );
-
-		goto on_error;
+		is_indexed_chunk = 1;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( result == 0 )
 	{
-		libcnotify_printf(
-		 "Reading chunks:\n" );
-	}
+		if( chunk_index < internal_file->io_handle->number_of_chunks )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: corruption detected in chunk: %" PRIu32 ".\n",
+				 function,
+				 chunk_index );
+			}
 #endif
-	if( libevtx_chunks_table_initialize(
-	     &chunks_table,
-	     internal_file->io_handle,
-	     internal_file->chunks_vector,
-	     internal_file->chunks_cache,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create chunks table.",
-		 function );
-
-		goto on_error;
-	}
-/* TODO clone function ? */
-	if( libfdata_list_initialize(
-	     &( internal_file->records_list ),
-	     (intptr_t *) chunks_table,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunks_table_free,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_chunks_table_read_record,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create records list.",
-		 function );
-
-		goto on_error;
-	}
-	/* The chunks_table is managed by the list */
-
-	if( libfdata_list_initialize(
-	     &( internal_file->recovered_records_list ),
-	     (intptr_t *) chunks_table,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_chunks_table_read_record,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create recovered records list.",
-		 function );
-
-		chunks_table = NULL;
-
-		goto on_error;
+			internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+		}
+		return( 0 );
 	}
-	chunks_table = NULL;
-
-	if( libfcache_cache_initialize(
-	     &( internal_file->records_cache ),
-	     LIBEVTX_MAXIMUM_CACHE_ENTRIES_RECORDS,
-	     error ) != 1 )
+	if( ( ( *chunk )->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create records cache.",
-		 function );
-
-		goto on_error;
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: corruption detected in chunk: %" PRIu32 ".\n",
+			 function,
+			 chunk_index );
+		}
+#endif
+		if( chunk_index < internal_file->io_handle->number_of_chunks )
+		{
+			internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+		}
 	}
-	file_offset = internal_file->io_handle->chunks_data_offset;
-
-	while( ( file_offset + internal_file->io_handle->chunk_size ) <= (off64_t) file_size )
+	if( ( is_indexed_chunk == 0 )
+	 || ( read_recovered_only == 0 ) )
 	{
-		if( libevtx_chunk_initialize(
-		     &chunk,
+		if( libevtx_chunk_get_number_of_records(
+		     *chunk,
+		     &number_of_records,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create chunk: %" PRIu16 ".",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu32 " number of records.",
 			 function,
 			 chunk_index );
 
 			goto on_error;
 		}
-		result = libevtx_chunk_read(
-		          chunk,
-		          internal_file->io_handle,
-		          file_io_handle,
-		          file_offset,
-		          error );
-
-		if( result == -1 )
+		if( libevtx_record_index_get_number_of_entries(
+		     internal_file->records_index,
+		     &first_entry_index,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read chunk: %" PRIu16 ".",
-			 function,
-			 chunk_index );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries of records index.",
+			 function );
 
 			goto on_error;
 		}
-		else if( result == 0 )
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
 		{
-			if( chunk_index < internal_file->io_handle->number_of_chunks )
+			if( libevtx_chunk_get_record(
+			     *chunk,
+			     record_index,
+			     &record_values,
+			     error ) != 1 )
 			{
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: corruption detected in chunk: %" PRIu16 ".\n",
-					 function,
-					 chunk_index );
-				}
-#endif
-				internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu32 " record: %" PRIu16 ".",
+				 function,
+				 chunk_index,
+				 record_index );
+
+				goto on_error;
 			}
-		}
-		else
-		{
-			if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 )
-			{
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: corruption detected in chunk: %" PRIu16 ".\n",
-					 function,
-					 chunk_index );
-				}
-#endif
-				if( chunk_index < internal_file->io_handle->number_of_chunks )
-				{
-					internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
-				}
-			}
-			if( ( chunk_index < internal_file->io_handle->number_of_chunks )
-			 || ( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) == 0 ) )
-			{
-				number_of_chunks++;
-			}
-			if( libevtx_chunk_get_number_of_records(
-			     chunk,
-			     &number_of_records,
-			     error ) != 1 )
+			if( record_values == NULL )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve chunk: %" PRIu16 " number of records.",
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing chunk: %" PRIu32 " record: %" PRIu16 ".",
 				 function,
-				 chunk_index );
+				 chunk_index,
+				 record_index );
 
 				goto on_error;
 			}
-			for( record_index = 0;
-			     record_index < number_of_records;
-			     record_index++ )
+			if( read_recovered_only == 0 )
 			{
-				if( libevtx_chunk_get_record(
-				     chunk,
-				     record_index,
-				     &record_values,
+				if( record_values->identifier < internal_file->io_handle->first_record_identifier )
+				{
+					internal_file->io_handle->first_record_identifier = record_values->identifier;
+				}
+				if( record_values->identifier > internal_file->io_handle->last_record_identifier )
+				{
+					internal_file->io_handle->last_record_identifier = record_values->identifier;
+				}
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( ( chunk_index == 0 )
+				 && ( record_index == 0 ) )
+				{
+					*previous_record_identifier = record_values->identifier;
+				}
+				else
+				{
+					*previous_record_identifier += 1;
+
+					if( record_values->identifier != *previous_record_identifier )
+					{
+						if( libcnotify_verbose != 0 )
+						{
+							libcnotify_printf(
+							 "%s: detected gap in record identifier ( %" PRIu64 " != %" PRIu64 " ).\n",
+							 function,
+							 *previous_record_identifier,
+							 record_values->identifier );
+						}
+						*previous_record_identifier = record_values->identifier;
+					}
+				}
+#endif
+			}
+			if( is_indexed_chunk != 0 )
+			{
+				if( libevtx_record_index_append_entry(
+				     internal_file->records_index,
+				     &entry_index,
+				     chunk_index,
+				     (uint32_t) record_values->chunk_data_offset,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve chunk: %" PRIu16 " record: %" PRIu16 ".",
-					 function,
-					 chunk_index,
-					 record_index );
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append entry to records index.",
+					 function );
 
 					goto on_error;
 				}
-				if( record_values == NULL )
+			}
+			else if( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_SKIP_RECOVERY ) == 0 )
+			{
+				if( libevtx_record_index_append_entry(
+				     internal_file->recovered_records_index,
+				     &entry_index,
+				     chunk_index,
+				     (uint32_t) record_values->chunk_data_offset,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing chunk: %" PRIu16 " record: %" PRIu16 ".",
-					 function,
-					 chunk_index,
-					 record_index );
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append entry to recovered records index.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( libevtx_record_index_get_number_of_entries(
+		     internal_file->records_index,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries of records index.",
+			 function );
+
+			goto on_error;
+		}
+		/* Keep track of the event record number range per chunk, to determine
+		 * the logical order of the records of a wrapped circular log
+		 */
+		if( number_of_entries > first_entry_index )
+		{
+			if( libevtx_record_index_append_range(
+			     internal_file->records_index,
+			     ( *chunk )->first_event_record_number,
+			     first_entry_index,
+			     number_of_entries - first_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append chunk: %" PRIu32 " range to records index.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libevtx_chunk_get_number_of_recovered_records(
+	     *chunk,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu32 " number of recovered records.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libevtx_chunk_get_recovered_record(
+		     *chunk,
+		     record_index,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu32 " recovered record: %" PRIu16 ".",
+			 function,
+			 chunk_index,
+			 record_index );
+
+			goto on_error;
+		}
+		if( record_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing chunk: %" PRIu32 " recovered record: %" PRIu16 ".",
+			 function,
+			 chunk_index,
+			 record_index );
+
+			goto on_error;
+		}
+/* TODO check for and remove duplicate identifiers ? */
+		if( libevtx_record_index_append_entry(
+		     internal_file->recovered_records_index,
+		     &entry_index,
+		     chunk_index,
+		     (uint32_t) record_values->chunk_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry to recovered records index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 chunk,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_open_read(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk              = NULL;
+	static char *function               = "libevtx_file_open_read";
+	off64_t file_offset                 = 0;
+	size64_t file_size                  = 0;
+	uint64_t previous_record_identifier = 0;
+	uint32_t chunk_index                = 0;
+	uint32_t number_of_chunks           = 0;
+	uint8_t read_ahead_set              = 0;
+	int result                          = 0;
+	int segment_index                   = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint8_t *trailing_data              = NULL;
+	size_t trailing_data_size           = 0;
+	ssize_t read_count                  = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->chunks_vector != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - chunks vector already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->chunks_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - chunks cache already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->chunks_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - chunks table already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->records_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - records index already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->recovered_records_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - recovered records index already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->records_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - records cache already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	if( libevtx_io_handle_read_file_header(
+	     internal_file->io_handle,
+	     file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->chunks_data_size = file_size
+	                                           - internal_file->io_handle->chunks_data_offset;
+
+/* TODO clone function ? */
+	if( libfdata_vector_initialize(
+	     &( internal_file->chunks_vector ),
+	     (size64_t) internal_file->io_handle->chunk_size,
+	     (intptr_t *) internal_file->io_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_io_handle_read_chunk,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunks vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_vector_append_segment(
+	     internal_file->chunks_vector,
+	     &segment_index,
+	     0,
+	     internal_file->io_handle->chunks_data_offset,
+	     internal_file->io_handle->chunks_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment to chunks vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( internal_file->chunks_cache ),
+	     LIBEVTX_MAXIMUM_CACHE_ENTRIES_CHUNKS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunks cache.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading chunks:\n" );
+	}
+#endif
+	if( libevtx_chunks_table_initialize(
+	     &( internal_file->chunks_table ),
+	     internal_file->io_handle,
+	     internal_file->chunks_vector,
+	     internal_file->chunks_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunks table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_index_initialize(
+	     &( internal_file->records_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create records index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_index_initialize(
+	     &( internal_file->recovered_records_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered records index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( internal_file->records_cache ),
+	     LIBEVTX_MAXIMUM_CACHE_ENTRIES_RECORDS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create records cache.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunks are scanned sequentially, hence they are read in batches
+	 */
+	if( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_READ_AHEAD ) == 0 )
+	{
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_READ_AHEAD;
+
+		read_ahead_set = 1;
+	}
+	file_offset = internal_file->io_handle->chunks_data_offset;
 
-					goto on_error;
-				}
-				if( record_values->identifier < internal_file->io_handle->first_record_identifier )
-				{
-					internal_file->io_handle->first_record_identifier = record_values->identifier;
-				}
-				if( record_values->identifier > internal_file->io_handle->last_record_identifier )
-				{
-					internal_file->io_handle->last_record_identifier = record_values->identifier;
-				}
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( ( chunk_index == 0 )
-				 && ( record_index == 0 ) )
-				{
-					previous_record_identifier = record_values->identifier;
-				}
-				else
-				{
-					previous_record_identifier++;
+	internal_file->io_handle->next_chunk_data_offset = file_offset;
 
-					if( record_values->identifier != previous_record_identifier )
-					{
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: detected gap in record identifier ( %" PRIu64 " != %" PRIu64 " ).\n",
-							 function,
-							 previous_record_identifier,
-							 record_values->identifier );
-						}
-						previous_record_identifier = record_values->identifier;
-					}
-				}
-#endif
-				/* The chunk index is stored in the element data size
-				 */
-				if( ( chunk_index < internal_file->io_handle->number_of_chunks )
-				 || ( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) )
-				{
-					if( libfdata_list_append_element(
-					     internal_file->records_list,
-					     &element_index,
-					     0,
-					     file_offset + record_values->chunk_data_offset,
-					     (size64_t) chunk_index,
-					     0,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to append element to records list.",
-						 function );
-
-						goto on_error;
-					}
-				}
-				else
-				{
-					/* If the file is not dirty, records found in chunks outside the indicated
-					 * range are considered recovered
-					 */
-					if( libfdata_list_append_element(
-					     internal_file->recovered_records_list,
-					     &element_index,
-					     0,
-					     file_offset + record_values->chunk_data_offset,
-					     (size64_t) chunk_index,
-					     0,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to append element to recovered records list.",
-						 function );
-
-						goto on_error;
-					}
-				}
-/* TODO cache record values ? */
+	while( ( file_offset + internal_file->io_handle->chunk_size ) <= (off64_t) file_size )
+	{
+		result = libevtx_file_read_chunk_records(
+		          internal_file,
+		          file_io_handle,
+		          file_offset,
+		          chunk_index,
+		          0,
+		          &previous_record_identifier,
+		          &chunk,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu32 " records.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( ( chunk_index < internal_file->io_handle->number_of_chunks )
+			 || ( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) == 0 ) )
+			{
+				number_of_chunks++;
 			}
-			if( libevtx_chunk_get_number_of_recovered_records(
-			     chunk,
-			     &number_of_records,
+		}
+		file_offset += chunk->data_size;
+
+		if( result != 0 )
+		{
+			/* Hand the parsed chunk to the chunks cache so that the chunks
+			 * read last do not need to be read and parsed again on first access
+			 */
+			if( libfdata_vector_set_element_value_by_index(
+			     internal_file->chunks_vector,
+			     (intptr_t *) file_io_handle,
+			     (libfdata_cache_t *) internal_file->chunks_cache,
+			     (int) chunk_index,
+			     (intptr_t *) chunk,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_free,
+			     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve chunk: %" PRIu16 " number of recovered records.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set chunk: %" PRIu32 " in chunks cache.",
 				 function,
 				 chunk_index );
 
 				goto on_error;
 			}
-			for( record_index = 0;
-			     record_index < number_of_records;
-			     record_index++ )
-			{
-				if( libevtx_chunk_get_recovered_record(
-				     chunk,
-				     record_index,
-				     &record_values,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve chunk: %" PRIu16 " recovered record: %" PRIu16 ".",
-					 function,
-					 chunk_index,
-					 record_index );
-
-					goto on_error;
-				}
-				if( record_values == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing chunk: %" PRIu16 " recovered record: %" PRIu16 ".",
-					 function,
-					 chunk_index,
-					 record_index );
-
-					goto on_error;
-				}
-/* TODO check for and remove duplicate identifiers ? */
-				/* The chunk index is stored in the element data size
-				 */
-				if( libfdata_list_append_element(
-				     internal_file->recovered_records_list,
-				     &element_index,
-				     0,
-				     file_offset + record_values->chunk_data_offset,
-				     (size64_t) chunk_index,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append element to recovered records list.",
-					 function );
-
-					goto on_error;
-				}
-			}
+			/* The chunk is now managed by the chunks cache
+			 */
+			chunk = NULL;
 		}
-		file_offset += chunk->data_size;
-
-		if( libevtx_chunk_free(
-		     &chunk,
-		     error ) != 1 )
+		else if( libevtx_chunk_free(
+		          &chunk,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free chunk: %" PRIu16 ".",
+			 "%s: unable to free chunk: %" PRIu32 ".",
 			 function,
 			 chunk_index );
 
@@ -1422,6 +1656,42 @@ int libevtx_file_open_read(
 		}
 		chunk_index++;
 	}
+	if( read_ahead_set != 0 )
+	{
+		internal_file->io_handle->flags &= (uint8_t) ~( LIBEVTX_IO_HANDLE_FLAG_READ_AHEAD );
+
+		read_ahead_set = 0;
+	}
+	/* The read-ahead buffer is emptied after the scan, also when read-ahead
+	 * was requested by the caller, so that an open file does not hold it
+	 * until its records are read
+	 */
+	if( libevtx_io_handle_empty_read_ahead_buffer(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty read-ahead buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_record_index_sort_ranges(
+	     internal_file->records_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sort records index ranges.",
+		 function );
+
+		goto on_error;
+	}
 	internal_file->io_handle->chunks_data_size = file_offset
 	                                           - internal_file->io_handle->chunks_data_offset;
 
@@ -1431,7 +1701,7 @@ int libevtx_file_open_read(
 		if( libcnotify_verbose != 0 )
 		{
 			libcnotify_printf(
-			 "%s: mismatch in number of chunks ( %" PRIu16 " != %" PRIu16 " ).\n",
+			 "%s: mismatch in number of chunks ( %" PRIu32 " != %" PRIu32 " ).\n",
 			 function,
 			 internal_file->io_handle->number_of_chunks,
 			 chunk_index );
@@ -1457,8 +1727,8 @@ int libevtx_file_open_read(
 
 				goto on_error;
 			}
-			trailing_data = (uint8_t *) memory_allocate(
-			                             sizeof( uint8_t ) * trailing_data_size );
+			trailing_data = (uint8_t *) libevtx_memory_allocate(
+			                                     sizeof( uint8_t ) * trailing_data_size );
 
 			if( trailing_data == NULL )
 			{
@@ -1498,64 +1768,413 @@ int libevtx_file_open_read(
 			 trailing_data_size,
 			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 
-			memory_free(
+			libevtx_memory_free(
 			 trailing_data );
 
-			trailing_data = NULL;
+			trailing_data = NULL;
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( trailing_data != NULL )
+	{
+		libevtx_memory_free(
+		 trailing_data );
+	}
+#endif
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	if( read_ahead_set != 0 )
+	{
+		internal_file->io_handle->flags &= (uint8_t) ~( LIBEVTX_IO_HANDLE_FLAG_READ_AHEAD );
+
+		libevtx_io_handle_empty_read_ahead_buffer(
+		 internal_file->io_handle,
+		 NULL );
+	}
+	if( internal_file->records_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->records_cache ),
+		 NULL );
+	}
+	if( internal_file->recovered_records_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &( internal_file->recovered_records_index ),
+		 NULL );
+	}
+	if( internal_file->records_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &( internal_file->records_index ),
+		 NULL );
+	}
+	if( internal_file->chunks_table != NULL )
+	{
+		libevtx_chunks_table_free(
+		 &( internal_file->chunks_table ),
+		 NULL );
+	}
+	if( internal_file->chunks_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->chunks_cache ),
+		 NULL );
+	}
+	if( internal_file->chunks_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &( internal_file->chunks_vector ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the recovered records that were deferred at open time
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_read_recovered_records(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk              = NULL;
+	static char *function               = "libevtx_file_read_recovered_records";
+	off64_t chunks_data_end_offset      = 0;
+	off64_t file_offset                 = 0;
+	uint64_t previous_record_identifier = 0;
+	uint32_t chunk_index                = 0;
+	uint8_t read_ahead_set              = 0;
+	int result                          = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_LAZY_RECOVERY ) == 0 )
+	{
+		return( 1 );
+	}
+	/* From here on chunks are read including their free space, hence chunks
+	 * that were cached without their recovered records need to be re-read
+	 */
+	internal_file->io_handle->flags &= (uint8_t) ~( LIBEVTX_IO_HANDLE_FLAG_SKIP_RECOVERY );
+
+	if( libfcache_cache_empty(
+	     internal_file->chunks_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to empty chunks cache.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunks are scanned sequentially, hence they are read in batches
+	 */
+	if( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_READ_AHEAD ) == 0 )
+	{
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_READ_AHEAD;
+
+		read_ahead_set = 1;
+	}
+	file_offset            = internal_file->io_handle->chunks_data_offset;
+	chunks_data_end_offset = file_offset + (off64_t) internal_file->io_handle->chunks_data_size;
+
+	internal_file->io_handle->next_chunk_data_offset = file_offset;
+
+	while( ( file_offset + internal_file->io_handle->chunk_size ) <= chunks_data_end_offset )
+	{
+		result = libevtx_file_read_chunk_records(
+		          internal_file,
+		          internal_file->file_io_handle,
+		          file_offset,
+		          chunk_index,
+		          1,
+		          &previous_record_identifier,
+		          &chunk,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu32 " records.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		file_offset += chunk->data_size;
+
+		if( libevtx_chunk_free(
+		     &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk: %" PRIu32 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
 		}
+		chunk_index++;
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	if( read_ahead_set != 0 )
+	{
+		internal_file->io_handle->flags &= (uint8_t) ~( LIBEVTX_IO_HANDLE_FLAG_READ_AHEAD );
+
+		read_ahead_set = 0;
+	}
+	/* The read-ahead buffer is emptied after the scan, also when read-ahead
+	 * was requested by the caller, so that an open file does not hold it
+	 * until its records are read
+	 */
+	if( libevtx_io_handle_empty_read_ahead_buffer(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty read-ahead buffer.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->flags &= (uint8_t) ~( LIBEVTX_IO_HANDLE_FLAG_LAZY_RECOVERY );
 
 	return( 1 );
 
 on_error:
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( trailing_data != NULL )
-	{
-		memory_free(
-		 trailing_data );
-	}
-#endif
 	if( chunk != NULL )
 	{
 		libevtx_chunk_free(
 		 &chunk,
 		 NULL );
 	}
-	if( internal_file->records_cache != NULL )
+	if( read_ahead_set != 0 )
 	{
-		libfcache_cache_free(
-		 &( internal_file->records_cache ),
+		internal_file->io_handle->flags &= (uint8_t) ~( LIBEVTX_IO_HANDLE_FLAG_READ_AHEAD );
+
+		libevtx_io_handle_empty_read_ahead_buffer(
+		 internal_file->io_handle,
 		 NULL );
 	}
-	if( internal_file->recovered_records_list != NULL )
+	/* Discard the partially read recovered records so that a next call can retry
+	 */
+	libevtx_record_index_empty(
+	 internal_file->recovered_records_index,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the record values of a specific record index entry
+ * The record values are cached in the records cache using the offset
+ * of the record as identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_record_values_by_index(
+     libevtx_internal_file_t *internal_file,
+     libevtx_record_index_t *record_index,
+     int entry_index,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *safe_record_values = NULL;
+	libfcache_cache_value_t *cache_value        = NULL;
+	static char *function                       = "libevtx_file_get_record_values_by_index";
+	off64_t record_offset                       = 0;
+	uint32_t chunk_data_offset                  = 0;
+	uint32_t chunk_index                        = 0;
+	int result                                  = 0;
+
+	if( internal_file == NULL )
 	{
-		libfdata_list_free(
-		 &( internal_file->recovered_records_list ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_file->records_list != NULL )
+	if( internal_file->io_handle == NULL )
 	{
-		libfdata_list_free(
-		 &( internal_file->records_list ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( chunks_table != NULL )
+	if( record_values == NULL )
 	{
-		libevtx_chunks_table_free(
-		 &chunks_table,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_file->chunks_cache != NULL )
+	if( libevtx_record_index_get_entry_by_index(
+	     record_index,
+	     entry_index,
+	     &chunk_index,
+	     &chunk_data_offset,
+	     error ) != 1 )
 	{
-		libfcache_cache_free(
-		 &( internal_file->chunks_cache ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record index entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
 	}
-	if( internal_file->chunks_vector != NULL )
+	record_offset = internal_file->io_handle->chunks_data_offset
+	              + ( (off64_t) chunk_index * internal_file->io_handle->chunk_size )
+	              + chunk_data_offset;
+
+	result = libfcache_cache_get_value_by_identifier(
+	          internal_file->records_cache,
+	          0,
+	          record_offset,
+	          0,
+	          &cache_value,
+	          error );
+
+	if( result == -1 )
 	{
-		libfdata_vector_free(
-		 &( internal_file->chunks_vector ),
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from records cache.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfcache_cache_value_get_value(
+		     cache_value,
+		     (intptr_t **) record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record values from cache value.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libevtx_chunks_table_read_record_values(
+	     internal_file->chunks_table,
+	     internal_file->file_io_handle,
+	     chunk_index,
+	     chunk_data_offset,
+	     &safe_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record values at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 record_offset,
+		 record_offset );
+
+		goto on_error;
+	}
+	if( libfcache_cache_set_value_by_index(
+	     internal_file->records_cache,
+	     entry_index % LIBEVTX_MAXIMUM_CACHE_ENTRIES_RECORDS,
+	     0,
+	     record_offset,
+	     0,
+	     (intptr_t *) safe_record_values,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_record_values_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set record values in records cache.",
+		 function );
+
+		goto on_error;
+	}
+	*record_values = safe_record_values;
+
+	return( 1 );
+
+on_error:
+	if( safe_record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &safe_record_values,
 		 NULL );
 	}
 	return( -1 );
@@ -1921,8 +2540,8 @@ int libevtx_file_get_number_of_records(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( libfdata_list_get_number_of_elements(
-	     internal_file->records_list,
+	if( libevtx_record_index_get_number_of_entries(
+	     internal_file->records_index,
 	     number_of_records,
 	     error ) != 1 )
 	{
@@ -1975,13 +2594,11 @@ int libevtx_file_get_record(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
+	if( libevtx_file_get_record_values_by_index(
+	     internal_file,
+	     internal_file->records_index,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     &record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2051,13 +2668,11 @@ int libevtx_file_get_record_by_index(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
+	if( libevtx_file_get_record_values_by_index(
+	     internal_file,
+	     internal_file->records_index,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     &record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2090,6 +2705,99 @@ int libevtx_file_get_record_by_index(
 	return( 1 );
 }
 
+/* Retrieves a specific record in logical order
+ * The logical order is the event record number order, which is determined from
+ * the chunk ranges of the records index hence the records are not sorted individually
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_record_by_logical_index(
+     libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_file_get_record_by_logical_index";
+	int entry_index                        = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_index_get_entry_index_by_logical_index(
+	     internal_file->records_index,
+	     record_index,
+	     &entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry index of logical index: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_record_values_by_index(
+	     internal_file,
+	     internal_file->records_index,
+	     entry_index,
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( libevtx_record_initialize(
+	     record,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     record_values,
+	     LIBEVTX_RECORD_FLAGS_DEFAULT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of recovered records
  * Returns 1 if successful or -1 on error
  */
@@ -2114,8 +2822,25 @@ int libevtx_file_get_number_of_recovered_records(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( libfdata_list_get_number_of_elements(
-	     internal_file->recovered_records_list,
+	if( ( internal_file->io_handle != NULL )
+	 && ( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_LAZY_RECOVERY ) != 0 ) )
+	{
+		if( libevtx_file_read_recovered_records(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read recovered records.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_record_index_get_number_of_entries(
+	     internal_file->recovered_records_index,
 	     number_of_records,
 	     error ) != 1 )
 	{
@@ -2168,13 +2893,28 @@ int libevtx_file_get_recovered_record(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->recovered_records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
+	if( ( internal_file->io_handle != NULL )
+	 && ( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_LAZY_RECOVERY ) != 0 ) )
+	{
+		if( libevtx_file_read_recovered_records(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read recovered records.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_file_get_record_values_by_index(
+	     internal_file,
+	     internal_file->recovered_records_index,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     &record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2244,13 +2984,28 @@ int libevtx_file_get_recovered_record_by_index(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->recovered_records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
+	if( ( internal_file->io_handle != NULL )
+	 && ( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_LAZY_RECOVERY ) != 0 ) )
+	{
+		if( libevtx_file_read_recovered_records(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read recovered records.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_file_get_record_values_by_index(
+	     internal_file,
+	     internal_file->recovered_records_index,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     &record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
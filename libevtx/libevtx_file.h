@@ -25,12 +25,16 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevtx_chunk.h"
+#include "libevtx_chunks_table.h"
 #include "libevtx_extern.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_record_index.h"
+#include "libevtx_record_values.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -64,13 +68,17 @@ struct libevtx_internal_file
 	 */
 	libfcache_cache_t *chunks_cache;
 
-	/* The records list
+	/* The chunks table
 	 */
-	libfdata_list_t *records_list;
+	libevtx_chunks_table_t *chunks_table;
 
-	/* The recovered records list
+	/* The records index
 	 */
-	libfdata_list_t *recovered_records_list;
+	libevtx_record_index_t *records_index;
+
+	/* The recovered records index
+	 */
+	libevtx_record_index_t *recovered_records_index;
 
 	/* The records cache
 	 */
@@ -122,11 +130,32 @@ int libevtx_file_close(
      libevtx_file_t *file,
      libcerror_error_t **error );
 
+int libevtx_file_read_chunk_records(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t chunk_index,
+     uint8_t read_recovered_only,
+     uint64_t *previous_record_identifier,
+     libevtx_chunk_t **chunk,
+     libcerror_error_t **error );
+
 int libevtx_file_open_read(
      libevtx_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libevtx_file_read_recovered_records(
+     libevtx_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libevtx_file_get_record_values_by_index(
+     libevtx_internal_file_t *internal_file,
+     libevtx_record_index_t *record_index,
+     int entry_index,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_file_is_corrupted(
      libevtx_file_t *file,
@@ -184,6 +213,13 @@ int libevtx_file_get_record_by_index(
      libevtx_record_t **record,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_file_get_record_by_logical_index(
+     libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_file_get_number_of_recovered_records(
      libevtx_file_t *file,
@@ -34,6 +34,7 @@
 #include "libevtx_libcerror.h"
 #include "libevtx_libcnotify.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_memory.h"
 #include "libevtx_unused.h"
 
 #include "evtx_file_header.h"
@@ -72,8 +73,8 @@ int libevtx_io_handle_initialize(
 
 		return( -1 );
 	}
-	*io_handle = memory_allocate_structure(
-	              libevtx_io_handle_t );
+	*io_handle = libevtx_memory_allocate_structure(
+	                      libevtx_io_handle_t );
 
 	if( *io_handle == NULL )
 	{
@@ -108,7 +109,7 @@ int libevtx_io_handle_initialize(
 on_error:
 	if( *io_handle != NULL )
 	{
-		memory_free(
+		libevtx_memory_free(
 		 *io_handle );
 
 		*io_handle = NULL;
@@ -139,7 +140,20 @@ int libevtx_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
-		memory_free(
+		if( libevtx_io_handle_empty_read_ahead_buffer(
+		     *io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty read-ahead buffer.",
+			 function );
+
+			result = -1;
+		}
+		libevtx_memory_free(
 		 *io_handle );
 
 		*io_handle = NULL;
@@ -167,6 +181,19 @@ int libevtx_io_handle_clear(
 
 		return( -1 );
 	}
+	if( libevtx_io_handle_empty_read_ahead_buffer(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty read-ahead buffer.",
+		 function );
+
+		return( -1 );
+	}
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -187,28 +214,59 @@ int libevtx_io_handle_clear(
 	return( 1 );
 }
 
-/* Reads the file (or database) header
+/* Frees the read-ahead buffer
  * Returns 1 if successful or -1 on error
  */
-int libevtx_io_handle_read_file_header(
+int libevtx_io_handle_empty_read_ahead_buffer(
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_io_handle_empty_read_ahead_buffer";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->read_ahead_buffer != NULL )
+	{
+		libevtx_memory_free(
+		 io_handle->read_ahead_buffer );
+
+		io_handle->read_ahead_buffer = NULL;
+	}
+	io_handle->read_ahead_buffer_size = 0;
+	io_handle->read_ahead_file_offset = 0;
+	io_handle->read_ahead_data_size   = 0;
+
+	return( 1 );
+}
+
+/* Reads chunk data
+ * If read-ahead is enabled and the chunk data directly follows the previously
+ * read chunk data, multiple chunks are read at once into the read-ahead buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libevtx_io_handle_read_chunk_data(
      libevtx_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
-	uint8_t *file_header_data    = NULL;
-	static char *function        = "libevtx_io_handle_read_file_header";
-	size_t read_size             = 4096;
-	ssize_t read_count           = 0;
-	uint32_t calculated_checksum = 0;
-	uint32_t stored_checksum     = 0;
-	uint16_t first_chunk_number  = 0;
-	uint16_t last_chunk_number   = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit         = 0;
-	uint32_t value_32bit         = 0;
-#endif
+	void *reallocation         = NULL;
+	static char *function      = "libevtx_io_handle_read_chunk_data";
+	size_t buffer_offset       = 0;
+	size_t buffer_size         = 0;
+	size_t maximum_buffer_size = 0;
+	ssize_t read_count         = 0;
 
 	if( io_handle == NULL )
 	{
@@ -221,49 +279,253 @@ int libevtx_io_handle_read_file_header(
 
 		return( -1 );
 	}
-	file_header_data = (uint8_t *) memory_allocate(
-	                                sizeof( uint8_t ) * read_size );
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
 
-	if( file_header_data == NULL )
+		return( -1 );
+	}
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create file header data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( data_size > (size_t) SSIZE_MAX )
 	{
-		libcnotify_printf(
-		 "%s: reading file header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 file_offset,
-		 file_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_READ_AHEAD ) != 0 )
+	{
+		if( ( io_handle->read_ahead_buffer != NULL )
+		 && ( file_offset >= io_handle->read_ahead_file_offset )
+		 && ( ( file_offset - io_handle->read_ahead_file_offset ) < (off64_t) io_handle->read_ahead_data_size ) )
+		{
+			buffer_offset = (size_t) ( file_offset - io_handle->read_ahead_file_offset );
+
+			if( data_size <= ( io_handle->read_ahead_data_size - buffer_offset ) )
+			{
+				if( memory_copy(
+				     data,
+				     &( io_handle->read_ahead_buffer[ buffer_offset ] ),
+				     data_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy read-ahead data.",
+					 function );
+
+					return( -1 );
+				}
+				io_handle->next_chunk_data_offset = file_offset + data_size;
+
+				return( (ssize_t) data_size );
+			}
+		}
+		if( ( file_offset != 0 )
+		 && ( file_offset == io_handle->next_chunk_data_offset ) )
+		{
+			/* The read-ahead buffer is sized lazily, it starts at 2 chunks
+			 * and doubles on every sequential refill up to
+			 * LIBEVTX_READ_AHEAD_NUMBER_OF_CHUNKS chunks, so that a file
+			 * that is kept open but read sparsely holds little memory
+			 */
+			maximum_buffer_size = (size_t) io_handle->chunk_size * LIBEVTX_READ_AHEAD_NUMBER_OF_CHUNKS;
+
+			if( io_handle->read_ahead_buffer == NULL )
+			{
+				buffer_size = (size_t) io_handle->chunk_size * 2;
+			}
+			else
+			{
+				buffer_size = io_handle->read_ahead_buffer_size * 2;
+			}
+			if( buffer_size > maximum_buffer_size )
+			{
+				buffer_size = maximum_buffer_size;
+			}
+			if( buffer_size < data_size )
+			{
+				buffer_size = data_size;
+			}
+			if( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid read-ahead buffer size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( buffer_size != io_handle->read_ahead_buffer_size )
+			{
+				reallocation = libevtx_memory_reallocate(
+				                io_handle->read_ahead_buffer,
+				                sizeof( uint8_t ) * buffer_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize read-ahead buffer.",
+					 function );
+
+					return( -1 );
+				}
+				io_handle->read_ahead_buffer      = (uint8_t *) reallocation;
+				io_handle->read_ahead_buffer_size = buffer_size;
+			}
+			io_handle->read_ahead_data_size = 0;
+
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              io_handle->read_ahead_buffer,
+			              io_handle->read_ahead_buffer_size,
+			              file_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read ahead data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				return( -1 );
+			}
+			io_handle->read_ahead_file_offset = file_offset;
+			io_handle->read_ahead_data_size   = (size_t) read_count;
+
+			if( (size_t) read_count > data_size )
+			{
+				read_count = (ssize_t) data_size;
+			}
+			if( memory_copy(
+			     data,
+			     io_handle->read_ahead_buffer,
+			     (size_t) read_count ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy read-ahead data.",
+				 function );
+
+				return( -1 );
+			}
+			io_handle->next_chunk_data_offset = file_offset + read_count;
+
+			return( read_count );
+		}
 	}
-#endif
 	read_count = libbfio_handle_read_buffer_at_offset(
 	              file_io_handle,
-	              file_header_data,
-	              read_size,
+	              data,
+	              data_size,
 	              file_offset,
 	              error );
 
-	if( read_count != (ssize_t) read_size )
+	if( read_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
 		 file_offset,
 		 file_offset );
 
-		goto on_error;
+		return( -1 );
+	}
+	io_handle->next_chunk_data_offset = file_offset + read_count;
+
+	return( read_count );
+}
+
+/* Reads the file (or database) header data
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_io_handle_read_file_header_data(
+     libevtx_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function                = "libevtx_io_handle_read_file_header_data";
+	uint64_t calculated_number_of_chunks = 0;
+	uint64_t first_chunk_number          = 0;
+	uint64_t last_chunk_number           = 0;
+	uint32_t calculated_checksum         = 0;
+	uint32_t stored_checksum             = 0;
+	uint16_t number_of_chunks            = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint64_t value_64bit                 = 0;
+	uint32_t value_32bit                 = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( evtx_file_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -272,13 +534,13 @@ int libevtx_io_handle_read_file_header(
 		 "%s: file header data:\n",
 		 function );
 		libcnotify_print_data(
-		 file_header_data,
+		 data,
 		 sizeof( evtx_file_header_t ),
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
 	if( memory_compare(
-	     ( (evtx_file_header_t *) file_header_data )->signature,
+	     ( (evtx_file_header_t *) data )->signature,
 	     evtx_file_signature,
 	     8 ) != 0 )
 	{
@@ -289,38 +551,38 @@ int libevtx_io_handle_read_file_header(
 		 "%s: unsupported file signature.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	byte_stream_copy_to_uint64_little_endian(
-	 ( (evtx_file_header_t *) file_header_data )->first_chunk_number,
+	 ( (evtx_file_header_t *) data )->first_chunk_number,
 	 first_chunk_number );
 
 	byte_stream_copy_to_uint64_little_endian(
-	 ( (evtx_file_header_t *) file_header_data )->last_chunk_number,
+	 ( (evtx_file_header_t *) data )->last_chunk_number,
 	 last_chunk_number );
 
 	byte_stream_copy_to_uint16_little_endian(
-	 ( (evtx_file_header_t *) file_header_data )->minor_version,
+	 ( (evtx_file_header_t *) data )->minor_version,
 	 io_handle->minor_version );
 
 	byte_stream_copy_to_uint16_little_endian(
-	 ( (evtx_file_header_t *) file_header_data )->major_version,
+	 ( (evtx_file_header_t *) data )->major_version,
 	 io_handle->major_version );
 
 	byte_stream_copy_to_uint16_little_endian(
-	 ( (evtx_file_header_t *) file_header_data )->header_block_size,
+	 ( (evtx_file_header_t *) data )->header_block_size,
 	 io_handle->chunks_data_offset );
 
 	byte_stream_copy_to_uint16_little_endian(
-	 ( (evtx_file_header_t *) file_header_data )->number_of_chunks,
-	 io_handle->number_of_chunks );
+	 ( (evtx_file_header_t *) data )->number_of_chunks,
+	 number_of_chunks );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 ( (evtx_file_header_t *) file_header_data )->file_flags,
+	 ( (evtx_file_header_t *) data )->file_flags,
 	 io_handle->file_flags );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 ( (evtx_file_header_t *) file_header_data )->checksum,
+	 ( (evtx_file_header_t *) data )->checksum,
 	 stored_checksum );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -329,14 +591,14 @@ int libevtx_io_handle_read_file_header(
 		libcnotify_printf(
 		 "%s: signature\t\t\t\t: %c%c%c%c%c%c%c\\x%02x\n",
 		 function,
-		 ( (evtx_file_header_t *) file_header_data )->signature[ 0 ],
-		 ( (evtx_file_header_t *) file_header_data )->signature[ 1 ],
-		 ( (evtx_file_header_t *) file_header_data )->signature[ 2 ],
-		 ( (evtx_file_header_t *) file_header_data )->signature[ 3 ],
-		 ( (evtx_file_header_t *) file_header_data )->signature[ 4 ],
-		 ( (evtx_file_header_t *) file_header_data )->signature[ 5 ] ,
-		 ( (evtx_file_header_t *) file_header_data )->signature[ 6 ] ,
-		 ( (evtx_file_header_t *) file_header_data )->signature[ 7 ] );
+		 ( (evtx_file_header_t *) data )->signature[ 0 ],
+		 ( (evtx_file_header_t *) data )->signature[ 1 ],
+		 ( (evtx_file_header_t *) data )->signature[ 2 ],
+		 ( (evtx_file_header_t *) data )->signature[ 3 ],
+		 ( (evtx_file_header_t *) data )->signature[ 4 ],
+		 ( (evtx_file_header_t *) data )->signature[ 5 ] ,
+		 ( (evtx_file_header_t *) data )->signature[ 6 ] ,
+		 ( (evtx_file_header_t *) data )->signature[ 7 ] );
 
 		libcnotify_printf(
 		 "%s: first chunk number\t\t\t: %" PRIu64 "\n",
@@ -349,7 +611,7 @@ int libevtx_io_handle_read_file_header(
 		 last_chunk_number );
 
 		byte_stream_copy_to_uint64_little_endian(
-		 ( (evtx_file_header_t *) file_header_data )->next_record_identifier,
+		 ( (evtx_file_header_t *) data )->next_record_identifier,
 		 value_64bit );
 		libcnotify_printf(
 		 "%s: next record identifier\t\t: %" PRIu64 "\n",
@@ -357,7 +619,7 @@ int libevtx_io_handle_read_file_header(
 		 value_64bit );
 
 		byte_stream_copy_to_uint32_little_endian(
-		 ( (evtx_file_header_t *) file_header_data )->header_size,
+		 ( (evtx_file_header_t *) data )->header_size,
 		 value_32bit );
 		libcnotify_printf(
 		 "%s: header size\t\t\t\t: %" PRIu32 "\n",
@@ -382,13 +644,13 @@ int libevtx_io_handle_read_file_header(
 		libcnotify_printf(
 		 "%s: number of chunks\t\t\t: %" PRIu16 "\n",
 		 function,
-		 io_handle->number_of_chunks );
+		 number_of_chunks );
 
 		libcnotify_printf(
 		 "%s: unknown1:\n",
 		 function );
 		libcnotify_print_data(
-		 ( (evtx_file_header_t *) file_header_data )->unknown1,
+		 ( (evtx_file_header_t *) data )->unknown1,
 		 76,
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 
@@ -413,7 +675,7 @@ int libevtx_io_handle_read_file_header(
 
 	if( libevtx_checksum_calculate_little_endian_crc32(
 	     &calculated_checksum,
-	     file_header_data,
+	     (uint8_t *) data,
 	     120,
 	     0,
 	     error ) != 1 )
@@ -425,7 +687,7 @@ int libevtx_io_handle_read_file_header(
 		 "%s: unable to calculate CRC-32 checksum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( stored_checksum != calculated_checksum )
 	{
@@ -448,40 +710,143 @@ int libevtx_io_handle_read_file_header(
 		 "%s: trailing data:\n",
 		 function );
 		libcnotify_print_data(
-		 &( file_header_data[ sizeof( evtx_file_header_t ) ] ),
-		 read_size - sizeof( evtx_file_header_t ),
+		 &( data[ sizeof( evtx_file_header_t ) ] ),
+		 data_size - sizeof( evtx_file_header_t ),
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
+	io_handle->number_of_chunks = (uint32_t) number_of_chunks;
+
 	if( first_chunk_number > last_chunk_number )
 	{
 #if defined( HAVE_VERBOSE_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
 			libcnotify_printf(
-			 "%s: first chunk number: %" PRIu16 " exceeds last chunk number: %" PRIu16 ".\n",
+			 "%s: first chunk number: %" PRIu64 " exceeds last chunk number: %" PRIu64 ".\n",
 			 function,
 			 first_chunk_number,
 			 last_chunk_number );
 		}
 #endif
 		io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+
+		return( 1 );
 	}
-	else if( io_handle->number_of_chunks != ( last_chunk_number - first_chunk_number + 1 ) )
+	calculated_number_of_chunks = last_chunk_number - first_chunk_number + 1;
+
+	/* The number of chunks in the file header is a 16-bit value that wraps
+	 * in files that contain more than 65535 chunks, in which case the number
+	 * of chunks is determined from the first and last chunk numbers
+	 */
+	if( ( calculated_number_of_chunks > (uint64_t) UINT16_MAX )
+	 && ( calculated_number_of_chunks <= (uint64_t) UINT32_MAX )
+	 && ( (uint16_t) calculated_number_of_chunks == number_of_chunks ) )
+	{
+		io_handle->number_of_chunks = (uint32_t) calculated_number_of_chunks;
+	}
+	else if( calculated_number_of_chunks != (uint64_t) number_of_chunks )
 	{
 #if defined( HAVE_VERBOSE_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
 			libcnotify_printf(
-			 "%s: mismatch in number of chunks ( %" PRIu16 " != %" PRIu16 " ).\n",
+			 "%s: mismatch in number of chunks ( %" PRIu16 " != %" PRIu64 " ).\n",
 			 function,
-			 io_handle->number_of_chunks,
-			 last_chunk_number - first_chunk_number + 1 );
+			 number_of_chunks,
+			 calculated_number_of_chunks );
 		}
 #endif
 		io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
 	}
-	memory_free(
+	return( 1 );
+}
+
+/* Reads the file (or database) header
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_io_handle_read_file_header(
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *file_header_data = NULL;
+	static char *function     = "libevtx_io_handle_read_file_header";
+	size_t read_size          = 4096;
+	ssize_t read_count        = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_header_data = (uint8_t *) libevtx_memory_allocate(
+	                                        sizeof( uint8_t ) * read_size );
+
+	if( file_header_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file header data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading file header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              file_header_data,
+	              read_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( libevtx_io_handle_read_file_header_data(
+	     io_handle,
+	     file_header_data,
+	     read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	libevtx_memory_free(
 	 file_header_data );
 
 	file_header_data = NULL;
@@ -491,7 +856,7 @@ int libevtx_io_handle_read_file_header(
 on_error:
 	if( file_header_data != NULL )
 	{
-		memory_free(
+		libevtx_memory_free(
 		 file_header_data );
 	}
 	return( -1 );
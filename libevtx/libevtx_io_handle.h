@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevtx_definitions.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libfdata.h"
@@ -49,7 +50,7 @@ struct libevtx_io_handle
 
 	/* The number of chunks
 	 */
-	uint16_t number_of_chunks;
+	uint32_t number_of_chunks;
 
 	/* The chunks data offset
 	 */
@@ -86,6 +87,26 @@ struct libevtx_io_handle
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+	/* The read-ahead buffer
+	 */
+	uint8_t *read_ahead_buffer;
+
+	/* The read-ahead buffer size
+	 */
+	size_t read_ahead_buffer_size;
+
+	/* The file offset of the data in the read-ahead buffer
+	 */
+	off64_t read_ahead_file_offset;
+
+	/* The size of the data in the read-ahead buffer
+	 */
+	size_t read_ahead_data_size;
+
+	/* The file offset directly after the previously read chunk data
+	 */
+	off64_t next_chunk_data_offset;
 };
 
 int libevtx_io_handle_initialize(
@@ -100,6 +121,24 @@ int libevtx_io_handle_clear(
      libevtx_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libevtx_io_handle_empty_read_ahead_buffer(
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+ssize_t libevtx_io_handle_read_chunk_data(
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_io_handle_read_file_header_data(
+     libevtx_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libevtx_io_handle_read_file_header(
      libevtx_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
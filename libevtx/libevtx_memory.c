@@ -0,0 +1,172 @@
+/*
+ * Memory functions
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_memory.h"
+
+/* The user provided memory functions, NULL when the default functions are used
+ */
+static void *(*libevtx_memory_allocate_function)(
+               void *context,
+               size_t size ) = NULL;
+
+static void *(*libevtx_memory_reallocate_function)(
+               void *context,
+               void *buffer,
+               size_t size ) = NULL;
+
+static void (*libevtx_memory_free_function)(
+              void *context,
+              void *buffer ) = NULL;
+
+static void *libevtx_memory_functions_context = NULL;
+
+/* Sets the memory functions
+ * The functions must be set before any library object is created and
+ * must not be changed while library objects exist
+ * All functions NULL restores the default memory functions
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_set_memory_functions(
+     void *(*allocate_function)(
+            void *context,
+            size_t size ),
+     void *(*reallocate_function)(
+            void *context,
+            void *buffer,
+            size_t size ),
+     void (*free_function)(
+            void *context,
+            void *buffer ),
+     void *context,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_set_memory_functions";
+
+	if( ( allocate_function == NULL )
+	 && ( reallocate_function == NULL )
+	 && ( free_function == NULL ) )
+	{
+		libevtx_memory_allocate_function   = NULL;
+		libevtx_memory_reallocate_function = NULL;
+		libevtx_memory_free_function       = NULL;
+		libevtx_memory_functions_context   = NULL;
+
+		return( 1 );
+	}
+	if( allocate_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocate function.",
+		 function );
+
+		return( -1 );
+	}
+	if( reallocate_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reallocate function.",
+		 function );
+
+		return( -1 );
+	}
+	if( free_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free function.",
+		 function );
+
+		return( -1 );
+	}
+	libevtx_memory_allocate_function   = allocate_function;
+	libevtx_memory_reallocate_function = reallocate_function;
+	libevtx_memory_free_function       = free_function;
+	libevtx_memory_functions_context   = context;
+
+	return( 1 );
+}
+
+/* Allocates memory
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *libevtx_memory_allocate(
+       size_t size )
+{
+	if( libevtx_memory_allocate_function != NULL )
+	{
+		return( libevtx_memory_allocate_function(
+		         libevtx_memory_functions_context,
+		         size ) );
+	}
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Reallocates memory
+ * Returns a pointer to the reallocated memory or NULL on error
+ */
+void *libevtx_memory_reallocate(
+       void *buffer,
+       size_t size )
+{
+	if( libevtx_memory_reallocate_function != NULL )
+	{
+		return( libevtx_memory_reallocate_function(
+		         libevtx_memory_functions_context,
+		         buffer,
+		         size ) );
+	}
+	return( memory_reallocate(
+	         buffer,
+	         size ) );
+}
+
+/* Frees memory
+ */
+void libevtx_memory_free(
+      void *buffer )
+{
+	if( libevtx_memory_free_function != NULL )
+	{
+		libevtx_memory_free_function(
+		 libevtx_memory_functions_context,
+		 buffer );
+	}
+	else
+	{
+		memory_free(
+		 buffer );
+	}
+}
+
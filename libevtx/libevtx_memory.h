@@ -0,0 +1,68 @@
+/*
+ * Memory functions
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_MEMORY_H )
+#define _LIBEVTX_MEMORY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_extern.h"
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define libevtx_memory_allocate_structure( type ) \
+	(type *) libevtx_memory_allocate( sizeof( type ) )
+
+LIBEVTX_EXTERN \
+int libevtx_set_memory_functions(
+     void *(*allocate_function)(
+            void *context,
+            size_t size ),
+     void *(*reallocate_function)(
+            void *context,
+            void *buffer,
+            size_t size ),
+     void (*free_function)(
+            void *context,
+            void *buffer ),
+     void *context,
+     libcerror_error_t **error );
+
+void *libevtx_memory_allocate(
+       size_t size );
+
+void *libevtx_memory_reallocate(
+       void *buffer,
+       size_t size );
+
+void libevtx_memory_free(
+      void *buffer );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_MEMORY_H ) */
+
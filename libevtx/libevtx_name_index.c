@@ -0,0 +1,863 @@
+/*
+ * Name index functions
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libuna.h"
+#include "libevtx_memory.h"
+#include "libevtx_name_index.h"
+
+/* Calculates the hash of a name
+ * Returns the 32-bit FNV-1a hash of the name
+ */
+uint32_t libevtx_name_index_calculate_hash(
+          const uint8_t *name,
+          size_t name_length )
+{
+	size_t name_index = 0;
+	uint32_t hash     = 0x811c9dc5UL;
+
+	if( name == NULL )
+	{
+		return( hash );
+	}
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		hash ^= name[ name_index ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Calculates the hash of an UTF-16 encoded name
+ * The hash is calculated over the UTF-8 encoding of the name, so that it
+ * matches libevtx_name_index_calculate_hash, without converting the name
+ * into a separate buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_name_index_calculate_utf16_hash(
+     const uint16_t *name,
+     size_t name_length,
+     uint32_t *hash,
+     size_t *utf8_name_length,
+     libcerror_error_t **error )
+{
+	libuna_utf8_character_t utf8_character[ 4 ];
+
+	static char *function                        = "libevtx_name_index_calculate_utf16_hash";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t name_index                            = 0;
+	size_t safe_utf8_name_length                 = 0;
+	size_t utf8_character_index                  = 0;
+	size_t utf8_character_size                   = 0;
+	uint32_t safe_hash                           = 0x811c9dc5UL;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) ( SSIZE_MAX / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name length.",
+		 function );
+
+		return( -1 );
+	}
+	while( name_index < name_length )
+	{
+		if( name[ name_index ] == 0 )
+		{
+			break;
+		}
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     (libuna_utf16_character_t *) name,
+		     name_length,
+		     &name_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_character_size = 0;
+
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     utf8_character,
+		     4,
+		     &utf8_character_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character to UTF-8.",
+			 function );
+
+			return( -1 );
+		}
+		for( utf8_character_index = 0;
+		     utf8_character_index < utf8_character_size;
+		     utf8_character_index++ )
+		{
+			safe_hash ^= utf8_character[ utf8_character_index ];
+			safe_hash *= 0x01000193UL;
+		}
+		safe_utf8_name_length += utf8_character_size;
+	}
+	*hash             = safe_hash;
+	*utf8_name_length = safe_utf8_name_length;
+
+	return( 1 );
+}
+
+/* Compares an UTF-8 encoded name with an UTF-16 encoded name
+ * Returns 1 if the names are equal, 0 if not or -1 on error
+ */
+int libevtx_name_index_compare_utf16_name(
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
+     const uint16_t *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	libuna_utf8_character_t utf8_character[ 4 ];
+
+	static char *function                        = "libevtx_name_index_compare_utf16_name";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t name_index                            = 0;
+	size_t utf8_character_size                   = 0;
+	size_t utf8_name_index                       = 0;
+
+	if( utf8_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	while( name_index < name_length )
+	{
+		if( name[ name_index ] == 0 )
+		{
+			break;
+		}
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     (libuna_utf16_character_t *) name,
+		     name_length,
+		     &name_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_character_size = 0;
+
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     utf8_character,
+		     4,
+		     &utf8_character_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character to UTF-8.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_character_size > ( utf8_name_length - utf8_name_index ) )
+		{
+			return( 0 );
+		}
+		if( memory_compare(
+		     &( utf8_name[ utf8_name_index ] ),
+		     utf8_character,
+		     utf8_character_size ) != 0 )
+		{
+			return( 0 );
+		}
+		utf8_name_index += utf8_character_size;
+	}
+	if( utf8_name_index != utf8_name_length )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Creates a name index
+ * Make sure the value name_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_name_index_initialize(
+     libevtx_name_index_t **name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_name_index_initialize";
+	int bucket_index      = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*name_index = libevtx_memory_allocate_structure(
+	               libevtx_name_index_t );
+
+	if( *name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *name_index,
+	     0,
+	     sizeof( libevtx_name_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name index.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < LIBEVTX_NAME_INDEX_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		( *name_index )->buckets[ bucket_index ] = -1;
+	}
+	( *name_index )->number_of_references = 1;
+
+	return( 1 );
+
+on_error:
+	if( *name_index != NULL )
+	{
+		libevtx_memory_free(
+		 *name_index );
+
+		*name_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a name index
+ * This releases a reference, the name index is freed when the last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_name_index_free(
+     libevtx_name_index_t **name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_name_index_free";
+	int entry_index       = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_index != NULL )
+	{
+		( *name_index )->number_of_references -= 1;
+
+		if( ( *name_index )->number_of_references <= 0 )
+		{
+			if( ( *name_index )->entries != NULL )
+			{
+				for( entry_index = 0;
+				     entry_index < ( *name_index )->number_of_entries;
+				     entry_index++ )
+				{
+					if( ( *name_index )->entries[ entry_index ].name != NULL )
+					{
+						libevtx_memory_free(
+						 ( *name_index )->entries[ entry_index ].name );
+					}
+				}
+				libevtx_memory_free(
+				 ( *name_index )->entries );
+			}
+			libevtx_memory_free(
+			 *name_index );
+		}
+		*name_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Adds a reference to a name index
+ * Every reference must be released with libevtx_name_index_free
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_name_index_add_reference(
+     libevtx_name_index_t *name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_name_index_add_reference";
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index->number_of_references >= INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name index - number of references value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	name_index->number_of_references += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_name_index_get_number_of_entries(
+     libevtx_name_index_t *name_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_name_index_get_number_of_entries";
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = name_index->number_of_entries;
+
+	return( 1 );
+}
+
+/* Appends a name
+ * If the name is already present the first value index is retained
+ * Returns 1 if successful, 0 if the name is already present or -1 on error
+ */
+int libevtx_name_index_append_name(
+     libevtx_name_index_t *name_index,
+     const uint8_t *name,
+     size_t name_length,
+     int value_index,
+     libcerror_error_t **error )
+{
+	libevtx_name_index_entry_t *reallocation = NULL;
+	uint8_t *entry_name                      = NULL;
+	static char *function                    = "libevtx_name_index_append_name";
+	size_t entries_size                      = 0;
+	uint32_t hash                            = 0;
+	int bucket_index                         = 0;
+	int entry_index                          = 0;
+	int existing_value_index                 = 0;
+	int number_of_allocated_entries          = 0;
+	int result                               = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid value index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_name_index_get_value_index_by_utf8_name(
+	          name_index,
+	          name,
+	          name_length,
+	          &existing_value_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if name is already present.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 0 );
+	}
+	if( name_index->number_of_entries >= name_index->number_of_allocated_entries )
+	{
+		if( name_index->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = LIBEVTX_NAME_INDEX_MINIMUM_NUMBER_OF_ENTRIES;
+		}
+		else if( name_index->number_of_allocated_entries <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = name_index->number_of_allocated_entries * 2;
+		}
+		else
+		{
+			number_of_allocated_entries = INT_MAX;
+		}
+		if( number_of_allocated_entries <= name_index->number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libevtx_name_index_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries_size = sizeof( libevtx_name_index_entry_t ) * number_of_allocated_entries;
+
+		reallocation = (libevtx_name_index_entry_t *) libevtx_memory_reallocate(
+		                                               name_index->entries,
+		                                               entries_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		name_index->entries                     = reallocation;
+		name_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	entry_name = (uint8_t *) libevtx_memory_allocate(
+	                          sizeof( uint8_t ) * ( name_length + 1 ) );
+
+	if( entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     entry_name,
+	     name,
+	     sizeof( uint8_t ) * name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry name.",
+		 function );
+
+		libevtx_memory_free(
+		 entry_name );
+
+		return( -1 );
+	}
+	entry_name[ name_length ] = 0;
+
+	hash         = libevtx_name_index_calculate_hash(
+	                name,
+	                name_length );
+	bucket_index = (int) ( hash & ( LIBEVTX_NAME_INDEX_NUMBER_OF_BUCKETS - 1 ) );
+	entry_index  = name_index->number_of_entries;
+
+	name_index->entries[ entry_index ].hash             = hash;
+	name_index->entries[ entry_index ].name             = entry_name;
+	name_index->entries[ entry_index ].name_length      = name_length;
+	name_index->entries[ entry_index ].value_index      = value_index;
+	name_index->entries[ entry_index ].next_entry_index = name_index->buckets[ bucket_index ];
+
+	name_index->buckets[ bucket_index ] = entry_index;
+
+	name_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the value index of a specific UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such name or -1 on error
+ */
+int libevtx_name_index_get_value_index_by_utf8_name(
+     libevtx_name_index_t *name_index,
+     const uint8_t *name,
+     size_t name_length,
+     int *value_index,
+     libcerror_error_t **error )
+{
+	libevtx_name_index_entry_t *entry = NULL;
+	static char *function             = "libevtx_name_index_get_value_index_by_utf8_name";
+	uint32_t hash                     = 0;
+	int entry_index                   = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libevtx_name_index_calculate_hash(
+	        name,
+	        name_length );
+
+	entry_index = name_index->buckets[ hash & ( LIBEVTX_NAME_INDEX_NUMBER_OF_BUCKETS - 1 ) ];
+
+	while( ( entry_index >= 0 )
+	    && ( entry_index < name_index->number_of_entries ) )
+	{
+		entry = &( name_index->entries[ entry_index ] );
+
+		if( ( entry->hash == hash )
+		 && ( entry->name_length == name_length )
+		 && ( memory_compare(
+		       entry->name,
+		       name,
+		       name_length ) == 0 ) )
+		{
+			*value_index = entry->value_index;
+
+			return( 1 );
+		}
+		entry_index = entry->next_entry_index;
+	}
+	return( 0 );
+}
+
+
+/* Retrieves the value index of a specific UTF-16 encoded name
+ * The name is compared in its UTF-16 form, no UTF-8 copy of it is allocated
+ * Returns 1 if successful, 0 if no such name or -1 on error
+ */
+int libevtx_name_index_get_value_index_by_utf16_name(
+     libevtx_name_index_t *name_index,
+     const uint16_t *name,
+     size_t name_length,
+     int *value_index,
+     libcerror_error_t **error )
+{
+	libevtx_name_index_entry_t *entry = NULL;
+	static char *function             = "libevtx_name_index_get_value_index_by_utf16_name";
+	size_t utf8_name_length           = 0;
+	uint32_t hash                     = 0;
+	int entry_index                   = 0;
+	int result                        = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_name_index_calculate_utf16_hash(
+	     name,
+	     name_length,
+	     &hash,
+	     &utf8_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash of UTF-16 name.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = name_index->buckets[ hash & ( LIBEVTX_NAME_INDEX_NUMBER_OF_BUCKETS - 1 ) ];
+
+	while( ( entry_index >= 0 )
+	    && ( entry_index < name_index->number_of_entries ) )
+	{
+		entry = &( name_index->entries[ entry_index ] );
+
+		if( ( entry->hash == hash )
+		 && ( entry->name_length == utf8_name_length ) )
+		{
+			result = libevtx_name_index_compare_utf16_name(
+			          entry->name,
+			          entry->name_length,
+			          name,
+			          name_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare UTF-16 name.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				*value_index = entry->value_index;
+
+				return( 1 );
+			}
+		}
+		entry_index = entry->next_entry_index;
+	}
+	return( 0 );
+}
@@ -0,0 +1,147 @@
+/*
+ * Name index functions
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_NAME_INDEX_H )
+#define _LIBEVTX_NAME_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_name_index_entry libevtx_name_index_entry_t;
+
+struct libevtx_name_index_entry
+{
+	/* The hash of the name
+	 */
+	uint32_t hash;
+
+	/* The UTF-8 encoded name, without the end of string character
+	 */
+	uint8_t *name;
+
+	/* The name length
+	 */
+	size_t name_length;
+
+	/* The value index
+	 */
+	int value_index;
+
+	/* The index of the next entry in the same bucket or -1 if not set
+	 */
+	int next_entry_index;
+};
+
+typedef struct libevtx_name_index libevtx_name_index_t;
+
+struct libevtx_name_index
+{
+	/* The index of the first entry of each bucket or -1 if not set
+	 */
+	int buckets[ LIBEVTX_NAME_INDEX_NUMBER_OF_BUCKETS ];
+
+	/* The entries
+	 */
+	libevtx_name_index_entry_t *entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of references, a name index can be shared by
+	 * a template definition and the records parsed with it
+	 */
+	int number_of_references;
+};
+
+uint32_t libevtx_name_index_calculate_hash(
+          const uint8_t *name,
+          size_t name_length );
+
+int libevtx_name_index_calculate_utf16_hash(
+     const uint16_t *name,
+     size_t name_length,
+     uint32_t *hash,
+     size_t *utf8_name_length,
+     libcerror_error_t **error );
+
+int libevtx_name_index_compare_utf16_name(
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
+     const uint16_t *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libevtx_name_index_initialize(
+     libevtx_name_index_t **name_index,
+     libcerror_error_t **error );
+
+int libevtx_name_index_free(
+     libevtx_name_index_t **name_index,
+     libcerror_error_t **error );
+
+int libevtx_name_index_add_reference(
+     libevtx_name_index_t *name_index,
+     libcerror_error_t **error );
+
+int libevtx_name_index_get_number_of_entries(
+     libevtx_name_index_t *name_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libevtx_name_index_append_name(
+     libevtx_name_index_t *name_index,
+     const uint8_t *name,
+     size_t name_length,
+     int value_index,
+     libcerror_error_t **error );
+
+int libevtx_name_index_get_value_index_by_utf8_name(
+     libevtx_name_index_t *name_index,
+     const uint8_t *name,
+     size_t name_length,
+     int *value_index,
+     libcerror_error_t **error );
+
+int libevtx_name_index_get_value_index_by_utf16_name(
+     libevtx_name_index_t *name_index,
+     const uint16_t *name,
+     size_t name_length,
+     int *value_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_NAME_INDEX_H ) */
+
@@ -27,6 +27,7 @@
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
+#include "libevtx_memory.h"
 #include "libevtx_record.h"
 #include "libevtx_record_values.h"
 
@@ -90,7 +91,7 @@ int libevtx_record_initialize(
 
 		return( -1 );
 	}
-	internal_record = memory_allocate_structure(
+	internal_record = libevtx_memory_allocate_structure(
 	                   libevtx_internal_record_t );
 
 	if( internal_record == NULL )
@@ -116,7 +117,7 @@ int libevtx_record_initialize(
 		 "%s: unable to clear internal record.",
 		 function );
 
-		memory_free(
+		libevtx_memory_free(
 		 internal_record );
 
 		return( -1 );
@@ -156,6 +157,19 @@ int libevtx_record_initialize(
 			goto on_error;
 		}
 	}
+	if( libevtx_record_values_add_reference(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add reference to record values.",
+		 function );
+
+		goto on_error;
+	}
 	internal_record->io_handle     = io_handle;
 	internal_record->record_values = record_values;
 	internal_record->flags         = flags;
@@ -176,7 +190,7 @@ on_error:
 				 NULL );
 			}
 		}
-		memory_free(
+		libevtx_memory_free(
 		 internal_record );
 	}
 	return( -1 );
@@ -191,6 +205,7 @@ int libevtx_record_free(
 {
 	libevtx_internal_record_t *internal_record = NULL;
 	static char *function                      = "libevtx_record_free";
+	int result                                 = 1;
 
 	if( record == NULL )
 	{
@@ -208,7 +223,7 @@ int libevtx_record_free(
 		internal_record = (libevtx_internal_record_t *) *record;
 		*record         = NULL;
 
-		/* The io_handle and record_values references are freed elsewhere
+		/* The io_handle reference is freed elsewhere
 		 */
 		if( ( internal_record->flags & LIBEVTX_RECORD_FLAG_MANAGED_FILE_IO_HANDLE ) != 0 )
 		{
@@ -242,10 +257,26 @@ int libevtx_record_free(
 				}
 			}
 		}
-		memory_free(
+		/* The record holds its own reference to the record values
+		 * since they can be freed by the records cache of the file
+		 */
+		if( libevtx_record_values_free(
+		     &( internal_record->record_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record values.",
+			 function );
+
+			result = -1;
+		}
+		libevtx_memory_free(
 		 internal_record );
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the offset
@@ -615,6 +646,7 @@ int libevtx_record_get_utf8_provider_identifier_size(
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
+	const uint8_t *cached_utf8_string          = NULL;
 	static char *function                      = "libevtx_record_get_utf8_provider_identifier_size";
 	int result                                 = 0;
 
@@ -631,8 +663,25 @@ int libevtx_record_get_utf8_provider_identifier_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_provider_identifier_size(
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
 	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_provider_identifier_size,
+	          &libevtx_record_values_get_utf8_provider_identifier,
+	          &( internal_record->record_values->provider_identifier_value ),
+	          &( internal_record->record_values->utf8_provider_identifier ),
+	          &( internal_record->record_values->utf8_provider_identifier_size ),
+	          &cached_utf8_string,
 	          utf8_string_size,
 	          error );
 
@@ -661,7 +710,124 @@ int libevtx_record_get_utf8_provider_identifier(
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
+	const uint8_t *cached_utf8_string          = NULL;
 	static char *function                      = "libevtx_record_get_utf8_provider_identifier";
+	size_t cached_utf8_string_size             = 0;
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
+	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_provider_identifier_size,
+	          &libevtx_record_values_get_utf8_provider_identifier,
+	          &( internal_record->record_values->provider_identifier_value ),
+	          &( internal_record->record_values->utf8_provider_identifier ),
+	          &( internal_record->record_values->utf8_provider_identifier_size ),
+	          &cached_utf8_string,
+	          &cached_utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string of provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( utf8_string_size < cached_utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf8_string,
+		     cached_utf8_string,
+		     cached_utf8_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy provider identifier to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded provider identifier
+ * The string is converted on first access and cached in the record
+ * The returned size includes the end of string character
+ * The string remains valid until the record is freed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_provider_identifier_reference(
+     libevtx_record_t *record,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_provider_identifier_reference";
 	int result                                 = 0;
 
 	if( record == NULL )
@@ -677,8 +843,24 @@ int libevtx_record_get_utf8_provider_identifier(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_provider_identifier(
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
 	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_provider_identifier_size,
+	          &libevtx_record_values_get_utf8_provider_identifier,
+	          &( internal_record->record_values->provider_identifier_value ),
+	          &( internal_record->record_values->utf8_provider_identifier ),
+	          &( internal_record->record_values->utf8_provider_identifier_size ),
 	          utf8_string,
 	          utf8_string_size,
 	          error );
@@ -688,8 +870,8 @@ int libevtx_record_get_utf8_provider_identifier(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy provider identifier to UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve provider identifier as UTF-8 string.",
 		 function );
 
 		return( -1 );
@@ -799,6 +981,7 @@ int libevtx_record_get_utf8_source_name_size(
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
+	const uint8_t *cached_utf8_string          = NULL;
 	static char *function                      = "libevtx_record_get_utf8_source_name_size";
 	int result                                 = 0;
 
@@ -815,8 +998,25 @@ int libevtx_record_get_utf8_source_name_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_source_name_size(
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
 	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_source_name_size,
+	          &libevtx_record_values_get_utf8_source_name,
+	          &( internal_record->record_values->provider_name_value ),
+	          &( internal_record->record_values->utf8_source_name ),
+	          &( internal_record->record_values->utf8_source_name_size ),
+	          &cached_utf8_string,
 	          utf8_string_size,
 	          error );
 
@@ -845,7 +1045,124 @@ int libevtx_record_get_utf8_source_name(
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
+	const uint8_t *cached_utf8_string          = NULL;
 	static char *function                      = "libevtx_record_get_utf8_source_name";
+	size_t cached_utf8_string_size             = 0;
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
+	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_source_name_size,
+	          &libevtx_record_values_get_utf8_source_name,
+	          &( internal_record->record_values->provider_name_value ),
+	          &( internal_record->record_values->utf8_source_name ),
+	          &( internal_record->record_values->utf8_source_name_size ),
+	          &cached_utf8_string,
+	          &cached_utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string of source name.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( utf8_string_size < cached_utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf8_string,
+		     cached_utf8_string,
+		     cached_utf8_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source name to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded source name
+ * The string is converted on first access and cached in the record
+ * The returned size includes the end of string character
+ * The string remains valid until the record is freed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_source_name_reference(
+     libevtx_record_t *record,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_source_name_reference";
 	int result                                 = 0;
 
 	if( record == NULL )
@@ -861,8 +1178,24 @@ int libevtx_record_get_utf8_source_name(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_source_name(
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
 	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_source_name_size,
+	          &libevtx_record_values_get_utf8_source_name,
+	          &( internal_record->record_values->provider_name_value ),
+	          &( internal_record->record_values->utf8_source_name ),
+	          &( internal_record->record_values->utf8_source_name_size ),
 	          utf8_string,
 	          utf8_string_size,
 	          error );
@@ -872,8 +1205,8 @@ int libevtx_record_get_utf8_source_name(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy source name to UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source name as UTF-8 string.",
 		 function );
 
 		return( -1 );
@@ -983,6 +1316,7 @@ int libevtx_record_get_utf8_channel_name_size(
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
+	const uint8_t *cached_utf8_string          = NULL;
 	static char *function                      = "libevtx_record_get_utf8_channel_name_size";
 	int result                                 = 0;
 
@@ -999,8 +1333,25 @@ int libevtx_record_get_utf8_channel_name_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_channel_name_size(
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
 	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_channel_name_size,
+	          &libevtx_record_values_get_utf8_channel_name,
+	          &( internal_record->record_values->channel_value ),
+	          &( internal_record->record_values->utf8_channel_name ),
+	          &( internal_record->record_values->utf8_channel_name_size ),
+	          &cached_utf8_string,
 	          utf8_string_size,
 	          error );
 
@@ -1029,7 +1380,9 @@ int libevtx_record_get_utf8_channel_name(
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
+	const uint8_t *cached_utf8_string          = NULL;
 	static char *function                      = "libevtx_record_get_utf8_channel_name";
+	size_t cached_utf8_string_size             = 0;
 	int result                                 = 0;
 
 	if( record == NULL )
@@ -1045,26 +1398,157 @@ int libevtx_record_get_utf8_channel_name(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_channel_name(
-	          internal_record->record_values,
-	          utf8_string,
-	          utf8_string_size,
-	          error );
-
-	if( result == -1 )
+	if( internal_record->record_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy channel name to UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
-}
-
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
+	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_channel_name_size,
+	          &libevtx_record_values_get_utf8_channel_name,
+	          &( internal_record->record_values->channel_value ),
+	          &( internal_record->record_values->utf8_channel_name ),
+	          &( internal_record->record_values->utf8_channel_name_size ),
+	          &cached_utf8_string,
+	          &cached_utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string of channel name.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( utf8_string_size < cached_utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf8_string,
+		     cached_utf8_string,
+		     cached_utf8_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy channel name to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded channel name
+ * The string is converted on first access and cached in the record
+ * The returned size includes the end of string character
+ * The string remains valid until the record is freed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_channel_name_reference(
+     libevtx_record_t *record,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_channel_name_reference";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
+	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_channel_name_size,
+	          &libevtx_record_values_get_utf8_channel_name,
+	          &( internal_record->record_values->channel_value ),
+	          &( internal_record->record_values->utf8_channel_name ),
+	          &( internal_record->record_values->utf8_channel_name_size ),
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve channel name as UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-16 encoded channel name
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
@@ -1167,6 +1651,7 @@ int libevtx_record_get_utf8_computer_name_size(
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
+	const uint8_t *cached_utf8_string          = NULL;
 	static char *function                      = "libevtx_record_get_utf8_computer_name_size";
 	int result                                 = 0;
 
@@ -1183,8 +1668,25 @@ int libevtx_record_get_utf8_computer_name_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_computer_name_size(
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
 	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_computer_name_size,
+	          &libevtx_record_values_get_utf8_computer_name,
+	          &( internal_record->record_values->computer_value ),
+	          &( internal_record->record_values->utf8_computer_name ),
+	          &( internal_record->record_values->utf8_computer_name_size ),
+	          &cached_utf8_string,
 	          utf8_string_size,
 	          error );
 
@@ -1213,7 +1715,124 @@ int libevtx_record_get_utf8_computer_name(
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
+	const uint8_t *cached_utf8_string          = NULL;
 	static char *function                      = "libevtx_record_get_utf8_computer_name";
+	size_t cached_utf8_string_size             = 0;
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
+	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_computer_name_size,
+	          &libevtx_record_values_get_utf8_computer_name,
+	          &( internal_record->record_values->computer_value ),
+	          &( internal_record->record_values->utf8_computer_name ),
+	          &( internal_record->record_values->utf8_computer_name_size ),
+	          &cached_utf8_string,
+	          &cached_utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string of computer name.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( utf8_string_size < cached_utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf8_string,
+		     cached_utf8_string,
+		     cached_utf8_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy computer name to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded computer name
+ * The string is converted on first access and cached in the record
+ * The returned size includes the end of string character
+ * The string remains valid until the record is freed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_computer_name_reference(
+     libevtx_record_t *record,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_computer_name_reference";
 	int result                                 = 0;
 
 	if( record == NULL )
@@ -1229,8 +1848,24 @@ int libevtx_record_get_utf8_computer_name(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_computer_name(
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
 	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_computer_name_size,
+	          &libevtx_record_values_get_utf8_computer_name,
+	          &( internal_record->record_values->computer_value ),
+	          &( internal_record->record_values->utf8_computer_name ),
+	          &( internal_record->record_values->utf8_computer_name_size ),
 	          utf8_string,
 	          utf8_string_size,
 	          error );
@@ -1240,8 +1875,8 @@ int libevtx_record_get_utf8_computer_name(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy computer name to UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve computer name as UTF-8 string.",
 		 function );
 
 		return( -1 );
@@ -1351,6 +1986,7 @@ int libevtx_record_get_utf8_user_security_identifier_size(
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
+	const uint8_t *cached_utf8_string          = NULL;
 	static char *function                      = "libevtx_record_get_utf8_user_security_identifier_size";
 	int result                                 = 0;
 
@@ -1367,8 +2003,25 @@ int libevtx_record_get_utf8_user_security_identifier_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_user_security_identifier_size(
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
 	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_user_security_identifier_size,
+	          &libevtx_record_values_get_utf8_user_security_identifier,
+	          &( internal_record->record_values->user_security_identifier_value ),
+	          &( internal_record->record_values->utf8_user_security_identifier ),
+	          &( internal_record->record_values->utf8_user_security_identifier_size ),
+	          &cached_utf8_string,
 	          utf8_string_size,
 	          error );
 
@@ -1397,7 +2050,9 @@ int libevtx_record_get_utf8_user_security_identifier(
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
+	const uint8_t *cached_utf8_string          = NULL;
 	static char *function                      = "libevtx_record_get_utf8_user_security_identifier";
+	size_t cached_utf8_string_size             = 0;
 	int result                                 = 0;
 
 	if( record == NULL )
@@ -1413,10 +2068,48 @@ int libevtx_record_get_utf8_user_security_identifier(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	result = libevtx_record_values_get_utf8_user_security_identifier(
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
 	          internal_record->record_values,
-	          utf8_string,
-	          utf8_string_size,
+	          &libevtx_record_values_get_utf8_user_security_identifier_size,
+	          &libevtx_record_values_get_utf8_user_security_identifier,
+	          &( internal_record->record_values->user_security_identifier_value ),
+	          &( internal_record->record_values->utf8_user_security_identifier ),
+	          &( internal_record->record_values->utf8_user_security_identifier_size ),
+	          &cached_utf8_string,
+	          &cached_utf8_string_size,
 	          error );
 
 	if( result == -1 )
@@ -1424,14 +2117,107 @@ int libevtx_record_get_utf8_user_security_identifier(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy user security identifier to UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string of user security identifier.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
-}
+	if( result != 0 )
+	{
+		if( utf8_string_size < cached_utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf8_string,
+		     cached_utf8_string,
+		     cached_utf8_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy user security identifier to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded user security identifier
+ * The string is converted on first access and cached in the record
+ * The returned size includes the end of string character
+ * The string remains valid until the record is freed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_user_security_identifier_reference(
+     libevtx_record_t *record,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_user_security_identifier_reference";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( internal_record->record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing record values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_get_cached_utf8_string(
+	          internal_record->record_values,
+	          &libevtx_record_values_get_utf8_user_security_identifier_size,
+	          &libevtx_record_values_get_utf8_user_security_identifier,
+	          &( internal_record->record_values->user_security_identifier_value ),
+	          &( internal_record->record_values->utf8_user_security_identifier ),
+	          &( internal_record->record_values->utf8_user_security_identifier_size ),
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve user security identifier as UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
 
 /* Retrieves the size of the UTF-16 encoded user security identifier
  * The returned size includes the end of string character
@@ -1451,93 +2237,443 @@ int libevtx_record_get_utf16_user_security_identifier_size(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	result = libevtx_record_values_get_utf16_user_security_identifier_size(
+	          internal_record->record_values,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of user security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded user security identifier
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf16_user_security_identifier(
+     libevtx_record_t *record,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_user_security_identifier";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	result = libevtx_record_values_get_utf16_user_security_identifier(
+	          internal_record->record_values,
+	          utf16_string,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy user security identifier to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Parses the record data with a template definition
+ * This function needs to be called before accessing the strings otherwise
+ * the record data will be parsed without a template definition by default
+ * Returns 1 if successful, 0 if data could not be parsed or -1 on error
+ */
+int libevtx_record_parse_data_with_template_definition(
+     libevtx_record_t *record,
+     libevtx_template_definition_t *template_definition,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_parse_data_with_template_definition";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevtx_record_values_parse_data(
+	          internal_record->record_values,
+	          internal_record->io_handle,
+	          (libevtx_internal_template_definition_t *) template_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse data.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of strings
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_number_of_strings(
+     libevtx_record_t *record,
+     int *number_of_strings,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_number_of_strings";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_values_get_number_of_strings(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to retrieve number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the string with a specific UTF-8 encoded name
+ * The name is the value of the Name attribute of the EventData Data element
+ * or the element name of the UserData element that contains the string
+ * Returns 1 if successful, 0 if no such string or -1 on error
+ */
+int libevtx_record_get_string_index_by_utf8_name(
+     libevtx_record_t *record,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *string_index,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_string_index_by_utf8_name";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	result = libevtx_record_values_get_string_index_by_utf8_name(
+	          internal_record->record_values,
+	          internal_record->io_handle,
+	          utf8_string,
+	          utf8_string_length,
+	          string_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string index by UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the index of the string with a specific UTF-16 encoded name
+ * The name is the value of the Name attribute of the EventData Data element
+ * or the element name of the UserData element that contains the string
+ * Returns 1 if successful, 0 if no such string or -1 on error
+ */
+int libevtx_record_get_string_index_by_utf16_name(
+     libevtx_record_t *record,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *string_index,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_string_index_by_utf16_name";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	result = libevtx_record_values_get_string_index_by_utf16_name(
+	          internal_record->record_values,
+	          internal_record->io_handle,
+	          utf16_string,
+	          utf16_string_length,
+	          string_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string index by UTF-16 name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_utf8_string_size(
+     libevtx_record_t *record,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	const uint8_t *cached_utf8_string          = NULL;
+	static char *function                      = "libevtx_record_get_utf8_string_size";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_values_get_utf8_string_reference(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     string_index,
+	     &cached_utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to retrieve size of UTF-8 string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_utf8_string(
+     libevtx_record_t *record,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	const uint8_t *cached_utf8_string          = NULL;
+	static char *function                      = "libevtx_record_get_utf8_string";
+	size_t cached_utf8_string_size             = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libevtx_internal_record_t *) record;
-
-	result = libevtx_record_values_get_utf16_user_security_identifier_size(
-	          internal_record->record_values,
-	          utf16_string_size,
-	          error );
-
-	if( result == -1 )
+	if( libevtx_record_values_get_utf8_string_reference(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     string_index,
+	     &cached_utf8_string,
+	     &cached_utf8_string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of user security identifier.",
-		 function );
+		 "%s: unable to retrieve UTF-8 string: %d.",
+		 function,
+		 string_index );
 
 		return( -1 );
 	}
-	return( result );
-}
-
-/* Retrieves the UTF-16 encoded user security identifier
- * The size should include the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
- */
-int libevtx_record_get_utf16_user_security_identifier(
-     libevtx_record_t *record,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
-     libcerror_error_t **error )
-{
-	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf16_user_security_identifier";
-	int result                                 = 0;
-
-	if( record == NULL )
+	if( utf8_string_size < cached_utf8_string_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libevtx_internal_record_t *) record;
-
-	result = libevtx_record_values_get_utf16_user_security_identifier(
-	          internal_record->record_values,
-	          utf16_string,
-	          utf16_string_size,
-	          error );
-
-	if( result == -1 )
+	if( memory_copy(
+	     utf8_string,
+	     cached_utf8_string,
+	     cached_utf8_string_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy user security identifier to UTF-16 string.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string: %d.",
+		 function,
+		 string_index );
 
 		return( -1 );
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Parses the record data with a template definition
- * This function needs to be called before accessing the strings otherwise
- * the record data will be parsed without a template definition by default
- * Returns 1 if successful, 0 if data could not be parsed or -1 on error
+/* Retrieves a specific UTF-8 encoded string
+ * The string is converted on first access and cached in the record
+ * The returned size includes the end of string character
+ * The string remains valid until the record is freed
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_parse_data_with_template_definition(
+int libevtx_record_get_utf8_string_reference(
      libevtx_record_t *record,
-     libevtx_template_definition_t *template_definition,
+     int string_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_parse_data_with_template_definition";
-	int result                                 = 0;
+	static char *function                      = "libevtx_record_get_utf8_string_reference";
 
 	if( record == NULL )
 	{
@@ -1552,47 +2688,39 @@ int libevtx_record_parse_data_with_template_definition(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	if( template_definition == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid template definition.",
-		 function );
-
-		return( -1 );
-	}
-	result = libevtx_record_values_parse_data(
-	          internal_record->record_values,
-	          internal_record->io_handle,
-	          (libevtx_internal_template_definition_t *) template_definition,
-	          error );
-
-	if( result == -1 )
+	if( libevtx_record_values_get_utf8_string_reference(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     string_index,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to parse data.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string: %d.",
+		 function,
+		 string_index );
 
 		return( -1 );
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the number of strings
+/* Retrieves the size of a specific UTF-16 encoded string
+ * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_number_of_strings(
+int libevtx_record_get_utf16_string_size(
      libevtx_record_t *record,
-     int *number_of_strings,
+     int string_index,
+     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_number_of_strings";
+	static char *function                      = "libevtx_record_get_utf16_string_size";
 
 	if( record == NULL )
 	{
@@ -1607,36 +2735,39 @@ int libevtx_record_get_number_of_strings(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	if( libevtx_record_values_get_number_of_strings(
+	if( libevtx_record_values_get_utf16_string_size(
 	     internal_record->record_values,
 	     internal_record->io_handle,
-	     number_of_strings,
+	     string_index,
+	     utf16_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to retrieve number of strings.",
-		 function );
+		 "%s: unable to retrieve size of UTF-16 string: %d.",
+		 function,
+		 string_index );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves the size of a specific UTF-8 encoded string
- * The returned size includes the end of string character
+/* Retrieves a specific UTF-16 encoded string
+ * The size should include the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_utf8_string_size(
+int libevtx_record_get_utf16_string(
      libevtx_record_t *record,
      int string_index,
-     size_t *utf8_string_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf8_string_size";
+	static char *function                      = "libevtx_record_get_utf16_string";
 
 	if( record == NULL )
 	{
@@ -1651,18 +2782,19 @@ int libevtx_record_get_utf8_string_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	if( libevtx_record_values_get_utf8_string_size(
+	if( libevtx_record_values_get_utf16_string(
 	     internal_record->record_values,
 	     internal_record->io_handle,
 	     string_index,
-	     utf8_string_size,
+	     utf16_string,
+	     utf16_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to retrieve size of UTF-8 string: %d.",
+		 "%s: unable to retrieve UTF-16 string: %d.",
 		 function,
 		 string_index );
 
@@ -1671,19 +2803,18 @@ int libevtx_record_get_utf8_string_size(
 	return( 1 );
 }
 
-/* Retrieves a specific UTF-8 encoded string
- * The size should include the end of string character
+/* Retrieves the value type of a specific string
+ * The value type is one of the LIBEVTX_VALUE_TYPES
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_utf8_string(
+int libevtx_record_get_string_value_type(
      libevtx_record_t *record,
      int string_index,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     uint8_t *value_type,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf8_string";
+	static char *function                      = "libevtx_record_get_string_value_type";
 
 	if( record == NULL )
 	{
@@ -1698,19 +2829,18 @@ int libevtx_record_get_utf8_string(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	if( libevtx_record_values_get_utf8_string(
+	if( libevtx_record_values_get_string_value_type(
 	     internal_record->record_values,
 	     internal_record->io_handle,
 	     string_index,
-	     utf8_string,
-	     utf8_string_size,
+	     value_type,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to retrieve UTF-8 string: %d.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type of string: %d.",
 		 function,
 		 string_index );
 
@@ -1719,18 +2849,17 @@ int libevtx_record_get_utf8_string(
 	return( 1 );
 }
 
-/* Retrieves the size of a specific UTF-16 encoded string
- * The returned size includes the end of string character
+/* Retrieves the data size of a specific string
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_utf16_string_size(
+int libevtx_record_get_string_data_size(
      libevtx_record_t *record,
      int string_index,
-     size_t *utf16_string_size,
+     size_t *data_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf16_string_size";
+	static char *function                      = "libevtx_record_get_string_data_size";
 
 	if( record == NULL )
 	{
@@ -1745,18 +2874,18 @@ int libevtx_record_get_utf16_string_size(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	if( libevtx_record_values_get_utf16_string_size(
+	if( libevtx_record_values_get_string_data_size(
 	     internal_record->record_values,
 	     internal_record->io_handle,
 	     string_index,
-	     utf16_string_size,
+	     data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to retrieve size of UTF-16 string: %d.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size of string: %d.",
 		 function,
 		 string_index );
 
@@ -1765,19 +2894,19 @@ int libevtx_record_get_utf16_string_size(
 	return( 1 );
 }
 
-/* Retrieves a specific UTF-16 encoded string
- * The size should include the end of string character
+/* Retrieves the data of a specific string
+ * The data is stored as defined by the value type, e.g. integers are stored in little-endian
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_get_utf16_string(
+int libevtx_record_get_string_data(
      libevtx_record_t *record,
      int string_index,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
 	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_get_utf16_string";
+	static char *function                      = "libevtx_record_get_string_data";
 
 	if( record == NULL )
 	{
@@ -1792,19 +2921,19 @@ int libevtx_record_get_utf16_string(
 	}
 	internal_record = (libevtx_internal_record_t *) record;
 
-	if( libevtx_record_values_get_utf16_string(
+	if( libevtx_record_values_get_string_data(
 	     internal_record->record_values,
 	     internal_record->io_handle,
 	     string_index,
-	     utf16_string,
-	     utf16_string_size,
+	     data,
+	     data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to retrieve UTF-16 string: %d.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data of string: %d.",
 		 function,
 		 string_index );
 
@@ -1905,6 +3034,56 @@ int libevtx_record_get_data(
 	return( result );
 }
 
+/* Retrieves the data
+ * This does not reference the data in the file, the XML parser copies the
+ * value data, the returned data is a copy owned by the record that is created
+ * on first access and that remains valid until the record is freed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_data_reference(
+     libevtx_record_t *record,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_data_reference";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	result = libevtx_record_values_get_data_reference(
+	          internal_record->record_values,
+	          internal_record->io_handle,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-8 encoded XML string
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -2077,3 +3256,80 @@ int libevtx_record_get_utf16_xml_string(
 	return( 1 );
 }
 
+/* Parses the event XML and invokes the callbacks for every element, attribute and value
+ * The event XML is decoded into an XML tag tree, as for the XML string functions,
+ * the callbacks are invoked while walking this tree instead of rendering a XML string
+ * The names are UTF-8 encoded and the value data is the binary data of the value as typed by value type
+ * The names and value data are only valid for the duration of the callback
+ * A callback that is NULL is not invoked
+ * A callback returns 1 to continue, 0 to stop parsing or -1 on error
+ * Returns 1 if successful, 0 if stopped by a callback or -1 on error
+ */
+int libevtx_record_parse_with_callbacks(
+     libevtx_record_t *record,
+     int (*start_element_callback)(
+            void *context,
+            const uint8_t *name,
+            size_t name_length,
+            libcerror_error_t **error ),
+     int (*attribute_callback)(
+            void *context,
+            const uint8_t *name,
+            size_t name_length,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            libcerror_error_t **error ),
+     int (*value_callback)(
+            void *context,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            libcerror_error_t **error ),
+     int (*end_element_callback)(
+            void *context,
+            const uint8_t *name,
+            size_t name_length,
+            libcerror_error_t **error ),
+     void *context,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_parse_with_callbacks";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	result = libevtx_record_values_parse_with_callbacks(
+	          internal_record->record_values,
+	          start_element_callback,
+	          attribute_callback,
+	          value_callback,
+	          end_element_callback,
+	          context,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse event XML.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
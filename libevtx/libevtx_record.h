@@ -131,6 +131,13 @@ int libevtx_record_get_utf8_provider_identifier(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_provider_identifier_reference(
+     libevtx_record_t *record,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf16_provider_identifier_size(
      libevtx_record_t *record,
@@ -157,6 +164,13 @@ int libevtx_record_get_utf8_source_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_source_name_reference(
+     libevtx_record_t *record,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf16_source_name_size(
      libevtx_record_t *record,
@@ -183,6 +197,13 @@ int libevtx_record_get_utf8_channel_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_channel_name_reference(
+     libevtx_record_t *record,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf16_channel_name_size(
      libevtx_record_t *record,
@@ -209,6 +230,13 @@ int libevtx_record_get_utf8_computer_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_computer_name_reference(
+     libevtx_record_t *record,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf16_computer_name_size(
      libevtx_record_t *record,
@@ -235,6 +263,13 @@ int libevtx_record_get_utf8_user_security_identifier(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_user_security_identifier_reference(
+     libevtx_record_t *record,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf16_user_security_identifier_size(
      libevtx_record_t *record,
@@ -260,6 +295,22 @@ int libevtx_record_get_number_of_strings(
      int *number_of_strings,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_string_index_by_utf8_name(
+     libevtx_record_t *record,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *string_index,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_string_index_by_utf16_name(
+     libevtx_record_t *record,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *string_index,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf8_string_size(
      libevtx_record_t *record,
@@ -275,6 +326,14 @@ int libevtx_record_get_utf8_string(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_string_reference(
+     libevtx_record_t *record,
+     int string_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf16_string_size(
      libevtx_record_t *record,
@@ -290,6 +349,28 @@ int libevtx_record_get_utf16_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_string_value_type(
+     libevtx_record_t *record,
+     int string_index,
+     uint8_t *value_type,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_string_data_size(
+     libevtx_record_t *record,
+     int string_index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_string_data(
+     libevtx_record_t *record,
+     int string_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_data_size(
      libevtx_record_t *record,
@@ -303,6 +384,13 @@ int libevtx_record_get_data(
      size_t data_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_data_reference(
+     libevtx_record_t *record,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf8_xml_string_size(
      libevtx_record_t *record,
@@ -329,6 +417,36 @@ int libevtx_record_get_utf16_xml_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_parse_with_callbacks(
+     libevtx_record_t *record,
+     int (*start_element_callback)(
+            void *context,
+            const uint8_t *name,
+            size_t name_length,
+            libcerror_error_t **error ),
+     int (*attribute_callback)(
+            void *context,
+            const uint8_t *name,
+            size_t name_length,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            libcerror_error_t **error ),
+     int (*value_callback)(
+            void *context,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            libcerror_error_t **error ),
+     int (*end_element_callback)(
+            void *context,
+            const uint8_t *name,
+            size_t name_length,
+            libcerror_error_t **error ),
+     void *context,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,673 @@
+/*
+ * Record index functions
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_memory.h"
+#include "libevtx_record_index.h"
+
+/* Creates a record index
+ * Make sure the value record_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_initialize(
+     libevtx_record_index_t **record_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_index_initialize";
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*record_index = libevtx_memory_allocate_structure(
+	                 libevtx_record_index_t );
+
+	if( *record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_index,
+	     0,
+	     sizeof( libevtx_record_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *record_index != NULL )
+	{
+		libevtx_memory_free(
+		 *record_index );
+
+		*record_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record index
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_free(
+     libevtx_record_index_t **record_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_index_free";
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_index != NULL )
+	{
+		if( ( *record_index )->entries != NULL )
+		{
+			libevtx_memory_free(
+			 ( *record_index )->entries );
+		}
+		if( ( *record_index )->ranges != NULL )
+		{
+			libevtx_memory_free(
+			 ( *record_index )->ranges );
+		}
+		libevtx_memory_free(
+		 *record_index );
+
+		*record_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a record index
+ * The allocated entries and ranges are retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_empty(
+     libevtx_record_index_t *record_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_index_empty";
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	record_index->number_of_entries = 0;
+	record_index->number_of_ranges  = 0;
+	record_index->ranges_are_sorted = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_get_number_of_entries(
+     libevtx_record_index_t *record_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_index_get_number_of_entries";
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = record_index->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_get_entry_by_index(
+     libevtx_record_index_t *record_index,
+     int entry_index,
+     uint32_t *chunk_index,
+     uint32_t *chunk_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_index_get_entry_by_index";
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= record_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_index       = record_index->entries[ entry_index ].chunk_index;
+	*chunk_data_offset = record_index->entries[ entry_index ].chunk_data_offset;
+
+	return( 1 );
+}
+
+/* Appends an entry
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_append_entry(
+     libevtx_record_index_t *record_index,
+     int *entry_index,
+     uint32_t chunk_index,
+     uint32_t chunk_data_offset,
+     libcerror_error_t **error )
+{
+	libevtx_record_index_entry_t *reallocation = NULL;
+	static char *function                      = "libevtx_record_index_append_entry";
+	size_t entries_size                        = 0;
+	int number_of_allocated_entries            = 0;
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index->number_of_entries >= record_index->number_of_allocated_entries )
+	{
+		if( record_index->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = LIBEVTX_RECORD_INDEX_MINIMUM_NUMBER_OF_ENTRIES;
+		}
+		else if( record_index->number_of_allocated_entries <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = record_index->number_of_allocated_entries * 2;
+		}
+		else
+		{
+			number_of_allocated_entries = INT_MAX;
+		}
+		if( number_of_allocated_entries <= record_index->number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries_size = sizeof( libevtx_record_index_entry_t ) * number_of_allocated_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (libevtx_record_index_entry_t *) libevtx_memory_reallocate(
+		                                                 record_index->entries,
+		                                                 entries_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		record_index->entries                     = reallocation;
+		record_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	record_index->entries[ record_index->number_of_entries ].chunk_index       = chunk_index;
+	record_index->entries[ record_index->number_of_entries ].chunk_data_offset = chunk_data_offset;
+
+	*entry_index = record_index->number_of_entries;
+
+	record_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Appends the range of entries of a chunk
+ * The entries of a chunk are stored in event record number order
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_append_range(
+     libevtx_record_index_t *record_index,
+     uint64_t first_record_number,
+     int first_entry_index,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	libevtx_record_index_range_t *reallocation = NULL;
+	static char *function                      = "libevtx_record_index_append_range";
+	size_t ranges_size                         = 0;
+	int number_of_allocated_ranges             = 0;
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_entry_index < 0 )
+	 || ( first_entry_index > record_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( number_of_entries > ( record_index->number_of_entries - first_entry_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index->number_of_ranges >= record_index->number_of_allocated_ranges )
+	{
+		if( record_index->number_of_allocated_ranges == 0 )
+		{
+			number_of_allocated_ranges = LIBEVTX_RECORD_INDEX_MINIMUM_NUMBER_OF_RANGES;
+		}
+		else if( record_index->number_of_allocated_ranges <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_ranges = record_index->number_of_allocated_ranges * 2;
+		}
+		else
+		{
+			number_of_allocated_ranges = INT_MAX;
+		}
+		if( number_of_allocated_ranges <= record_index->number_of_ranges )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of ranges value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		ranges_size = sizeof( libevtx_record_index_range_t ) * number_of_allocated_ranges;
+
+		if( ranges_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid ranges size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (libevtx_record_index_range_t *) libevtx_memory_reallocate(
+		                                                 record_index->ranges,
+		                                                 ranges_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize ranges.",
+			 function );
+
+			return( -1 );
+		}
+		record_index->ranges                     = reallocation;
+		record_index->number_of_allocated_ranges = number_of_allocated_ranges;
+	}
+	record_index->ranges[ record_index->number_of_ranges ].first_record_number = first_record_number;
+	record_index->ranges[ record_index->number_of_ranges ].first_entry_index   = first_entry_index;
+	record_index->ranges[ record_index->number_of_ranges ].number_of_entries   = number_of_entries;
+	record_index->ranges[ record_index->number_of_ranges ].first_logical_index = 0;
+
+	record_index->number_of_ranges += 1;
+	record_index->ranges_are_sorted = 0;
+
+	return( 1 );
+}
+
+/* Compares two ranges by their first event record number
+ * Ranges with the same first event record number are ordered by their first entry index
+ * Returns -1 if the first range precedes the second, 1 if it follows or 0 if equal
+ */
+int libevtx_record_index_range_compare(
+     const void *first_range,
+     const void *second_range )
+{
+	const libevtx_record_index_range_t *range1 = (const libevtx_record_index_range_t *) first_range;
+	const libevtx_record_index_range_t *range2 = (const libevtx_record_index_range_t *) second_range;
+
+	if( range1->first_record_number < range2->first_record_number )
+	{
+		return( -1 );
+	}
+	if( range1->first_record_number > range2->first_record_number )
+	{
+		return( 1 );
+	}
+	if( range1->first_entry_index < range2->first_entry_index )
+	{
+		return( -1 );
+	}
+	if( range1->first_entry_index > range2->first_entry_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the ranges in event record number order and determines their logical indexes
+ * Only the ranges, one per chunk, are sorted not the individual entries
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_sort_ranges(
+     libevtx_record_index_t *record_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_index_sort_ranges";
+	int logical_index     = 0;
+	int range_index       = 0;
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index->number_of_ranges > 1 )
+	{
+		qsort(
+		 record_index->ranges,
+		 (size_t) record_index->number_of_ranges,
+		 sizeof( libevtx_record_index_range_t ),
+		 &libevtx_record_index_range_compare );
+	}
+	for( range_index = 0;
+	     range_index < record_index->number_of_ranges;
+	     range_index++ )
+	{
+		record_index->ranges[ range_index ].first_logical_index = logical_index;
+
+		logical_index += record_index->ranges[ range_index ].number_of_entries;
+	}
+	if( logical_index != record_index->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: number of entries in ranges does not match number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	record_index->ranges_are_sorted = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the entry index of a specific logical index
+ * The logical index is the index of the entry in event record number order
+ * If no ranges are available the logical index is the entry index
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_get_entry_index_by_logical_index(
+     libevtx_record_index_t *record_index,
+     int logical_index,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libevtx_record_index_range_t *range = NULL;
+	static char *function               = "libevtx_record_index_get_entry_index_by_logical_index";
+	int lower_range_index               = 0;
+	int range_index                     = 0;
+	int upper_range_index               = 0;
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( logical_index < 0 )
+	 || ( logical_index >= record_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index->number_of_ranges == 0 )
+	{
+		*entry_index = logical_index;
+
+		return( 1 );
+	}
+	if( record_index->ranges_are_sorted == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index - ranges are not sorted.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the last range with a first logical index less than or equal to the logical index
+	 */
+	upper_range_index = record_index->number_of_ranges - 1;
+
+	while( lower_range_index < upper_range_index )
+	{
+		range_index = lower_range_index + ( ( upper_range_index - lower_range_index + 1 ) / 2 );
+
+		if( record_index->ranges[ range_index ].first_logical_index <= logical_index )
+		{
+			lower_range_index = range_index;
+		}
+		else
+		{
+			upper_range_index = range_index - 1;
+		}
+	}
+	range = &( record_index->ranges[ lower_range_index ] );
+
+	*entry_index = range->first_entry_index + ( logical_index - range->first_logical_index );
+
+	return( 1 );
+}
+
@@ -0,0 +1,159 @@
+/*
+ * Record index functions
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_RECORD_INDEX_H )
+#define _LIBEVTX_RECORD_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_record_index_entry libevtx_record_index_entry_t;
+
+struct libevtx_record_index_entry
+{
+	/* The chunk index
+	 */
+	uint32_t chunk_index;
+
+	/* The record data offset relative to the start of the chunk
+	 */
+	uint32_t chunk_data_offset;
+};
+
+typedef struct libevtx_record_index_range libevtx_record_index_range_t;
+
+struct libevtx_record_index_range
+{
+	/* The first event record number of the chunk
+	 */
+	uint64_t first_record_number;
+
+	/* The index of the first entry of the chunk
+	 */
+	int first_entry_index;
+
+	/* The number of entries of the chunk
+	 */
+	int number_of_entries;
+
+	/* The logical index of the first entry of the chunk
+	 */
+	int first_logical_index;
+};
+
+typedef struct libevtx_record_index libevtx_record_index_t;
+
+struct libevtx_record_index
+{
+	/* The entries
+	 */
+	libevtx_record_index_entry_t *entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The chunk ranges, these are used to map a logical index, in event record number order,
+	 * onto an entry index without sorting the individual entries
+	 */
+	libevtx_record_index_range_t *ranges;
+
+	/* The number of allocated ranges
+	 */
+	int number_of_allocated_ranges;
+
+	/* The number of ranges
+	 */
+	int number_of_ranges;
+
+	/* Value to indicate the ranges are sorted
+	 */
+	uint8_t ranges_are_sorted;
+};
+
+int libevtx_record_index_initialize(
+     libevtx_record_index_t **record_index,
+     libcerror_error_t **error );
+
+int libevtx_record_index_free(
+     libevtx_record_index_t **record_index,
+     libcerror_error_t **error );
+
+int libevtx_record_index_empty(
+     libevtx_record_index_t *record_index,
+     libcerror_error_t **error );
+
+int libevtx_record_index_get_number_of_entries(
+     libevtx_record_index_t *record_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libevtx_record_index_get_entry_by_index(
+     libevtx_record_index_t *record_index,
+     int entry_index,
+     uint32_t *chunk_index,
+     uint32_t *chunk_data_offset,
+     libcerror_error_t **error );
+
+int libevtx_record_index_append_entry(
+     libevtx_record_index_t *record_index,
+     int *entry_index,
+     uint32_t chunk_index,
+     uint32_t chunk_data_offset,
+     libcerror_error_t **error );
+
+int libevtx_record_index_append_range(
+     libevtx_record_index_t *record_index,
+     uint64_t first_record_number,
+     int first_entry_index,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libevtx_record_index_range_compare(
+     const void *first_range,
+     const void *second_range );
+
+int libevtx_record_index_sort_ranges(
+     libevtx_record_index_t *record_index,
+     libcerror_error_t **error );
+
+int libevtx_record_index_get_entry_index_by_logical_index(
+     libevtx_record_index_t *record_index,
+     int logical_index,
+     int *entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_RECORD_INDEX_H ) */
+
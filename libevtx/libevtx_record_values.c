@@ -26,11 +26,15 @@
 #include <types.h>
 
 #include "libevtx_byte_stream.h"
+#include "libevtx_definitions.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libcnotify.h"
 #include "libevtx_libfdatetime.h"
 #include "libevtx_libfwevt.h"
+#include "libevtx_libuna.h"
+#include "libevtx_memory.h"
+#include "libevtx_name_index.h"
 #include "libevtx_record_values.h"
 #include "libevtx_template_definition.h"
 
@@ -70,8 +74,8 @@ int libevtx_record_values_initialize(
 
 		return( -1 );
 	}
-	*record_values = memory_allocate_structure(
-	                  libevtx_record_values_t );
+	*record_values = libevtx_memory_allocate_structure(
+	                          libevtx_record_values_t );
 
 	if( *record_values == NULL )
 	{
@@ -98,12 +102,14 @@ int libevtx_record_values_initialize(
 
 		goto on_error;
 	}
+	( *record_values )->number_of_references = 1;
+
 	return( 1 );
 
 on_error:
 	if( *record_values != NULL )
 	{
-		memory_free(
+		libevtx_memory_free(
 		 *record_values );
 
 		*record_values = NULL;
@@ -112,6 +118,7 @@ on_error:
 }
 
 /* Frees record values
+ * The record values are only freed when no other references are held
  * Returns 1 if successful or -1 on error
  */
 int libevtx_record_values_free(
@@ -120,6 +127,7 @@ int libevtx_record_values_free(
 {
 	static char *function = "libevtx_record_values_free";
 	int result            = 1;
+	int string_index      = 0;
 
 	if( record_values == NULL )
 	{
@@ -134,6 +142,16 @@ int libevtx_record_values_free(
 	}
 	if( *record_values != NULL )
 	{
+		( *record_values )->number_of_references -= 1;
+
+		if( ( *record_values )->number_of_references > 0 )
+		{
+			/* The record values are still referenced elsewhere
+			 */
+			*record_values = NULL;
+
+			return( 1 );
+		}
 		if( ( *record_values )->string_identifiers_array != NULL )
 		{
 			if( libcdata_array_free(
@@ -168,6 +186,22 @@ int libevtx_record_values_free(
 				result = -1;
 			}
 		}
+		if( ( *record_values )->name_index != NULL )
+		{
+			if( libevtx_name_index_free(
+			     &( ( *record_values )->name_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free the name index.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *record_values )->xml_document != NULL )
 		{
 			if( libfwevt_xml_document_free(
@@ -184,7 +218,67 @@ int libevtx_record_values_free(
 				result = -1;
 			}
 		}
-		memory_free(
+		if( ( *record_values )->utf8_provider_identifier != NULL )
+		{
+			libevtx_memory_free(
+			 ( *record_values )->utf8_provider_identifier );
+		}
+		if( ( *record_values )->utf8_source_name != NULL )
+		{
+			libevtx_memory_free(
+			 ( *record_values )->utf8_source_name );
+		}
+		if( ( *record_values )->utf8_channel_name != NULL )
+		{
+			libevtx_memory_free(
+			 ( *record_values )->utf8_channel_name );
+		}
+		if( ( *record_values )->utf8_computer_name != NULL )
+		{
+			libevtx_memory_free(
+			 ( *record_values )->utf8_computer_name );
+		}
+		if( ( *record_values )->utf8_user_security_identifier != NULL )
+		{
+			libevtx_memory_free(
+			 ( *record_values )->utf8_user_security_identifier );
+		}
+		if( ( *record_values )->utf8_strings != NULL )
+		{
+			for( string_index = 0;
+			     string_index < ( *record_values )->number_of_utf8_strings;
+			     string_index++ )
+			{
+				if( ( *record_values )->utf8_strings[ string_index ] != NULL )
+				{
+					libevtx_memory_free(
+					 ( *record_values )->utf8_strings[ string_index ] );
+				}
+			}
+			libevtx_memory_free(
+			 ( *record_values )->utf8_strings );
+		}
+		if( ( *record_values )->utf8_string_sizes != NULL )
+		{
+			libevtx_memory_free(
+			 ( *record_values )->utf8_string_sizes );
+		}
+		if( ( *record_values )->binary_data != NULL )
+		{
+			libevtx_memory_free(
+			 ( *record_values )->binary_data );
+		}
+		if( ( *record_values )->utf8_xml_string != NULL )
+		{
+			libevtx_memory_free(
+			 ( *record_values )->utf8_xml_string );
+		}
+		if( ( *record_values )->utf16_xml_string != NULL )
+		{
+			libevtx_memory_free(
+			 ( *record_values )->utf16_xml_string );
+		}
+		libevtx_memory_free(
 		 *record_values );
 
 		*record_values = NULL;
@@ -192,6 +286,43 @@ int libevtx_record_values_free(
 	return( result );
 }
 
+/* Adds a reference to record values
+ * The reference is released by libevtx_record_values_free
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_add_reference(
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_add_reference";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->number_of_references >= INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record values - number of references value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	record_values->number_of_references += 1;
+
+	return( 1 );
+}
+
 /* Clones the record values
  * Returns 1 if successful or -1 on error
  */
@@ -241,8 +372,8 @@ int libevtx_record_values_clone(
 
 		return( -1 );
 	}
-	*destination_record_values = memory_allocate_structure(
-	                              libevtx_record_values_t );
+	*destination_record_values = libevtx_memory_allocate_structure(
+	                                      libevtx_record_values_t );
 
 	if( *destination_record_values == NULL )
 	{
@@ -271,12 +402,39 @@ int libevtx_record_values_clone(
 	}
 	( *destination_record_values )->xml_document = NULL;
 
+	/* The cached values are specific to the XML document
+	 */
+	( *destination_record_values )->utf8_provider_identifier           = NULL;
+	( *destination_record_values )->utf8_provider_identifier_size      = 0;
+	( *destination_record_values )->utf8_source_name                   = NULL;
+	( *destination_record_values )->utf8_source_name_size              = 0;
+	( *destination_record_values )->utf8_channel_name                  = NULL;
+	( *destination_record_values )->utf8_channel_name_size             = 0;
+	( *destination_record_values )->utf8_computer_name                 = NULL;
+	( *destination_record_values )->utf8_computer_name_size            = 0;
+	( *destination_record_values )->utf8_user_security_identifier      = NULL;
+	( *destination_record_values )->utf8_user_security_identifier_size = 0;
+	( *destination_record_values )->utf8_strings                       = NULL;
+	( *destination_record_values )->utf8_string_sizes                  = NULL;
+	( *destination_record_values )->number_of_utf8_strings             = 0;
+	( *destination_record_values )->binary_data                        = NULL;
+	( *destination_record_values )->binary_data_size                   = 0;
+	( *destination_record_values )->utf8_xml_string                    = NULL;
+	( *destination_record_values )->utf8_xml_string_size               = 0;
+	( *destination_record_values )->utf16_xml_string                   = NULL;
+	( *destination_record_values )->utf16_xml_string_size              = 0;
+	( *destination_record_values )->name_index                         = NULL;
+
+	/* The references are specific to the source record values
+	 */
+	( *destination_record_values )->number_of_references = 1;
+
 	return( 1 );
 
 on_error:
 	if( *destination_record_values != NULL )
 	{
-		memory_free(
+		libevtx_memory_free(
 		 *destination_record_values );
 
 		*destination_record_values = NULL;
@@ -4770,8 +4928,8 @@ int libevtx_record_values_parse_data_xml_tag_by_template(
 
 			goto on_error;
 		}
-		data_name = (uint8_t *) memory_allocate(
-		                         sizeof( uint8_t ) * data_name_size );
+		data_name = (uint8_t *) libevtx_memory_allocate(
+		                                 sizeof( uint8_t ) * data_name_size );
 
 		if( data_name == NULL )
 		{
@@ -4784,8 +4942,8 @@ int libevtx_record_values_parse_data_xml_tag_by_template(
 
 			goto on_error;
 		}
-		template_name = (uint8_t *) memory_allocate(
-		                             sizeof( uint8_t ) * template_name_size );
+		template_name = (uint8_t *) libevtx_memory_allocate(
+		                                     sizeof( uint8_t ) * template_name_size );
 
 		if( template_name == NULL )
 		{
@@ -4833,12 +4991,12 @@ int libevtx_record_values_parse_data_xml_tag_by_template(
 			  template_name,
 			  sizeof( uint8_t ) * template_name_size );
 
-		memory_free(
+		libevtx_memory_free(
 		 template_name );
 
 		template_name = NULL;
 
-		memory_free(
+		libevtx_memory_free(
 		 data_name );
 
 		data_name = NULL;
@@ -5039,12 +5197,12 @@ int libevtx_record_values_parse_data_xml_tag_by_template(
 on_error:
 	if( template_name != NULL )
 	{
-		memory_free(
+		libevtx_memory_free(
 		 template_name );
 	}
 	if( data_name != NULL )
 	{
-		memory_free(
+		libevtx_memory_free(
 		 data_name );
 	}
 	return( -1 );
@@ -5326,6 +5484,24 @@ int libevtx_record_values_parse_data(
 			}
 		}
 	}
+	if( ( result == 1 )
+	 && ( internal_template_definition != NULL ) )
+	{
+		if( libevtx_record_values_set_template_name_index(
+		     record_values,
+		     internal_template_definition,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set template definition name index.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	record_values->data_parsed = 1;
 
 	return( result );
@@ -5348,16 +5524,26 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the number of strings
- * Returns 1 if successful or -1 on error
+/* Sets the name index of the template definition in the record values
+ * The string names are defined by the template, hence the name index is built
+ * once and shared by the records parsed with the template. Since substitutions
+ * that are not present in a record are not part of its strings, the name index
+ * is only shared if the strings of the record have the same layout, otherwise
+ * the record builds its own name index from its strings on first access
+ * Returns 1 if successful, 0 if the layout of the strings differs or -1 on error
  */
-int libevtx_record_values_get_number_of_strings(
+int libevtx_record_values_set_template_name_index(
      libevtx_record_values_t *record_values,
-     libevtx_io_handle_t *io_handle,
-     int *number_of_strings,
+     libevtx_internal_template_definition_t *internal_template_definition,
      libcerror_error_t **error )
 {
-	static char *function = "libevtx_record_values_get_number_of_strings";
+	libfwevt_xml_tag_t *record_xml_tag   = NULL;
+	libfwevt_xml_tag_t *template_xml_tag = NULL;
+	static char *function                = "libevtx_record_values_set_template_name_index";
+	int entry_index                      = 0;
+	int number_of_record_xml_tags        = 0;
+	int number_of_template_xml_tags      = 0;
+	int string_index                     = 0;
 
 	if( record_values == NULL )
 	{
@@ -5370,66 +5556,213 @@ int libevtx_record_values_get_number_of_strings(
 
 		return( -1 );
 	}
-	if( record_values->xml_document == NULL )
+	if( record_values->name_index != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record values - name index value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_values->data_parsed == 0 )
+	if( internal_template_definition == NULL )
 	{
-		if( libevtx_record_values_parse_data(
-		     record_values,
-		     io_handle,
-		     NULL,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     record_values->string_identifiers_array,
+	     &number_of_record_xml_tags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of string identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_template_definition->name_index == NULL )
+	{
+		if( libcdata_array_initialize(
+		     &( internal_template_definition->name_index_xml_tags_array ),
+		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to parse data.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create name index XML tags array.",
+			 function );
+
+			goto on_error;
+		}
+		for( string_index = 0;
+		     string_index < number_of_record_xml_tags;
+		     string_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     record_values->string_identifiers_array,
+			     string_index,
+			     (intptr_t **) &record_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string identifier: %d.",
+				 function,
+				 string_index );
+
+				goto on_error;
+			}
+			if( libcdata_array_append_entry(
+			     internal_template_definition->name_index_xml_tags_array,
+			     &entry_index,
+			     (intptr_t *) record_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append string identifier: %d to name index XML tags array.",
+				 function,
+				 string_index );
+
+				goto on_error;
+			}
+		}
+		if( libevtx_record_values_build_name_index(
+		     record_values->string_identifiers_array,
+		     &( internal_template_definition->name_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build template definition name index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_template_definition->name_index_xml_tags_array,
+		     &number_of_template_xml_tags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of name index XML tags.",
 			 function );
 
 			return( -1 );
 		}
+		if( number_of_record_xml_tags != number_of_template_xml_tags )
+		{
+			return( 0 );
+		}
+		for( string_index = 0;
+		     string_index < number_of_record_xml_tags;
+		     string_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     record_values->string_identifiers_array,
+			     string_index,
+			     (intptr_t **) &record_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string identifier: %d.",
+				 function,
+				 string_index );
+
+				return( -1 );
+			}
+			if( libcdata_array_get_entry_by_index(
+			     internal_template_definition->name_index_xml_tags_array,
+			     string_index,
+			     (intptr_t **) &template_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name index XML tag: %d.",
+				 function,
+				 string_index );
+
+				return( -1 );
+			}
+			if( record_xml_tag != template_xml_tag )
+			{
+				return( 0 );
+			}
+		}
 	}
-	if( libcdata_array_get_number_of_entries(
-	     record_values->strings_array,
-	     number_of_strings,
+	if( libevtx_name_index_add_reference(
+	     internal_template_definition->name_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of strings.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add reference to template definition name index.",
 		 function );
 
 		return( -1 );
 	}
+	record_values->name_index = internal_template_definition->name_index;
+
 	return( 1 );
+
+on_error:
+	if( internal_template_definition->name_index == NULL )
+	{
+		if( internal_template_definition->name_index_xml_tags_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_template_definition->name_index_xml_tags_array ),
+			 NULL,
+			 NULL );
+		}
+	}
+	return( -1 );
 }
 
-/* Retrieves the size of a specific UTF-8 encoded string
- * The returned size includes the end of string character
+/* Retrieves the number of strings
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf8_string_size(
+int libevtx_record_values_get_number_of_strings(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
-     int string_index,
-     size_t *utf8_string_size,
+     int *number_of_strings,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *string_xml_tag     = NULL;
-	libfwevt_xml_value_t *string_xml_value = NULL;
-	static char *function                  = "libevtx_record_values_get_utf8_string_size";
+	static char *function = "libevtx_record_values_get_number_of_strings";
 
 	if( record_values == NULL )
 	{
@@ -5471,176 +5804,311 @@ int libevtx_record_values_get_utf8_string_size(
 			return( -1 );
 		}
 	}
-	if( libcdata_array_get_entry_by_index(
+	if( libcdata_array_get_number_of_entries(
 	     record_values->strings_array,
-	     string_index,
-	     (intptr_t **) &string_xml_tag,
+	     number_of_strings,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d.",
-		 function,
-		 string_index );
+		 "%s: unable to retrieve number of strings.",
+		 function );
 
 		return( -1 );
 	}
-	if( libfwevt_xml_tag_get_value(
-	     string_xml_tag,
-	     &string_xml_value,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Appends the name of a string XML tag to a name index
+ * The name is the value of the Name attribute if present, as in EventData, otherwise the XML tag name
+ * Returns 1 if successful, 0 if the name is already present or -1 on error
+ */
+int libevtx_record_values_append_string_name(
+     libevtx_name_index_t *name_index,
+     libfwevt_xml_tag_t *xml_tag,
+     int string_index,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *name_xml_tag = NULL;
+	libfwevt_xml_value_t *name_value = NULL;
+	uint8_t *name                    = NULL;
+	static char *function            = "libevtx_record_values_append_string_name";
+	size_t name_size                 = 0;
+	int result                       = 0;
+
+	if( xml_tag == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d value.",
-		 function,
-		 string_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
 
 		return( -1 );
 	}
-/* TODO if string_xml_value == NULL return 0 */
-	if( libfwevt_xml_value_get_utf8_string_size(
-	     string_xml_value,
-	     utf8_string_size,
-	     error ) != 1 )
+	result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+	          xml_tag,
+	          (uint8_t *) "Name",
+	          4,
+	          &name_xml_tag,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d value size.",
-		 function,
-		 string_index );
+		 "%s: unable to retrieve Name XML attribute.",
+		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( 1 );
-}
+	else if( result != 0 )
+	{
+		if( libfwevt_xml_tag_get_value(
+		     name_xml_tag,
+		     &name_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve Name XML attribute value.",
+			 function );
 
-/* Retrieves a specific UTF-8 encoded string
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libevtx_record_values_get_utf8_string(
-     libevtx_record_values_t *record_values,
-     libevtx_io_handle_t *io_handle,
-     int string_index,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     libcerror_error_t **error )
-{
-	libfwevt_xml_tag_t *string_xml_tag     = NULL;
-	libfwevt_xml_value_t *string_xml_value = NULL;
-	static char *function                  = "libevtx_record_values_get_utf8_string";
+			goto on_error;
+		}
+		if( libfwevt_xml_value_get_utf8_string_size(
+		     name_value,
+		     &name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size of Name XML attribute value.",
+			 function );
 
-	if( record_values == NULL )
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libfwevt_xml_tag_get_utf8_name_size(
+		     xml_tag,
+		     &name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve XML tag name size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( name_size <= 1 )
+	 || ( name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		return( 0 );
+	}
+	name = (uint8_t *) libevtx_memory_allocate(
+	                    sizeof( uint8_t ) * name_size );
+
+	if( name == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record values.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( record_values->xml_document == NULL )
+	if( name_value != NULL )
+	{
+		result = libfwevt_xml_value_copy_to_utf8_string(
+		          name_value,
+		          name,
+		          name_size,
+		          error );
+	}
+	else
+	{
+		result = libfwevt_xml_tag_get_utf8_name(
+		          xml_tag,
+		          name,
+		          name_size,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( record_values->data_parsed == 0 )
+	result = libevtx_name_index_append_name(
+	          name_index,
+	          name,
+	          name_size - 1,
+	          string_index,
+	          error );
+
+	if( result == -1 )
 	{
-		if( libevtx_record_values_parse_data(
-		     record_values,
-		     io_handle,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to parse data.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name to name index.",
+		 function );
 
-			return( -1 );
-		}
+		goto on_error;
 	}
-	if( libcdata_array_get_entry_by_index(
-	     record_values->strings_array,
-	     string_index,
-	     (intptr_t **) &string_xml_tag,
-	     error ) != 1 )
+	libevtx_memory_free(
+	 name );
+
+	return( result );
+
+on_error:
+	if( name != NULL )
+	{
+		libevtx_memory_free(
+		 name );
+	}
+	return( -1 );
+}
+
+/* Builds a name index of the strings from an array of string XML tags
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_build_name_index(
+     libcdata_array_t *xml_tags_array,
+     libevtx_name_index_t **name_index,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *xml_tag = NULL;
+	static char *function       = "libevtx_record_values_build_name_index";
+	int number_of_xml_tags      = 0;
+	int string_index            = 0;
+
+	if( name_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d.",
-		 function,
-		 string_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
 
 		return( -1 );
 	}
-	if( libfwevt_xml_tag_get_value(
-	     string_xml_tag,
-	     &string_xml_value,
+	if( libcdata_array_get_number_of_entries(
+	     xml_tags_array,
+	     &number_of_xml_tags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d value.",
-		 function,
-		 string_index );
+		 "%s: unable to retrieve number of XML tags.",
+		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfwevt_xml_value_copy_to_utf8_string(
-	     string_xml_value,
-	     utf8_string,
-	     utf8_string_size,
+	if( libevtx_name_index_initialize(
+	     name_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d value.",
-		 function,
-		 string_index );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create name index.",
+		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	for( string_index = 0;
+	     string_index < number_of_xml_tags;
+	     string_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     xml_tags_array,
+		     string_index,
+		     (intptr_t **) &xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve XML tag: %d.",
+			 function,
+			 string_index );
+
+			goto on_error;
+		}
+		if( xml_tag == NULL )
+		{
+			continue;
+		}
+		if( libevtx_record_values_append_string_name(
+		     *name_index,
+		     xml_tag,
+		     string_index,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append name of string: %d.",
+			 function,
+			 string_index );
+
+			goto on_error;
+		}
 	}
 	return( 1 );
+
+on_error:
+	if( *name_index != NULL )
+	{
+		libevtx_name_index_free(
+		 name_index,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the size of a specific UTF-16 encoded string
- * The returned size includes the end of string character
+/* Retrieves the string name index
+ * The name index is built on first access, unless it is shared by the template definition
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf16_string_size(
+int libevtx_record_values_get_name_index(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
-     int string_index,
-     size_t *utf16_string_size,
+     libevtx_name_index_t **name_index,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *string_xml_tag     = NULL;
-	libfwevt_xml_value_t *string_xml_value = NULL;
-	static char *function                  = "libevtx_record_values_get_utf16_string_size";
+	static char *function = "libevtx_record_values_get_name_index";
+	int number_of_strings = 0;
 
 	if( record_values == NULL )
 	{
@@ -5653,100 +6121,198 @@ int libevtx_record_values_get_utf16_string_size(
 
 		return( -1 );
 	}
-	if( record_values->xml_document == NULL )
+	if( name_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_values->data_parsed == 0 )
+	if( record_values->name_index == NULL )
 	{
-		if( libevtx_record_values_parse_data(
+		/* Make sure the data is parsed
+		 */
+		if( libevtx_record_values_get_number_of_strings(
 		     record_values,
 		     io_handle,
-		     NULL,
+		     &number_of_strings,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to parse data.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of strings.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	if( libcdata_array_get_entry_by_index(
-	     record_values->strings_array,
-	     string_index,
-	     (intptr_t **) &string_xml_tag,
+	if( record_values->name_index == NULL )
+	{
+		if( libevtx_record_values_build_name_index(
+		     record_values->strings_array,
+		     &( record_values->name_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build name index.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*name_index = record_values->name_index;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the string with a specific UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such string or -1 on error
+ */
+int libevtx_record_values_get_string_index_by_utf8_name(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *string_index,
+     libcerror_error_t **error )
+{
+	libevtx_name_index_t *name_index = NULL;
+	static char *function            = "libevtx_record_values_get_string_index_by_utf8_name";
+	int result                       = 0;
+
+	if( libevtx_record_values_get_name_index(
+	     record_values,
+	     io_handle,
+	     &name_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d.",
-		 function,
-		 string_index );
+		 "%s: unable to retrieve name index.",
+		 function );
 
 		return( -1 );
 	}
-	if( libfwevt_xml_tag_get_value(
-	     string_xml_tag,
-	     &string_xml_value,
-	     error ) != 1 )
+	result = libevtx_name_index_get_value_index_by_utf8_name(
+	          name_index,
+	          utf8_string,
+	          utf8_string_length,
+	          string_index,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d value.",
-		 function,
-		 string_index );
+		 "%s: unable to retrieve string index by UTF-8 name.",
+		 function );
 
 		return( -1 );
 	}
-/* TODO if string_xml_value == NULL return 0 */
-	if( libfwevt_xml_value_get_utf16_string_size(
-	     string_xml_value,
-	     utf16_string_size,
+	return( result );
+}
+
+/* Retrieves the index of the string with a specific UTF-16 encoded name
+ * Returns 1 if successful, 0 if no such string or -1 on error
+ */
+int libevtx_record_values_get_string_index_by_utf16_name(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *string_index,
+     libcerror_error_t **error )
+{
+	libevtx_name_index_t *name_index = NULL;
+	static char *function            = "libevtx_record_values_get_string_index_by_utf16_name";
+	int result                       = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length > (size_t) ( SSIZE_MAX / 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_get_name_index(
+	     record_values,
+	     io_handle,
+	     &name_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d value size.",
-		 function,
-		 string_index );
+		 "%s: unable to retrieve name index.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	result = libevtx_name_index_get_value_index_by_utf16_name(
+	          name_index,
+	          utf16_string,
+	          utf16_string_length,
+	          string_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string index by UTF-16 name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
 }
 
-/* Retrieves a specific UTF-16 encoded string
- * The size should include the end of string character
+/* Retrieves the size of a specific UTF-8 encoded string
+ * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf16_string(
+int libevtx_record_values_get_utf8_string_size(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
      int string_index,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwevt_xml_tag_t *string_xml_tag     = NULL;
 	libfwevt_xml_value_t *string_xml_value = NULL;
-	static char *function                  = "libevtx_record_values_get_utf16_string";
+	static char *function                  = "libevtx_record_values_get_utf8_string_size";
 
 	if( record_values == NULL )
 	{
@@ -5819,17 +6385,17 @@ int libevtx_record_values_get_utf16_string(
 
 		return( -1 );
 	}
-	if( libfwevt_xml_value_copy_to_utf16_string(
+/* TODO if string_xml_value == NULL return 0 */
+	if( libfwevt_xml_value_get_utf8_string_size(
 	     string_xml_value,
-	     utf16_string,
-	     utf16_string_size,
+	     utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve string: %d value.",
+		 "%s: unable to retrieve string: %d value size.",
 		 function,
 		 string_index );
 
@@ -5838,20 +6404,21 @@ int libevtx_record_values_get_utf16_string(
 	return( 1 );
 }
 
-/* Retrieves the size of the data
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves a specific UTF-8 encoded string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_data_size(
+int libevtx_record_values_get_utf8_string(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
-     size_t *data_size,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *binary_data_tag    = NULL;
-	libfwevt_xml_tag_t *event_data_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag       = NULL;
-	static char *function                  = "libevtx_record_values_get_data_size";
-	int result                             = 0;
+	libfwevt_xml_tag_t *string_xml_tag     = NULL;
+	libfwevt_xml_value_t *string_xml_value = NULL;
+	static char *function                  = "libevtx_record_values_get_utf8_string";
 
 	if( record_values == NULL )
 	{
@@ -5893,121 +6460,70 @@ int libevtx_record_values_get_data_size(
 			return( -1 );
 		}
 	}
-	if( record_values->binary_data_value == NULL )
+	if( libcdata_array_get_entry_by_index(
+	     record_values->strings_array,
+	     string_index,
+	     (intptr_t **) &string_xml_tag,
+	     error ) != 1 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-			  root_xml_tag,
-			  (uint8_t *) "EventData",
-			  9,
-			  &event_data_xml_tag,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve EventData XML element.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-			  event_data_xml_tag,
-			  (uint8_t *) "BinaryData",
-			  10,
-			  &binary_data_tag,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve BinaryData XML element.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		if( libfwevt_xml_tag_get_value(
-		     binary_data_tag,
-		     &( record_values->binary_data_value ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve BinaryData XML element value.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( record_values->binary_data_value == NULL )
+	if( libfwevt_xml_tag_get_value(
+	     string_xml_tag,
+	     &string_xml_value,
+	     error ) != 1 )
 	{
-		result = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value.",
+		 function,
+		 string_index );
+
+		return( -1 );
 	}
-	else
+	if( libfwevt_xml_value_copy_to_utf8_string(
+	     string_xml_value,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
 	{
-		if( libfwevt_xml_value_get_data_size(
-		     record_values->binary_data_value,
-		     data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve size of binary data.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value.",
+		 function,
+		 string_index );
 
-			return( -1 );
-		}
-		result = 1;
+		return( -1 );
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the data
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves the size of a specific UTF-16 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_data(
+int libevtx_record_values_get_utf16_string_size(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
-     uint8_t *data,
-     size_t data_size,
+     int string_index,
+     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *binary_data_tag    = NULL;
-	libfwevt_xml_tag_t *event_data_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag       = NULL;
-	static char *function                  = "libevtx_record_values_get_data";
-	int result                             = 0;
+	libfwevt_xml_tag_t *string_xml_tag     = NULL;
+	libfwevt_xml_value_t *string_xml_value = NULL;
+	static char *function                  = "libevtx_record_values_get_utf16_string_size";
 
 	if( record_values == NULL )
 	{
@@ -6018,90 +6534,2584 @@ int libevtx_record_values_get_data(
 		 "%s: invalid record values.",
 		 function );
 
-		return( -1 );
-	}
-	if( record_values->xml_document == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record values - missing XML document.",
-		 function );
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_entry_by_index(
+	     record_values->strings_array,
+	     string_index,
+	     (intptr_t **) &string_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_value(
+	     string_xml_tag,
+	     &string_xml_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+/* TODO if string_xml_value == NULL return 0 */
+	if( libfwevt_xml_value_get_utf16_string_size(
+	     string_xml_value,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value size.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-16 encoded string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf16_string(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *string_xml_tag     = NULL;
+	libfwevt_xml_value_t *string_xml_value = NULL;
+	static char *function                  = "libevtx_record_values_get_utf16_string";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_entry_by_index(
+	     record_values->strings_array,
+	     string_index,
+	     (intptr_t **) &string_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_value(
+	     string_xml_tag,
+	     &string_xml_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_value_copy_to_utf16_string(
+	     string_xml_value,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value type of a specific string
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_string_value_type(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     uint8_t *value_type,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *string_xml_tag     = NULL;
+	libfwevt_xml_value_t *string_xml_value = NULL;
+	static char *function                  = "libevtx_record_values_get_string_value_type";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_entry_by_index(
+	     record_values->strings_array,
+	     string_index,
+	     (intptr_t **) &string_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_value(
+	     string_xml_tag,
+	     &string_xml_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_value_get_type(
+	     string_xml_value,
+	     value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value type.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data size of a specific string
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_string_data_size(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *string_xml_tag     = NULL;
+	libfwevt_xml_value_t *string_xml_value = NULL;
+	static char *function                  = "libevtx_record_values_get_string_data_size";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_entry_by_index(
+	     record_values->strings_array,
+	     string_index,
+	     (intptr_t **) &string_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_value(
+	     string_xml_tag,
+	     &string_xml_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_value_get_data_size(
+	     string_xml_value,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value data size.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data of a specific string
+ * The data is stored as defined by the value type, e.g. integers are stored in little-endian
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_string_data(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *string_xml_tag     = NULL;
+	libfwevt_xml_value_t *string_xml_value = NULL;
+	static char *function                  = "libevtx_record_values_get_string_data";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_entry_by_index(
+	     record_values->strings_array,
+	     string_index,
+	     (intptr_t **) &string_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_value(
+	     string_xml_tag,
+	     &string_xml_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_value_copy_data(
+	     string_xml_value,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value data.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_data_size(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *binary_data_tag    = NULL;
+	libfwevt_xml_tag_t *event_data_xml_tag = NULL;
+	libfwevt_xml_tag_t *root_xml_tag       = NULL;
+	static char *function                  = "libevtx_record_values_get_data_size";
+	int result                             = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( record_values->binary_data_value == NULL )
+	{
+		if( libfwevt_xml_document_get_root_xml_tag(
+		     record_values->xml_document,
+		     &root_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root XML element.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+			  root_xml_tag,
+			  (uint8_t *) "EventData",
+			  9,
+			  &event_data_xml_tag,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve EventData XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+			  event_data_xml_tag,
+			  (uint8_t *) "BinaryData",
+			  10,
+			  &binary_data_tag,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve BinaryData XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libfwevt_xml_tag_get_value(
+		     binary_data_tag,
+		     &( record_values->binary_data_value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve BinaryData XML element value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( record_values->binary_data_value == NULL )
+	{
+		result = 0;
+	}
+	else
+	{
+		if( libfwevt_xml_value_get_data_size(
+		     record_values->binary_data_value,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of binary data.",
+			 function );
+
+			return( -1 );
+		}
+		result = 1;
+	}
+	return( result );
+}
+
+/* Retrieves the data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_data(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *binary_data_tag    = NULL;
+	libfwevt_xml_tag_t *event_data_xml_tag = NULL;
+	libfwevt_xml_tag_t *root_xml_tag       = NULL;
+	static char *function                  = "libevtx_record_values_get_data";
+	int result                             = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( record_values->binary_data_value == NULL )
+	{
+		if( libfwevt_xml_document_get_root_xml_tag(
+		     record_values->xml_document,
+		     &root_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root XML element.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+			  root_xml_tag,
+			  (uint8_t *) "EventData",
+			  9,
+			  &event_data_xml_tag,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve EventData XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+			  event_data_xml_tag,
+			  (uint8_t *) "BinaryData",
+			  10,
+			  &binary_data_tag,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve BinaryData XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libfwevt_xml_tag_get_value(
+		     binary_data_tag,
+		     &( record_values->binary_data_value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve BinaryData XML element value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( record_values->binary_data_value == NULL )
+	{
+		result = 0;
+	}
+	else
+	{
+		if( libfwevt_xml_value_copy_data(
+		     record_values->binary_data_value,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy binary data.",
+			 function );
+
+			return( -1 );
+		}
+		result = 1;
+	}
+	return( result );
+}
+
+/* Retrieves a specific UTF-8 encoded string
+ * The string is converted on first access and cached in the record values
+ * The returned size includes the end of string character
+ * The string remains valid as long as the record values
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf8_string_reference(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *string_xml_tag     = NULL;
+	libfwevt_xml_value_t *string_xml_value = NULL;
+	uint8_t *cached_utf8_string            = NULL;
+	static char *function                  = "libevtx_record_values_get_utf8_string_reference";
+	size_t cached_string_size              = 0;
+	int number_of_strings                  = 0;
+	int result                             = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->utf8_strings == NULL )
+	{
+		if( libevtx_record_values_get_number_of_strings(
+		     record_values,
+		     io_handle,
+		     &number_of_strings,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of strings.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( number_of_strings <= 0 )
+		 || ( (size_t) number_of_strings > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint8_t * ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		record_values->utf8_strings = (uint8_t **) libevtx_memory_allocate(
+		                                            sizeof( uint8_t * ) * number_of_strings );
+
+		if( record_values->utf8_strings == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 strings.",
+			 function );
+
+			goto on_error;
+		}
+		record_values->utf8_string_sizes = (size_t *) libevtx_memory_allocate(
+		                                               sizeof( size_t ) * number_of_strings );
+
+		if( record_values->utf8_string_sizes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string sizes.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     record_values->utf8_strings,
+		     0,
+		     sizeof( uint8_t * ) * number_of_strings ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear UTF-8 strings.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     record_values->utf8_string_sizes,
+		     0,
+		     sizeof( size_t ) * number_of_strings ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear UTF-8 string sizes.",
+			 function );
+
+			goto on_error;
+		}
+		record_values->number_of_utf8_strings = number_of_strings;
+	}
+	if( ( string_index < 0 )
+	 || ( string_index >= record_values->number_of_utf8_strings ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->utf8_strings[ string_index ] == NULL )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     record_values->strings_array,
+		     string_index,
+		     (intptr_t **) &string_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_tag_get_value(
+		     string_xml_tag,
+		     &string_xml_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d value.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		result = libevtx_record_values_get_ascii_utf8_string_from_xml_value(
+		          string_xml_value,
+		          &cached_utf8_string,
+		          &cached_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d ASCII UTF-8 string.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			record_values->utf8_strings[ string_index ]      = cached_utf8_string;
+			record_values->utf8_string_sizes[ string_index ] = cached_string_size;
+		}
+	}
+	if( record_values->utf8_strings[ string_index ] == NULL )
+	{
+		if( libevtx_record_values_get_utf8_string_size(
+		     record_values,
+		     io_handle,
+		     string_index,
+		     &cached_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d size.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( ( cached_string_size == 0 )
+		 || ( cached_string_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string: %d size value out of bounds.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		cached_utf8_string = (uint8_t *) libevtx_memory_allocate(
+		                                  sizeof( uint8_t ) * cached_string_size );
+
+		if( cached_utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevtx_record_values_get_utf8_string(
+		     record_values,
+		     io_handle,
+		     string_index,
+		     cached_utf8_string,
+		     cached_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d.",
+			 function,
+			 string_index );
+
+			libevtx_memory_free(
+			 cached_utf8_string );
+
+			return( -1 );
+		}
+		record_values->utf8_strings[ string_index ]      = cached_utf8_string;
+		record_values->utf8_string_sizes[ string_index ] = cached_string_size;
+	}
+	*utf8_string      = record_values->utf8_strings[ string_index ];
+	*utf8_string_size = record_values->utf8_string_sizes[ string_index ];
+
+	return( 1 );
+
+on_error:
+	if( record_values->utf8_string_sizes != NULL )
+	{
+		libevtx_memory_free(
+		 record_values->utf8_string_sizes );
+
+		record_values->utf8_string_sizes = NULL;
+	}
+	if( record_values->utf8_strings != NULL )
+	{
+		libevtx_memory_free(
+		 record_values->utf8_strings );
+
+		record_values->utf8_strings = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the data
+ * The returned data is a copy owned by the record values, since libfwevt
+ * copies the value data a reference into the chunk data is not available
+ * The copy is created on first access and remains valid as long as the record values
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_data_reference(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *binary_data    = NULL;
+	static char *function   = "libevtx_record_values_get_data_reference";
+	size_t binary_data_size = 0;
+	int result              = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->binary_data == NULL )
+	{
+		result = libevtx_record_values_get_data_size(
+		          record_values,
+		          io_handle,
+		          &binary_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data size.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      || ( binary_data_size == 0 ) )
+		{
+			return( result );
+		}
+		if( binary_data_size > MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		binary_data = (uint8_t *) libevtx_memory_allocate(
+		                           sizeof( uint8_t ) * binary_data_size );
+
+		if( binary_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevtx_record_values_get_data(
+		     record_values,
+		     io_handle,
+		     binary_data,
+		     binary_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data.",
+			 function );
+
+			libevtx_memory_free(
+			 binary_data );
+
+			return( -1 );
+		}
+		record_values->binary_data      = binary_data;
+		record_values->binary_data_size = binary_data_size;
+	}
+	*data      = record_values->binary_data;
+	*data_size = record_values->binary_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded string of an XML value that contains an ASCII-only UTF-16 little-endian string
+ * The string is narrowed directly from the value data instead of converting
+ * every character, which is the common case for event record strings
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if the value is not an ASCII-only string or -1 on error
+ */
+int libevtx_record_values_get_ascii_utf8_string_from_xml_value(
+     libfwevt_xml_value_t *xml_value,
+     uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_utf8_string = NULL;
+	static char *function     = "libevtx_record_values_get_ascii_utf8_string_from_xml_value";
+	size_t data_index         = 0;
+	size_t data_size          = 0;
+	size_t string_index       = 0;
+	uint16_t value_16bit      = 0;
+	uint8_t value_type        = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfwevt_xml_value_get_type(
+	     xml_value,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		goto on_error;
+	}
+	if( value_type != LIBEVTX_VALUE_TYPE_STRING_UTF16 )
+	{
+		return( 0 );
+	}
+	if( libfwevt_xml_value_get_data_size(
+	     xml_value,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( data_size < 2 )
+	 || ( ( data_size % 2 ) != 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		return( 0 );
+	}
+	/* The UTF-16 string is narrowed in place, which is possible since
+	 * the UTF-8 string, including the end of string character, is never
+	 * larger than the UTF-16 string data
+	 */
+	safe_utf8_string = (uint8_t *) libevtx_memory_allocate(
+	                                sizeof( uint8_t ) * data_size );
+
+	if( safe_utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_value_copy_data(
+	     xml_value,
+	     safe_utf8_string,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value data.",
+		 function );
+
+		goto on_error;
+	}
+	for( data_index = 0;
+	     data_index < data_size;
+	     data_index += 2 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( safe_utf8_string[ data_index ] ),
+		 value_16bit );
+
+		if( value_16bit == 0 )
+		{
+			break;
+		}
+		if( value_16bit >= 0x0080 )
+		{
+			libevtx_memory_free(
+			 safe_utf8_string );
+
+			return( 0 );
+		}
+		safe_utf8_string[ string_index++ ] = (uint8_t) value_16bit;
+	}
+	/* Leave strings with data after the end of string character,
+	 * such as concatenated values, to the conversion by libfwevt
+	 */
+	for( data_index += 2;
+	     data_index < data_size;
+	     data_index += 2 )
+	{
+		if( ( safe_utf8_string[ data_index ] != 0 )
+		 || ( safe_utf8_string[ data_index + 1 ] != 0 ) )
+		{
+			libevtx_memory_free(
+			 safe_utf8_string );
+
+			return( 0 );
+		}
+	}
+	safe_utf8_string[ string_index++ ] = 0;
+
+	*utf8_string      = safe_utf8_string;
+	*utf8_string_size = string_index;
+
+	return( 1 );
+
+on_error:
+	if( safe_utf8_string != NULL )
+	{
+		libevtx_memory_free(
+		 safe_utf8_string );
+	}
+	return( -1 );
+}
+
+/* Retrieves a cached UTF-8 encoded string
+ * The string is retrieved with the get UTF-8 string size and get UTF-8 string functions
+ * on first access and stored in cached UTF-8 string. If XML value is set and
+ * refers to an ASCII-only string, the string is narrowed from the value data instead
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_cached_utf8_string(
+     libevtx_record_values_t *record_values,
+     int (*get_utf8_string_size)(
+            libevtx_record_values_t *record_values,
+            size_t *utf8_string_size,
+            libcerror_error_t **error ),
+     int (*get_utf8_string)(
+            libevtx_record_values_t *record_values,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libcerror_error_t **error ),
+     libfwevt_xml_value_t **xml_value,
+     uint8_t **cached_utf8_string,
+     size_t *cached_utf8_string_size,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_utf8_string    = NULL;
+	static char *function        = "libevtx_record_values_get_cached_utf8_string";
+	size_t safe_utf8_string_size = 0;
+	int result                   = 0;
+
+	if( get_utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid get UTF-8 string size function.",
+		 function );
+
+		return( -1 );
+	}
+	if( get_utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid get UTF-8 string function.",
+		 function );
+
+		return( -1 );
+	}
+	if( cached_utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( cached_utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cached_utf8_string == NULL )
+	{
+		/* The get UTF-8 string size function also resolves the XML value
+		 */
+		if( ( xml_value == NULL )
+		 || ( *xml_value == NULL ) )
+		{
+			result = get_utf8_string_size(
+			          record_values,
+			          &safe_utf8_string_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UTF-8 string size.",
+				 function );
+
+				return( -1 );
+			}
+			else if( ( result == 0 )
+			      || ( safe_utf8_string_size == 0 ) )
+			{
+				return( 0 );
+			}
+		}
+		if( ( xml_value != NULL )
+		 && ( *xml_value != NULL ) )
+		{
+			result = libevtx_record_values_get_ascii_utf8_string_from_xml_value(
+			          *xml_value,
+			          &safe_utf8_string,
+			          &safe_utf8_string_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve ASCII UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				*cached_utf8_string      = safe_utf8_string;
+				*cached_utf8_string_size = safe_utf8_string_size;
+			}
+		}
+	}
+	if( *cached_utf8_string == NULL )
+	{
+		if( safe_utf8_string_size == 0 )
+		{
+			result = get_utf8_string_size(
+			          record_values,
+			          &safe_utf8_string_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UTF-8 string size.",
+				 function );
+
+				return( -1 );
+			}
+			else if( ( result == 0 )
+			      || ( safe_utf8_string_size == 0 ) )
+			{
+				return( 0 );
+			}
+		}
+		if( safe_utf8_string_size > MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 string size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		safe_utf8_string = (uint8_t *) libevtx_memory_allocate(
+		                                sizeof( uint8_t ) * safe_utf8_string_size );
+
+		if( safe_utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( get_utf8_string(
+		     record_values,
+		     safe_utf8_string,
+		     safe_utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string.",
+			 function );
+
+			libevtx_memory_free(
+			 safe_utf8_string );
+
+			return( -1 );
+		}
+		*cached_utf8_string      = safe_utf8_string;
+		*cached_utf8_string_size = safe_utf8_string_size;
+	}
+	*utf8_string      = *cached_utf8_string;
+	*utf8_string_size = *cached_utf8_string_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded XML string
+ * The XML string is rendered on first access and cached in the record values
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf8_xml_string_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *xml_string    = NULL;
+	static char *function  = "libevtx_record_values_get_utf8_xml_string_size";
+	size_t xml_string_size = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->utf8_xml_string == NULL )
+	{
+		if( libfwevt_xml_document_get_utf8_xml_string_size(
+		     record_values->xml_document,
+		     &xml_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size of XML document.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( xml_string_size == 0 )
+		 || ( xml_string_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint8_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 XML string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		xml_string = (uint8_t *) libevtx_memory_allocate(
+		                          sizeof( uint8_t ) * xml_string_size );
+
+		if( xml_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 XML string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_document_get_utf8_xml_string(
+		     record_values->xml_document,
+		     xml_string,
+		     xml_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string of XML document.",
+			 function );
+
+			goto on_error;
+		}
+		record_values->utf8_xml_string      = xml_string;
+		record_values->utf8_xml_string_size = xml_string_size;
+	}
+	*utf8_string_size = record_values->utf8_xml_string_size;
+
+	return( 1 );
+
+on_error:
+	if( xml_string != NULL )
+	{
+		libevtx_memory_free(
+		 xml_string );
+	}
+	return( -1 );
+}
+
+/* Retrieves the UTF-8 encoded XML string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf8_xml_string(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libevtx_record_values_get_utf8_xml_string";
+	size_t xml_string_size = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_get_utf8_xml_string_size(
+	     record_values,
+	     &xml_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size < xml_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     utf8_string,
+	     record_values->utf8_xml_string,
+	     sizeof( uint8_t ) * xml_string_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string of XML document.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded XML string
+ * The XML string is rendered on first access and cached in the record values
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf16_xml_string_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	uint16_t *xml_string   = NULL;
+	static char *function  = "libevtx_record_values_get_utf16_xml_string_size";
+	size_t xml_string_size = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->utf16_xml_string == NULL )
+	{
+		if( libfwevt_xml_document_get_utf16_xml_string_size(
+		     record_values->xml_document,
+		     &xml_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string size of XML document.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( xml_string_size == 0 )
+		 || ( xml_string_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-16 XML string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		xml_string = (uint16_t *) libevtx_memory_allocate(
+		                          sizeof( uint16_t ) * xml_string_size );
+
+		if( xml_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-16 XML string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_document_get_utf16_xml_string(
+		     record_values->xml_document,
+		     xml_string,
+		     xml_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string of XML document.",
+			 function );
+
+			goto on_error;
+		}
+		record_values->utf16_xml_string      = xml_string;
+		record_values->utf16_xml_string_size = xml_string_size;
+	}
+	*utf16_string_size = record_values->utf16_xml_string_size;
+
+	return( 1 );
+
+on_error:
+	if( xml_string != NULL )
+	{
+		libevtx_memory_free(
+		 xml_string );
+	}
+	return( -1 );
+}
+
+/* Retrieves the UTF-16 encoded XML string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf16_xml_string(
+     libevtx_record_values_t *record_values,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libevtx_record_values_get_utf16_xml_string";
+	size_t xml_string_size = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_get_utf16_xml_string_size(
+	     record_values,
+	     &xml_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size < xml_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-16 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     utf16_string,
+	     record_values->utf16_xml_string,
+	     sizeof( uint16_t ) * xml_string_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 string of XML document.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+
+/* Retrieves the UTF-8 encoded name of a XML tag
+ * The name is stored in the name buffer of the parse state and remains valid until the next name is retrieved
+ * The returned length does not include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_parse_state_get_xml_tag_name(
+     libevtx_record_values_parse_state_t *parse_state,
+     libfwevt_xml_tag_t *xml_tag,
+     const uint8_t **name,
+     size_t *name_length,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "libevtx_record_values_parse_state_get_xml_tag_name";
+	size_t name_size      = 0;
+
+	if( parse_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse state.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name length.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_utf8_name_size(
+	     xml_tag,
+	     &name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve XML tag name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size <= 1 )
+	{
+		*name        = (uint8_t *) "";
+		*name_length = 0;
+
+		return( 1 );
+	}
+	if( name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid XML tag name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > parse_state->name_size )
+	{
+		reallocation = (uint8_t *) libevtx_memory_reallocate(
+		                            parse_state->name,
+		                            sizeof( uint8_t ) * name_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize name.",
+			 function );
+
+			return( -1 );
+		}
+		parse_state->name      = reallocation;
+		parse_state->name_size = name_size;
+	}
+	if( libfwevt_xml_tag_get_utf8_name(
+	     xml_tag,
+	     parse_state->name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve XML tag name.",
+		 function );
+
+		return( -1 );
+	}
+	*name        = parse_state->name;
+	*name_length = name_size - 1;
+
+	return( 1 );
+}
+
+/* Retrieves the type and data of a XML value
+ * The data is stored in the value data buffer of the parse state and remains valid until the next value is retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_parse_state_get_xml_value_data(
+     libevtx_record_values_parse_state_t *parse_state,
+     libfwevt_xml_value_t *xml_value,
+     uint8_t *value_type,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "libevtx_record_values_parse_state_get_xml_value_data";
+	size_t data_size      = 0;
+
+	if( parse_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse state.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_value_get_type(
+	     xml_value,
+	     value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_value_get_data_size(
+	     xml_value,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		*value_data      = NULL;
+		*value_data_size = 0;
+
+		return( 1 );
+	}
+	if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > parse_state->value_data_size )
+	{
+		reallocation = (uint8_t *) libevtx_memory_reallocate(
+		                            parse_state->value_data,
+		                            sizeof( uint8_t ) * data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize value data.",
+			 function );
+
+			return( -1 );
+		}
+		parse_state->value_data      = reallocation;
+		parse_state->value_data_size = data_size;
+	}
+	if( libfwevt_xml_value_copy_data(
+	     xml_value,
+	     parse_state->value_data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value data.",
+		 function );
+
+		return( -1 );
+	}
+	*value_data      = parse_state->value_data;
+	*value_data_size = data_size;
+
+	return( 1 );
+}
+
+/* Parses a XML tag and its sub elements and invokes the callbacks of the parse state
+ * A callback returns 1 to continue, 0 to stop parsing or -1 on error
+ * Returns 1 if successful, 0 if stopped by a callback or -1 on error
+ */
+int libevtx_record_values_parse_xml_tag_with_callbacks(
+     libevtx_record_values_parse_state_t *parse_state,
+     libfwevt_xml_tag_t *xml_tag,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *sub_xml_tag = NULL;
+	libfwevt_xml_value_t *xml_value = NULL;
+	const uint8_t *name             = NULL;
+	const uint8_t *value_data       = NULL;
+	static char *function           = "libevtx_record_values_parse_xml_tag_with_callbacks";
+	size_t name_length              = 0;
+	size_t value_data_size          = 0;
+	uint8_t value_type              = 0;
+	int attribute_index             = 0;
+	int element_index               = 0;
+	int number_of_attributes        = 0;
+	int number_of_elements          = 0;
+	int result                      = 0;
+
+	if( parse_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse state.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_state->start_element_callback != NULL )
+	{
+		if( libevtx_record_values_parse_state_get_xml_tag_name(
+		     parse_state,
+		     xml_tag,
+		     &name,
+		     &name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element name.",
+			 function );
+
+			return( -1 );
+		}
+		result = parse_state->start_element_callback(
+		          parse_state->context,
+		          name,
+		          name_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: start element callback failed.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( parse_state->attribute_callback != NULL )
+	{
+		if( libfwevt_xml_tag_get_number_of_attributes(
+		     xml_tag,
+		     &number_of_attributes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of attributes.",
+			 function );
+
+			return( -1 );
+		}
+		for( attribute_index = 0;
+		     attribute_index < number_of_attributes;
+		     attribute_index++ )
+		{
+			if( libfwevt_xml_tag_get_attribute_by_index(
+			     xml_tag,
+			     attribute_index,
+			     &sub_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( libevtx_record_values_parse_state_get_xml_tag_name(
+			     parse_state,
+			     sub_xml_tag,
+			     &name,
+			     &name_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d name.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( libfwevt_xml_tag_get_value(
+			     sub_xml_tag,
+			     &xml_value,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d value.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			value_type      = LIBEVTX_VALUE_TYPE_NULL;
+			value_data      = NULL;
+			value_data_size = 0;
+
+			if( xml_value != NULL )
+			{
+				if( libevtx_record_values_parse_state_get_xml_value_data(
+				     parse_state,
+				     xml_value,
+				     &value_type,
+				     &value_data,
+				     &value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve attribute: %d value data.",
+					 function,
+					 attribute_index );
+
+					return( -1 );
+				}
+			}
+			result = parse_state->attribute_callback(
+			          parse_state->context,
+			          name,
+			          name_length,
+			          value_type,
+			          value_data,
+			          value_data_size,
+			          error );
 
-		return( -1 );
-	}
-	if( record_values->data_parsed == 0 )
-	{
-		if( libevtx_record_values_parse_data(
-		     record_values,
-		     io_handle,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to parse data.",
-			 function );
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: attribute callback failed.",
+				 function );
 
-			return( -1 );
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				return( 0 );
+			}
+			xml_value = NULL;
 		}
 	}
-	if( record_values->binary_data_value == NULL )
+	if( parse_state->value_callback != NULL )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
+		if( libfwevt_xml_tag_get_value(
+		     xml_tag,
+		     &xml_value,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
+			 "%s: unable to retrieve element value.",
 			 function );
 
 			return( -1 );
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-			  root_xml_tag,
-			  (uint8_t *) "EventData",
-			  9,
-			  &event_data_xml_tag,
-			  error );
+		if( xml_value != NULL )
+		{
+			if( libevtx_record_values_parse_state_get_xml_value_data(
+			     parse_state,
+			     xml_value,
+			     &value_type,
+			     &value_data,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element value data.",
+				 function );
 
-		if( result == -1 )
+				return( -1 );
+			}
+			if( value_data_size > 0 )
+			{
+				result = parse_state->value_callback(
+				          parse_state->context,
+				          value_type,
+				          value_data,
+				          value_data_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: value callback failed.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					return( 0 );
+				}
+			}
+		}
+	}
+	if( libfwevt_xml_tag_get_number_of_elements(
+	     xml_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfwevt_xml_tag_get_element_by_index(
+		     xml_tag,
+		     element_index,
+		     &sub_xml_tag,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve EventData XML element.",
-			 function );
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-			  event_data_xml_tag,
-			  (uint8_t *) "BinaryData",
-			  10,
-			  &binary_data_tag,
-			  error );
+		result = libevtx_record_values_parse_xml_tag_with_callbacks(
+		          parse_state,
+		          sub_xml_tag,
+		          error );
 
 		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve BinaryData XML element.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse element: %d.",
+			 function,
+			 element_index );
 
 			return( -1 );
 		}
@@ -6109,57 +9119,94 @@ int libevtx_record_values_get_data(
 		{
 			return( 0 );
 		}
-		if( libfwevt_xml_tag_get_value(
-		     binary_data_tag,
-		     &( record_values->binary_data_value ),
+	}
+	if( parse_state->end_element_callback != NULL )
+	{
+		/* The name buffer is reused by the sub elements hence the name is retrieved again
+		 */
+		if( libevtx_record_values_parse_state_get_xml_tag_name(
+		     parse_state,
+		     xml_tag,
+		     &name,
+		     &name_length,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve BinaryData XML element value.",
+			 "%s: unable to retrieve element name.",
 			 function );
 
 			return( -1 );
 		}
-	}
-	if( record_values->binary_data_value == NULL )
-	{
-		result = 0;
-	}
-	else
-	{
-		if( libfwevt_xml_value_copy_data(
-		     record_values->binary_data_value,
-		     data,
-		     data_size,
-		     error ) != 1 )
+		result = parse_state->end_element_callback(
+		          parse_state->context,
+		          name,
+		          name_length,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy binary data.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: end element callback failed.",
 			 function );
 
 			return( -1 );
 		}
-		result = 1;
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded XML string
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
+/* Parses the XML document and invokes the callbacks for every element, attribute and value
+ * The callbacks are invoked while walking the XML tag tree of the XML document
+ * The names are UTF-8 encoded and the value data is the binary data of the value
+ * The names and value data are only valid for the duration of the callback
+ * A callback that is NULL is not invoked
+ * A callback returns 1 to continue, 0 to stop parsing or -1 on error
+ * Returns 1 if successful, 0 if stopped by a callback or -1 on error
  */
-int libevtx_record_values_get_utf8_xml_string_size(
+int libevtx_record_values_parse_with_callbacks(
      libevtx_record_values_t *record_values,
-     size_t *utf8_string_size,
+     int (*start_element_callback)(
+            void *context,
+            const uint8_t *name,
+            size_t name_length,
+            libcerror_error_t **error ),
+     int (*attribute_callback)(
+            void *context,
+            const uint8_t *name,
+            size_t name_length,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            libcerror_error_t **error ),
+     int (*value_callback)(
+            void *context,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            libcerror_error_t **error ),
+     int (*end_element_callback)(
+            void *context,
+            const uint8_t *name,
+            size_t name_length,
+            libcerror_error_t **error ),
+     void *context,
      libcerror_error_t **error )
 {
-	static char *function = "libevtx_record_values_get_utf8_xml_string_size";
+	libevtx_record_values_parse_state_t parse_state;
+
+	libfwevt_xml_tag_t *root_xml_tag = NULL;
+	static char *function            = "libevtx_record_values_parse_with_callbacks";
+	int result                       = 0;
 
 	if( record_values == NULL )
 	{
@@ -6172,141 +9219,74 @@ int libevtx_record_values_get_utf8_xml_string_size(
 
 		return( -1 );
 	}
-	if( libfwevt_xml_document_get_utf8_xml_string_size(
-	     record_values->xml_document,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( record_values->xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of XML document.",
-		 function );
-
-		return( -1 );
-	}
-	return( 1 );
-}
-
-/* Retrieves the UTF-8 encoded XML string
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libevtx_record_values_get_utf8_xml_string(
-     libevtx_record_values_t *record_values,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libevtx_record_values_get_utf8_xml_string";
-
-	if( record_values == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record values.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfwevt_xml_document_get_utf8_xml_string(
+	if( libfwevt_xml_document_get_root_xml_tag(
 	     record_values->xml_document,
-	     utf8_string,
-	     utf8_string_size,
+	     &root_xml_tag,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string of XML document.",
+		 "%s: unable to retrieve root XML element.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves the size of the UTF-16 encoded XML string
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libevtx_record_values_get_utf16_xml_string_size(
-     libevtx_record_values_t *record_values,
-     size_t *utf16_string_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libevtx_record_values_get_utf16_xml_string_size";
-
-	if( record_values == NULL )
+	if( memory_set(
+	     &parse_state,
+	     0,
+	     sizeof( libevtx_record_values_parse_state_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record values.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parse state.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfwevt_xml_document_get_utf16_xml_string_size(
-	     record_values->xml_document,
-	     utf16_string_size,
-	     error ) != 1 )
+	parse_state.start_element_callback = start_element_callback;
+	parse_state.attribute_callback     = attribute_callback;
+	parse_state.value_callback         = value_callback;
+	parse_state.end_element_callback   = end_element_callback;
+	parse_state.context                = context;
+
+	result = libevtx_record_values_parse_xml_tag_with_callbacks(
+	          &parse_state,
+	          root_xml_tag,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of XML document.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse root XML element.",
 		 function );
-
-		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves the UTF-16 encoded XML string
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libevtx_record_values_get_utf16_xml_string(
-     libevtx_record_values_t *record_values,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libevtx_record_values_get_utf16_xml_string";
-
-	if( record_values == NULL )
+	if( parse_state.value_data != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record values.",
-		 function );
-
-		return( -1 );
+		libevtx_memory_free(
+		 parse_state.value_data );
 	}
-	if( libfwevt_xml_document_get_utf16_xml_string(
-	     record_values->xml_document,
-	     utf16_string,
-	     utf16_string_size,
-	     error ) != 1 )
+	if( parse_state.name != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string of XML document.",
-		 function );
-
-		return( -1 );
+		libevtx_memory_free(
+		 parse_state.name );
 	}
-	return( 1 );
+	return( result );
 }
-
@@ -29,6 +29,7 @@
 #include "libevtx_libcdata.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libfwevt.h"
+#include "libevtx_name_index.h"
 #include "libevtx_template_definition.h"
 #include "libevtx_types.h"
 
@@ -38,6 +39,67 @@ extern "C" {
 
 extern const uint8_t evtx_event_record_signature[ 4 ];
 
+typedef struct libevtx_record_values_parse_state libevtx_record_values_parse_state_t;
+
+struct libevtx_record_values_parse_state
+{
+	/* The start element callback function
+	 */
+	int (*start_element_callback)(
+	       void *context,
+	       const uint8_t *name,
+	       size_t name_length,
+	       libcerror_error_t **error );
+
+	/* The attribute callback function
+	 */
+	int (*attribute_callback)(
+	       void *context,
+	       const uint8_t *name,
+	       size_t name_length,
+	       uint8_t value_type,
+	       const uint8_t *value_data,
+	       size_t value_data_size,
+	       libcerror_error_t **error );
+
+	/* The value callback function
+	 */
+	int (*value_callback)(
+	       void *context,
+	       uint8_t value_type,
+	       const uint8_t *value_data,
+	       size_t value_data_size,
+	       libcerror_error_t **error );
+
+	/* The end element callback function
+	 */
+	int (*end_element_callback)(
+	       void *context,
+	       const uint8_t *name,
+	       size_t name_length,
+	       libcerror_error_t **error );
+
+	/* The callback context
+	 */
+	void *context;
+
+	/* The name buffer, which is reused for every name
+	 */
+	uint8_t *name;
+
+	/* The name buffer size
+	 */
+	size_t name_size;
+
+	/* The value data buffer, which is reused for every value
+	 */
+	uint8_t *value_data;
+
+	/* The value data buffer size
+	 */
+	size_t value_data_size;
+};
+
 typedef struct libevtx_record_values libevtx_record_values_t;
 
 struct libevtx_record_values
@@ -126,6 +188,10 @@ struct libevtx_record_values
 	 */
 	libcdata_array_t *strings_array;
 
+	/* The string name index
+	 */
+	libevtx_name_index_t *name_index;
+
 	/* Reference to the BinaryData value
 	 */
 	libfwevt_xml_value_t *binary_data_value;
@@ -133,6 +199,87 @@ struct libevtx_record_values
 	/* Value to indicate the data was parsed
 	 */
 	uint8_t data_parsed;
+
+	/* The cached UTF-8 encoded provider identifier
+	 */
+	uint8_t *utf8_provider_identifier;
+
+	/* The cached UTF-8 encoded provider identifier size
+	 */
+	size_t utf8_provider_identifier_size;
+
+	/* The cached UTF-8 encoded source name
+	 */
+	uint8_t *utf8_source_name;
+
+	/* The cached UTF-8 encoded source name size
+	 */
+	size_t utf8_source_name_size;
+
+	/* The cached UTF-8 encoded channel name
+	 */
+	uint8_t *utf8_channel_name;
+
+	/* The cached UTF-8 encoded channel name size
+	 */
+	size_t utf8_channel_name_size;
+
+	/* The cached UTF-8 encoded computer name
+	 */
+	uint8_t *utf8_computer_name;
+
+	/* The cached UTF-8 encoded computer name size
+	 */
+	size_t utf8_computer_name_size;
+
+	/* The cached UTF-8 encoded user security identifier
+	 */
+	uint8_t *utf8_user_security_identifier;
+
+	/* The cached UTF-8 encoded user security identifier size
+	 */
+	size_t utf8_user_security_identifier_size;
+
+	/* The cached UTF-8 encoded strings
+	 */
+	uint8_t **utf8_strings;
+
+	/* The cached UTF-8 encoded string sizes
+	 */
+	size_t *utf8_string_sizes;
+
+	/* The number of cached UTF-8 encoded strings
+	 */
+	int number_of_utf8_strings;
+
+	/* The cached binary data
+	 */
+	uint8_t *binary_data;
+
+	/* The cached binary data size
+	 */
+	size_t binary_data_size;
+
+	/* The cached UTF-8 encoded XML string
+	 */
+	uint8_t *utf8_xml_string;
+
+	/* The cached UTF-8 encoded XML string size
+	 */
+	size_t utf8_xml_string_size;
+
+	/* The cached UTF-16 encoded XML string
+	 */
+	uint16_t *utf16_xml_string;
+
+	/* The cached UTF-16 encoded XML string size
+	 */
+	size_t utf16_xml_string_size;
+
+	/* The number of references, record values can be shared by
+	 * the records cache of a file and the records retrieved from it
+	 */
+	int number_of_references;
 };
 
 int libevtx_record_values_initialize(
@@ -143,6 +290,10 @@ int libevtx_record_values_free(
      libevtx_record_values_t **record_values,
      libcerror_error_t **error );
 
+int libevtx_record_values_add_reference(
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
 int libevtx_record_values_clone(
      libevtx_record_values_t **destination_record_values,
      libevtx_record_values_t *source_record_values,
@@ -309,12 +460,50 @@ int libevtx_record_values_parse_data(
      libevtx_internal_template_definition_t *internal_template_definition,
      libcerror_error_t **error );
 
+int libevtx_record_values_set_template_name_index(
+     libevtx_record_values_t *record_values,
+     libevtx_internal_template_definition_t *internal_template_definition,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_number_of_strings(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
      int *number_of_strings,
      libcerror_error_t **error );
 
+int libevtx_record_values_append_string_name(
+     libevtx_name_index_t *name_index,
+     libfwevt_xml_tag_t *xml_tag,
+     int string_index,
+     libcerror_error_t **error );
+
+int libevtx_record_values_build_name_index(
+     libcdata_array_t *xml_tags_array,
+     libevtx_name_index_t **name_index,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_name_index(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libevtx_name_index_t **name_index,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_string_index_by_utf8_name(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *string_index,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_string_index_by_utf16_name(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *string_index,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_utf8_string_size(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
@@ -345,6 +534,28 @@ int libevtx_record_values_get_utf16_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_string_value_type(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     uint8_t *value_type,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_string_data_size(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_string_data(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_data_size(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
@@ -358,6 +569,45 @@ int libevtx_record_values_get_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_utf8_string_reference(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_data_reference(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_ascii_utf8_string_from_xml_value(
+     libfwevt_xml_value_t *xml_value,
+     uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_cached_utf8_string(
+     libevtx_record_values_t *record_values,
+     int (*get_utf8_string_size)(
+            libevtx_record_values_t *record_values,
+            size_t *utf8_string_size,
+            libcerror_error_t **error ),
+     int (*get_utf8_string)(
+            libevtx_record_values_t *record_values,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libcerror_error_t **error ),
+     libfwevt_xml_value_t **xml_value,
+     uint8_t **cached_utf8_string,
+     size_t *cached_utf8_string_size,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_utf8_xml_string_size(
      libevtx_record_values_t *record_values,
      size_t *utf8_string_size,
@@ -380,6 +630,55 @@ int libevtx_record_values_get_utf16_xml_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_parse_state_get_xml_tag_name(
+     libevtx_record_values_parse_state_t *parse_state,
+     libfwevt_xml_tag_t *xml_tag,
+     const uint8_t **name,
+     size_t *name_length,
+     libcerror_error_t **error );
+
+int libevtx_record_values_parse_state_get_xml_value_data(
+     libevtx_record_values_parse_state_t *parse_state,
+     libfwevt_xml_value_t *xml_value,
+     uint8_t *value_type,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_parse_xml_tag_with_callbacks(
+     libevtx_record_values_parse_state_t *parse_state,
+     libfwevt_xml_tag_t *xml_tag,
+     libcerror_error_t **error );
+
+int libevtx_record_values_parse_with_callbacks(
+     libevtx_record_values_t *record_values,
+     int (*start_element_callback)(
+            void *context,
+            const uint8_t *name,
+            size_t name_length,
+            libcerror_error_t **error ),
+     int (*attribute_callback)(
+            void *context,
+            const uint8_t *name,
+            size_t name_length,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            libcerror_error_t **error ),
+     int (*value_callback)(
+            void *context,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            libcerror_error_t **error ),
+     int (*end_element_callback)(
+            void *context,
+            const uint8_t *name,
+            size_t name_length,
+            libcerror_error_t **error ),
+     void *context,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -28,6 +28,8 @@
 #include "libevtx_libcerror.h"
 #include "libevtx_libcnotify.h"
 #include "libevtx_libfwevt.h"
+#include "libevtx_memory.h"
+#include "libevtx_name_index.h"
 #include "libevtx_template_definition.h"
 
 /* Creates a template definition
@@ -63,8 +65,8 @@ int libevtx_template_definition_initialize(
 
 		return( -1 );
 	}
-	internal_template_definition = memory_allocate_structure(
-	                                libevtx_internal_template_definition_t );
+	internal_template_definition = libevtx_memory_allocate_structure(
+	                                        libevtx_internal_template_definition_t );
 
 	if( internal_template_definition == NULL )
 	{
@@ -111,7 +113,7 @@ int libevtx_template_definition_initialize(
 on_error:
 	if( internal_template_definition != NULL )
 	{
-		memory_free(
+		libevtx_memory_free(
 		 internal_template_definition );
 	}
 	return( -1 );
@@ -173,7 +175,42 @@ int libevtx_template_definition_free(
 				result = -1;
 			}
 		}
-		memory_free(
+		if( internal_template_definition->name_index != NULL )
+		{
+			if( libevtx_name_index_free(
+			     &( internal_template_definition->name_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free name index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The XML tags are managed by the XML document
+		 */
+		if( internal_template_definition->name_index_xml_tags_array != NULL )
+		{
+			if( libcdata_array_free(
+			     &( internal_template_definition->name_index_xml_tags_array ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free name index XML tags array.",
+				 function );
+
+				result = -1;
+			}
+		}
+		libevtx_memory_free(
 		 internal_template_definition );
 	}
 	return( result );
@@ -30,6 +30,7 @@
 #include "libevtx_libcdata.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libfwevt.h"
+#include "libevtx_name_index.h"
 #include "libevtx_types.h"
 
 #if defined( __cplusplus )
@@ -47,6 +48,15 @@ struct libevtx_internal_template_definition
 	/* The XML document
 	 */
 	libfwevt_xml_document_t *xml_document;
+
+	/* The string name index, shared with the records parsed with the template definition
+	 */
+	libevtx_name_index_t *name_index;
+
+	/* The template XML tags of the strings the name index was built from,
+	 * a record only shares the name index if its strings have the same layout
+	 */
+	libcdata_array_t *name_index_xml_tags_array;
 };
 
 LIBEVTX_EXTERN \
@@ -100,7 +100,7 @@ int main(
 	 "libevtx_chunks_table_free",
 	 evtx_test_chunks_table_free );
 
-	/* TODO: add tests for libevtx_chunks_table_read_record */
+	/* TODO: add tests for libevtx_chunks_table_read_record_values */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
 
@@ -1181,6 +1181,627 @@ on_error:
 	return( 0 );
 }
 
+/* Tests freeing a record after the file it was retrieved from
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_free_record_after_file(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	libevtx_file_t *file     = NULL;
+	libevtx_record_t *record = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_file_open_wide(
+	          file,
+	          source,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+#else
+	result = libevtx_file_open(
+	          file,
+	          source,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+#endif
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records > 0 )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          0,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test free the file before the record
+	 */
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( record != NULL )
+	{
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_open function with the recovery access flags
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_open_recovery(
+     const system_character_t *source )
+{
+	libcerror_error_t *error        = NULL;
+	libevtx_file_t *file            = NULL;
+	int access_flags                = 0;
+	int expected_number_of_records  = 0;
+	int number_of_recovered_records = 0;
+	int result                      = 0;
+	int test_number                 = 0;
+
+	int test_access_flags[ 4 ] = {
+		LIBEVTX_OPEN_READ,
+		LIBEVTX_OPEN_READ | LIBEVTX_ACCESS_FLAG_NO_RECOVERY,
+		LIBEVTX_OPEN_READ | LIBEVTX_ACCESS_FLAG_LAZY_RECOVERY,
+		LIBEVTX_OPEN_READ | LIBEVTX_ACCESS_FLAG_READ_AHEAD };
+
+	/* Initialize test
+	 */
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( test_number = 0;
+	     test_number < 4;
+	     test_number++ )
+	{
+		access_flags = test_access_flags[ test_number ];
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevtx_file_open_wide(
+		          file,
+		          source,
+		          access_flags,
+		          &error );
+#else
+		result = libevtx_file_open(
+		          file,
+		          source,
+		          access_flags,
+		          &error );
+#endif
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_number_of_recovered_records(
+		          file,
+		          &number_of_recovered_records,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( test_number == 0 )
+		{
+			expected_number_of_records = number_of_recovered_records;
+		}
+		else if( ( access_flags & LIBEVTX_ACCESS_FLAG_NO_RECOVERY ) != 0 )
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "number_of_recovered_records",
+			 number_of_recovered_records,
+			 0 );
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "number_of_recovered_records",
+			 number_of_recovered_records,
+			 expected_number_of_records );
+		}
+		result = libevtx_file_close(
+		          file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_file_open_wide(
+	          file,
+	          source,
+	          LIBEVTX_OPEN_READ | LIBEVTX_ACCESS_FLAG_NO_RECOVERY | LIBEVTX_ACCESS_FLAG_LAZY_RECOVERY,
+	          &error );
+#else
+	result = libevtx_file_open(
+	          file,
+	          source,
+	          LIBEVTX_OPEN_READ | LIBEVTX_ACCESS_FLAG_NO_RECOVERY | LIBEVTX_ACCESS_FLAG_LAZY_RECOVERY,
+	          &error );
+#endif
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests that the records read with read-ahead match the records read without it
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_read_ahead(
+     const system_character_t *source )
+{
+	libevtx_file_t *files[ 2 ]       = { NULL, NULL };
+	libevtx_record_t *records[ 2 ]   = { NULL, NULL };
+	uint8_t *xml_strings[ 2 ]        = { NULL, NULL };
+	size_t xml_string_sizes[ 2 ]     = { 0, 0 };
+	uint64_t identifiers[ 2 ]        = { 0, 0 };
+	libcerror_error_t *error         = NULL;
+	int number_of_records[ 2 ]       = { 0, 0 };
+	int access_flags                 = 0;
+	int file_index                   = 0;
+	int record_index                 = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		result = libevtx_file_initialize(
+		          &( files[ file_index ] ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "file",
+		 files[ file_index ] );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		access_flags = LIBEVTX_OPEN_READ;
+
+		if( file_index == 1 )
+		{
+			access_flags |= LIBEVTX_ACCESS_FLAG_READ_AHEAD;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevtx_file_open_wide(
+		          files[ file_index ],
+		          source,
+		          access_flags,
+		          &error );
+#else
+		result = libevtx_file_open(
+		          files[ file_index ],
+		          source,
+		          access_flags,
+		          &error );
+#endif
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_number_of_records(
+		          files[ file_index ],
+		          &( number_of_records[ file_index ] ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records[ 1 ],
+	 number_of_records[ 0 ] );
+
+	/* Test regular cases
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records[ 0 ];
+	     record_index++ )
+	{
+		for( file_index = 0;
+		     file_index < 2;
+		     file_index++ )
+		{
+			result = libevtx_file_get_record_by_index(
+			          files[ file_index ],
+			          record_index,
+			          &( records[ file_index ] ),
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "record",
+			 records[ file_index ] );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libevtx_record_get_identifier(
+			          records[ file_index ],
+			          &( identifiers[ file_index ] ),
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libevtx_record_get_utf8_xml_string_size(
+			          records[ file_index ],
+			          &( xml_string_sizes[ file_index ] ),
+			          &error );
+
+			EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( ( result != 0 )
+			 && ( xml_string_sizes[ file_index ] > 0 ) )
+			{
+				xml_strings[ file_index ] = (uint8_t *) memory_allocate(
+				                                         sizeof( uint8_t ) * xml_string_sizes[ file_index ] );
+
+				EVTX_TEST_ASSERT_IS_NOT_NULL(
+				 "xml_string",
+				 xml_strings[ file_index ] );
+
+				result = libevtx_record_get_utf8_xml_string(
+				          records[ file_index ],
+				          xml_strings[ file_index ],
+				          xml_string_sizes[ file_index ],
+				          &error );
+
+				EVTX_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				EVTX_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+		}
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "identifier",
+		 identifiers[ 1 ],
+		 identifiers[ 0 ] );
+
+		EVTX_TEST_ASSERT_EQUAL_SIZE(
+		 "xml_string_size",
+		 xml_string_sizes[ 1 ],
+		 xml_string_sizes[ 0 ] );
+
+		if( xml_strings[ 0 ] != NULL )
+		{
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "xml_string",
+			 xml_strings[ 1 ] );
+
+			result = memory_compare(
+			          xml_strings[ 1 ],
+			          xml_strings[ 0 ],
+			          xml_string_sizes[ 0 ] );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		for( file_index = 0;
+		     file_index < 2;
+		     file_index++ )
+		{
+			if( xml_strings[ file_index ] != NULL )
+			{
+				memory_free(
+				 xml_strings[ file_index ] );
+
+				xml_strings[ file_index ] = NULL;
+			}
+			result = libevtx_record_free(
+			          &( records[ file_index ] ),
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Clean up
+	 */
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		result = libevtx_file_close(
+		          files[ file_index ],
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_free(
+		          &( files[ file_index ] ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "file",
+		 files[ file_index ] );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		if( xml_strings[ file_index ] != NULL )
+		{
+			memory_free(
+			 xml_strings[ file_index ] );
+		}
+		if( records[ file_index ] != NULL )
+		{
+			libevtx_record_free(
+			 &( records[ file_index ] ),
+			 NULL );
+		}
+		if( files[ file_index ] != NULL )
+		{
+			libevtx_file_free(
+			 &( files[ file_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
 /* Tests the libevtx_file_signal_abort function
  * Returns 1 if successful or 0 if not
  */
@@ -1738,6 +2359,241 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevtx_file_get_record_by_logical_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_record_by_logical_index(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	libevtx_record_t *record  = 0;
+	uint64_t first_identifier = 0;
+	uint64_t last_identifier  = 0;
+	int number_of_records     = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_record_by_logical_index(
+	          file,
+	          0,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	result = libevtx_record_get_identifier(
+	          record,
+	          &first_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_free(
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_record_by_logical_index(
+	          file,
+	          number_of_records - 1,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	result = libevtx_record_get_identifier(
+	          record,
+	          &last_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_free(
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_LESS_THAN_UINT64(
+	 "first_identifier",
+	 first_identifier,
+	 last_identifier + 1 );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_record_by_logical_index(
+	          NULL,
+	          0,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_by_logical_index(
+	          file,
+	          -1,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_by_logical_index(
+	          file,
+	          number_of_records,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_by_logical_index(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libevtx_file_get_number_of_recovered_records function
  * Returns 1 if successful or 0 if not
  */
@@ -2100,6 +2956,21 @@ int main(
 		 evtx_test_file_open_close,
 		 source );
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_open_recovery",
+		 evtx_test_file_open_recovery,
+		 source );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_read_ahead",
+		 evtx_test_file_read_ahead,
+		 source );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_free_record_after_file",
+		 evtx_test_file_free_record_after_file,
+		 source );
+
 		/* Initialize file for tests
 		 */
 		result = evtx_test_file_open_source(
@@ -2162,6 +3033,11 @@ int main(
 		 evtx_test_file_get_record_by_index,
 		 file );
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_record_by_logical_index",
+		 evtx_test_file_get_record_by_logical_index,
+		 file );
+
 		EVTX_TEST_RUN_WITH_ARGS(
 		 "libevtx_file_get_number_of_recovered_records",
 		 evtx_test_file_get_number_of_recovered_records,
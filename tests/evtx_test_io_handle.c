@@ -27,6 +27,8 @@
 #include <stdlib.h>
 #endif
 
+#include "evtx_test_functions.h"
+#include "evtx_test_libbfio.h"
 #include "evtx_test_libcerror.h"
 #include "evtx_test_libevtx.h"
 #include "evtx_test_macros.h"
@@ -35,6 +37,18 @@
 
 #include "../libevtx/libevtx_io_handle.h"
 
+/* File header of a file with 100000 chunks, where the 16-bit number of chunks has wrapped
+ */
+uint8_t evtx_test_io_handle_file_header_data1[ 128 ] = {
+	0x45, 0x6c, 0x66, 0x46, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x9f, 0x86, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x86, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x10, 0xa0, 0x86, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xdb, 0xb3, 0xb0 };
+
 #if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
 
 /* Tests the libevtx_io_handle_initialize function
@@ -398,6 +412,706 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevtx_io_handle_read_file_header_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_io_handle_read_file_header_data(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libevtx_io_handle_t *io_handle = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_io_handle_read_file_header_data(
+	          io_handle,
+	          evtx_test_io_handle_file_header_data1,
+	          128,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->number_of_chunks",
+	 io_handle->number_of_chunks,
+	 (uint32_t) 100000 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED",
+	 (int) ( io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED ),
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_io_handle_read_file_header_data(
+	          NULL,
+	          evtx_test_io_handle_file_header_data1,
+	          128,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_io_handle_read_file_header_data(
+	          io_handle,
+	          NULL,
+	          128,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_io_handle_read_file_header_data(
+	          io_handle,
+	          evtx_test_io_handle_file_header_data1,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libevtx_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_io_handle_read_chunk_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_io_handle_read_chunk_data(
+     void )
+{
+	uint8_t chunk_data[ 1024 ];
+	uint8_t file_data[ 5120 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevtx_io_handle_t *io_handle   = NULL;
+	size_t data_offset               = 0;
+	ssize_t read_count               = 0;
+	int result                       = 0;
+
+	for( data_offset = 0;
+	     data_offset < 5120;
+	     data_offset++ )
+	{
+		file_data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	/* Initialize test
+	 */
+	result = libevtx_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use a small chunk size so that the read-ahead buffer
+	 * of at most 8 chunks, 4096 bytes, does not cover the entire file
+	 */
+	io_handle->chunk_size = 512;
+	io_handle->flags     |= LIBEVTX_IO_HANDLE_FLAG_READ_AHEAD;
+
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          5120,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read with an empty read-ahead buffer that does not follow previously read chunk data
+	 */
+	read_count = libevtx_io_handle_read_chunk_data(
+	              io_handle,
+	              file_io_handle,
+	              0,
+	              chunk_data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "io_handle->read_ahead_buffer",
+	 io_handle->read_ahead_buffer );
+
+	EVTX_TEST_ASSERT_EQUAL_INT64(
+	 "io_handle->next_chunk_data_offset",
+	 (int64_t) io_handle->next_chunk_data_offset,
+	 (int64_t) 512 );
+
+	result = memory_compare(
+	          chunk_data,
+	          file_data,
+	          512 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a sequential read that fills a read-ahead buffer of 2 chunks
+	 */
+	read_count = libevtx_io_handle_read_chunk_data(
+	              io_handle,
+	              file_io_handle,
+	              512,
+	              chunk_data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle->read_ahead_buffer",
+	 io_handle->read_ahead_buffer );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->read_ahead_buffer_size",
+	 io_handle->read_ahead_buffer_size,
+	 (size_t) 1024 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT64(
+	 "io_handle->read_ahead_file_offset",
+	 (int64_t) io_handle->read_ahead_file_offset,
+	 (int64_t) 512 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->read_ahead_data_size",
+	 io_handle->read_ahead_data_size,
+	 (size_t) 1024 );
+
+	result = memory_compare(
+	          chunk_data,
+	          &( file_data[ 512 ] ),
+	          512 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that is served from the read-ahead buffer of 2 chunks
+	 */
+	read_count = libevtx_io_handle_read_chunk_data(
+	              io_handle,
+	              file_io_handle,
+	              1024,
+	              chunk_data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT64(
+	 "io_handle->next_chunk_data_offset",
+	 (int64_t) io_handle->next_chunk_data_offset,
+	 (int64_t) 1536 );
+
+	/* Test a sequential read that grows the read-ahead buffer to 4 chunks
+	 */
+	read_count = libevtx_io_handle_read_chunk_data(
+	              io_handle,
+	              file_io_handle,
+	              1536,
+	              chunk_data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle->read_ahead_buffer",
+	 io_handle->read_ahead_buffer );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->read_ahead_buffer_size",
+	 io_handle->read_ahead_buffer_size,
+	 (size_t) 2048 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT64(
+	 "io_handle->read_ahead_file_offset",
+	 (int64_t) io_handle->read_ahead_file_offset,
+	 (int64_t) 1536 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->read_ahead_data_size",
+	 io_handle->read_ahead_data_size,
+	 (size_t) 2048 );
+
+	result = memory_compare(
+	          chunk_data,
+	          &( file_data[ 1536 ] ),
+	          512 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Change the file data to detect reads that bypass the read-ahead buffer
+	 */
+	for( data_offset = 0;
+	     data_offset < 5120;
+	     data_offset++ )
+	{
+		file_data[ data_offset ] ^= 0xff;
+	}
+	/* Test a read that is served from the read-ahead buffer
+	 */
+	read_count = libevtx_io_handle_read_chunk_data(
+	              io_handle,
+	              file_io_handle,
+	              2048,
+	              chunk_data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT64(
+	 "io_handle->next_chunk_data_offset",
+	 (int64_t) io_handle->next_chunk_data_offset,
+	 (int64_t) 2560 );
+
+	for( data_offset = 0;
+	     data_offset < 512;
+	     data_offset++ )
+	{
+		EVTX_TEST_ASSERT_EQUAL_UINT8(
+		 "chunk_data[ data_offset ]",
+		 chunk_data[ data_offset ],
+		 (uint8_t) ( ( 2048 + data_offset ) % 251 ) );
+	}
+	/* Test a read outside the read-ahead buffer that does not follow previously read chunk data
+	 */
+	read_count = libevtx_io_handle_read_chunk_data(
+	              io_handle,
+	              file_io_handle,
+	              4608,
+	              chunk_data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT64(
+	 "io_handle->read_ahead_file_offset",
+	 (int64_t) io_handle->read_ahead_file_offset,
+	 (int64_t) 1536 );
+
+	result = memory_compare(
+	          chunk_data,
+	          &( file_data[ 4608 ] ),
+	          512 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a sequential read at the end of the file that only partially fills the read-ahead buffer
+	 */
+	io_handle->next_chunk_data_offset = 4608;
+
+	read_count = libevtx_io_handle_read_chunk_data(
+	              io_handle,
+	              file_io_handle,
+	              4608,
+	              chunk_data,
+	              1024,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->read_ahead_buffer_size",
+	 io_handle->read_ahead_buffer_size,
+	 (size_t) 4096 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT64(
+	 "io_handle->read_ahead_file_offset",
+	 (int64_t) io_handle->read_ahead_file_offset,
+	 (int64_t) 4608 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->read_ahead_data_size",
+	 io_handle->read_ahead_data_size,
+	 (size_t) 512 );
+
+	result = memory_compare(
+	          chunk_data,
+	          &( file_data[ 4608 ] ),
+	          512 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a sequential read at the end of the file that leaves the read-ahead buffer empty
+	 */
+	read_count = libevtx_io_handle_read_chunk_data(
+	              io_handle,
+	              file_io_handle,
+	              5120,
+	              chunk_data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->read_ahead_data_size",
+	 io_handle->read_ahead_data_size,
+	 (size_t) 0 );
+
+	/* Test a read after the read-ahead buffer was emptied
+	 */
+	result = libevtx_io_handle_empty_read_ahead_buffer(
+	          io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "io_handle->read_ahead_buffer",
+	 io_handle->read_ahead_buffer );
+
+	read_count = libevtx_io_handle_read_chunk_data(
+	              io_handle,
+	              file_io_handle,
+	              2048,
+	              chunk_data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          chunk_data,
+	          &( file_data[ 2048 ] ),
+	          512 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	read_count = libevtx_io_handle_read_chunk_data(
+	              NULL,
+	              file_io_handle,
+	              0,
+	              chunk_data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libevtx_io_handle_read_chunk_data(
+	              io_handle,
+	              file_io_handle,
+	              -1,
+	              chunk_data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libevtx_io_handle_read_chunk_data(
+	              io_handle,
+	              file_io_handle,
+	              0,
+	              NULL,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libevtx_io_handle_read_chunk_data(
+	              io_handle,
+	              file_io_handle,
+	              0,
+	              chunk_data,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = evtx_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libevtx_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +1143,14 @@ int main(
 	 "libevtx_io_handle_clear",
 	 evtx_test_io_handle_clear );
 
+	EVTX_TEST_RUN(
+	 "libevtx_io_handle_read_file_header_data",
+	 evtx_test_io_handle_read_file_header_data );
+
+	EVTX_TEST_RUN(
+	 "libevtx_io_handle_read_chunk_data",
+	 evtx_test_io_handle_read_chunk_data );
+
 	/* TODO: add tests for libevtx_io_handle_read_file_header */
 
 	/* TODO: add tests for libevtx_io_handle_read_chunk */
@@ -0,0 +1,1125 @@
+/*
+ * Library name_index type test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_name_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_name_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_name_index_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libevtx_name_index_t *name_index = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_free(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_name_index_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_index = (libevtx_name_index_t *) 0x12345678UL;
+
+	result = libevtx_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_index = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_name_index_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_name_index_initialize(
+		          &name_index,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( name_index != NULL )
+			{
+				libevtx_name_index_free(
+				 &name_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "name_index",
+			 name_index );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_name_index_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_name_index_initialize(
+		          &name_index,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( name_index != NULL )
+			{
+				libevtx_name_index_free(
+				 &name_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "name_index",
+			 name_index );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libevtx_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_name_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_name_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_name_index_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_name_index_add_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_name_index_add_reference(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libevtx_name_index_t *name_index = NULL;
+	libevtx_name_index_t *reference  = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_name_index_add_reference(
+	          name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_index->number_of_references",
+	 name_index->number_of_references,
+	 2 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Releasing the additional reference should not free the name index
+	 */
+	reference = name_index;
+
+	result = libevtx_name_index_free(
+	          &reference,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "reference",
+	 reference );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "name_index->number_of_references",
+	 name_index->number_of_references,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_name_index_add_reference(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_name_index_free(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libevtx_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_name_index_append_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_name_index_append_name(
+     void )
+{
+	uint8_t name[ 16 ];
+
+	libcerror_error_t *error         = NULL;
+	libevtx_name_index_t *name_index = NULL;
+	size_t name_length               = 0;
+	int number_of_entries            = 0;
+	int result                       = 0;
+	int test_number                  = 0;
+	int value_index                  = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Append more names than the minimum number of entries and buckets to test resizing and chaining
+	 */
+	for( test_number = 0;
+	     test_number < 100;
+	     test_number++ )
+	{
+		name[ 0 ] = (uint8_t) 'D';
+		name[ 1 ] = (uint8_t) 'a';
+		name[ 2 ] = (uint8_t) 't';
+		name[ 3 ] = (uint8_t) 'a';
+		name[ 4 ] = (uint8_t) ( '0' + ( test_number / 10 ) );
+		name[ 5 ] = (uint8_t) ( '0' + ( test_number % 10 ) );
+
+		name_length = 6;
+
+		result = libevtx_name_index_append_name(
+		          name_index,
+		          name,
+		          name_length,
+		          test_number,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_name_index_get_number_of_entries(
+	          name_index,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 100 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Appending a name that is already present retains the first value index
+	 */
+	result = libevtx_name_index_append_name(
+	          name_index,
+	          (uint8_t *) "Data42",
+	          6,
+	          1000,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_get_value_index_by_utf8_name(
+	          name_index,
+	          (uint8_t *) "Data42",
+	          6,
+	          &value_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 42 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_name_index_append_name(
+	          NULL,
+	          (uint8_t *) "Data",
+	          4,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_name_index_append_name(
+	          name_index,
+	          NULL,
+	          4,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_name_index_append_name(
+	          name_index,
+	          (uint8_t *) "Data",
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_name_index_append_name(
+	          name_index,
+	          (uint8_t *) "Data",
+	          4,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_name_index_free(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libevtx_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_name_index_get_value_index_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_name_index_get_value_index_by_utf8_name(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libevtx_name_index_t *name_index = NULL;
+	int result                       = 0;
+	int value_index                  = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_append_name(
+	          name_index,
+	          (uint8_t *) "SubjectUserSid",
+	          14,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_append_name(
+	          name_index,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          5,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_name_index_get_value_index_by_utf8_name(
+	          name_index,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          &value_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 5 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_get_value_index_by_utf8_name(
+	          name_index,
+	          (uint8_t *) "TargetUser",
+	          10,
+	          &value_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_name_index_get_value_index_by_utf8_name(
+	          NULL,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          &value_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_name_index_get_value_index_by_utf8_name(
+	          name_index,
+	          NULL,
+	          14,
+	          &value_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_name_index_get_value_index_by_utf8_name(
+	          name_index,
+	          (uint8_t *) "TargetUserName",
+	          (size_t) SSIZE_MAX + 1,
+	          &value_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_name_index_get_value_index_by_utf8_name(
+	          name_index,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_name_index_free(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libevtx_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_name_index_get_value_index_by_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_name_index_get_value_index_by_utf16_name(
+     void )
+{
+	uint16_t utf16_name[ 14 ]        = {
+		'T', 'a', 'r', 'g', 'e', 't', 'U', 's', 'e', 'r', 'N', 'a', 'm', 'e' };
+
+	libcerror_error_t *error         = NULL;
+	libevtx_name_index_t *name_index = NULL;
+	int result                       = 0;
+	int value_index                  = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_append_name(
+	          name_index,
+	          (uint8_t *) "SubjectUserSid",
+	          14,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_append_name(
+	          name_index,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          5,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_name_index_get_value_index_by_utf16_name(
+	          name_index,
+	          utf16_name,
+	          14,
+	          &value_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 5 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_get_value_index_by_utf16_name(
+	          name_index,
+	          utf16_name,
+	          10,
+	          &value_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_name_index_get_value_index_by_utf16_name(
+	          NULL,
+	          utf16_name,
+	          14,
+	          &value_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_name_index_get_value_index_by_utf16_name(
+	          name_index,
+	          NULL,
+	          14,
+	          &value_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_name_index_get_value_index_by_utf16_name(
+	          name_index,
+	          utf16_name,
+	          (size_t) SSIZE_MAX + 1,
+	          &value_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_name_index_get_value_index_by_utf16_name(
+	          name_index,
+	          utf16_name,
+	          14,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_name_index_free(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libevtx_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_name_index_initialize",
+	 evtx_test_name_index_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_name_index_free",
+	 evtx_test_name_index_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_name_index_add_reference",
+	 evtx_test_name_index_add_reference );
+
+	EVTX_TEST_RUN(
+	 "libevtx_name_index_append_name",
+	 evtx_test_name_index_append_name );
+
+	EVTX_TEST_RUN(
+	 "libevtx_name_index_get_value_index_by_utf8_name",
+	 evtx_test_name_index_get_value_index_by_utf8_name );
+
+	EVTX_TEST_RUN(
+	 "libevtx_name_index_get_value_index_by_utf16_name",
+	 evtx_test_name_index_get_value_index_by_utf16_name );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,12 +21,15 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "evtx_test_getopt.h"
 #include "evtx_test_libcerror.h"
 #include "evtx_test_libevtx.h"
 #include "evtx_test_macros.h"
@@ -73,21 +76,2152 @@ on_error:
 	return( 0 );
 }
 
+/* Compares a borrowed UTF-8 encoded string of a record with its copy
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_compare_utf8_string_reference(
+     libevtx_record_t *record,
+     int (*get_utf8_string_size)(
+            libevtx_record_t *record,
+            size_t *utf8_string_size,
+            libevtx_error_t **error ),
+     int (*get_utf8_string)(
+            libevtx_record_t *record,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libevtx_error_t **error ),
+     int (*get_utf8_string_reference)(
+            libevtx_record_t *record,
+            const uint8_t **utf8_string,
+            size_t *utf8_string_size,
+            libevtx_error_t **error ) )
+{
+	uint8_t utf8_string[ 512 ];
+
+	const uint8_t *utf8_string_reference = NULL;
+	libcerror_error_t *error             = NULL;
+	size_t utf8_string_reference_size    = 0;
+	size_t utf8_string_size              = 0;
+	int expected_result                  = 0;
+	int result                           = 0;
+
+	expected_result = get_utf8_string_size(
+	                   record,
+	                   &utf8_string_size,
+	                   &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "expected_result",
+	 expected_result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = get_utf8_string_reference(
+	          record,
+	          &utf8_string_reference,
+	          &utf8_string_reference_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( expected_result != 0 )
+	{
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "utf8_string_reference",
+		 utf8_string_reference );
+
+		EVTX_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_reference_size",
+		 utf8_string_reference_size,
+		 utf8_string_size );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT8(
+		 "utf8_string_reference[ utf8_string_reference_size - 1 ]",
+		 utf8_string_reference[ utf8_string_reference_size - 1 ],
+		 0 );
+
+		if( utf8_string_size <= 512 )
+		{
+			result = get_utf8_string(
+			          record,
+			          utf8_string,
+			          512,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          utf8_string_reference,
+			          utf8_string,
+			          utf8_string_size );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = get_utf8_string_reference(
+	          NULL,
+	          &utf8_string_reference,
+	          &utf8_string_reference_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = get_utf8_string_reference(
+	          record,
+	          NULL,
+	          &utf8_string_reference_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = get_utf8_string_reference(
+	          record,
+	          &utf8_string_reference,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_utf8_provider_identifier_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf8_provider_identifier_reference(
+     libevtx_record_t *record )
+{
+	return( evtx_test_record_compare_utf8_string_reference(
+	         record,
+	         &libevtx_record_get_utf8_provider_identifier_size,
+	         &libevtx_record_get_utf8_provider_identifier,
+	         &libevtx_record_get_utf8_provider_identifier_reference ) );
+}
+
+/* Tests the libevtx_record_get_utf8_source_name_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf8_source_name_reference(
+     libevtx_record_t *record )
+{
+	return( evtx_test_record_compare_utf8_string_reference(
+	         record,
+	         &libevtx_record_get_utf8_source_name_size,
+	         &libevtx_record_get_utf8_source_name,
+	         &libevtx_record_get_utf8_source_name_reference ) );
+}
+
+/* Tests the libevtx_record_get_utf8_channel_name_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf8_channel_name_reference(
+     libevtx_record_t *record )
+{
+	return( evtx_test_record_compare_utf8_string_reference(
+	         record,
+	         &libevtx_record_get_utf8_channel_name_size,
+	         &libevtx_record_get_utf8_channel_name,
+	         &libevtx_record_get_utf8_channel_name_reference ) );
+}
+
+/* Tests the libevtx_record_get_utf8_computer_name_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf8_computer_name_reference(
+     libevtx_record_t *record )
+{
+	return( evtx_test_record_compare_utf8_string_reference(
+	         record,
+	         &libevtx_record_get_utf8_computer_name_size,
+	         &libevtx_record_get_utf8_computer_name,
+	         &libevtx_record_get_utf8_computer_name_reference ) );
+}
+
+/* Tests the libevtx_record_get_utf8_user_security_identifier_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf8_user_security_identifier_reference(
+     libevtx_record_t *record )
+{
+	return( evtx_test_record_compare_utf8_string_reference(
+	         record,
+	         &libevtx_record_get_utf8_user_security_identifier_size,
+	         &libevtx_record_get_utf8_user_security_identifier,
+	         &libevtx_record_get_utf8_user_security_identifier_reference ) );
+}
+
+/* Tests the libevtx_record_get_utf8_string_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf8_string_reference(
+     libevtx_record_t *record )
+{
+	uint8_t utf8_string[ 512 ];
+
+	const uint8_t *utf8_string_reference = NULL;
+	libcerror_error_t *error             = NULL;
+	size_t utf8_string_reference_size    = 0;
+	size_t utf8_string_size              = 0;
+	int number_of_strings                = 0;
+	int result                           = 0;
+	int string_index                     = 0;
+
+	result = libevtx_record_get_number_of_strings(
+	          record,
+	          &number_of_strings,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		result = libevtx_record_get_utf8_string_size(
+		          record,
+		          string_index,
+		          &utf8_string_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_utf8_string_reference(
+		          record,
+		          string_index,
+		          &utf8_string_reference,
+		          &utf8_string_reference_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "utf8_string_reference",
+		 utf8_string_reference );
+
+		EVTX_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_reference_size",
+		 utf8_string_reference_size,
+		 utf8_string_size );
+
+		if( ( utf8_string_size > 0 )
+		 && ( utf8_string_size <= 512 ) )
+		{
+			result = libevtx_record_get_utf8_string(
+			          record,
+			          string_index,
+			          utf8_string,
+			          512,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          utf8_string_reference,
+			          utf8_string,
+			          utf8_string_size );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libevtx_record_get_utf8_string_reference(
+	          NULL,
+	          0,
+	          &utf8_string_reference,
+	          &utf8_string_reference_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_get_utf8_string_reference(
+	          record,
+	          -1,
+	          &utf8_string_reference,
+	          &utf8_string_reference_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_get_utf8_string_reference(
+	          record,
+	          number_of_strings,
+	          &utf8_string_reference,
+	          &utf8_string_reference_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_data_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_data_reference(
+     libevtx_record_t *record )
+{
+	uint8_t data[ 4096 ];
+
+	const uint8_t *data_reference = NULL;
+	libcerror_error_t *error      = NULL;
+	size_t data_reference_size    = 0;
+	size_t data_size              = 0;
+	int expected_result           = 0;
+	int result                    = 0;
+
+	expected_result = libevtx_record_get_data_size(
+	                   record,
+	                   &data_size,
+	                   &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "expected_result",
+	 expected_result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_data_reference(
+	          record,
+	          &data_reference,
+	          &data_reference_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( expected_result != 0 )
+	{
+		EVTX_TEST_ASSERT_EQUAL_SIZE(
+		 "data_reference_size",
+		 data_reference_size,
+		 data_size );
+
+		if( ( data_size > 0 )
+		 && ( data_size <= 4096 ) )
+		{
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "data_reference",
+			 data_reference );
+
+			result = libevtx_record_get_data(
+			          record,
+			          data,
+			          4096,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          data_reference,
+			          data,
+			          data_size );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libevtx_record_get_data_reference(
+	          NULL,
+	          &data_reference,
+	          &data_reference_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_get_data_reference(
+	          record,
+	          NULL,
+	          &data_reference_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_string_index_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_string_index_by_utf8_name(
+     libevtx_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int string_index         = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_string_index_by_utf8_name(
+	          record,
+	          (uint8_t *) "evtx_test_no_such_name",
+	          22,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_string_index_by_utf8_name(
+	          NULL,
+	          (uint8_t *) "evtx_test_no_such_name",
+	          22,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_get_string_index_by_utf8_name(
+	          record,
+	          NULL,
+	          22,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_get_string_index_by_utf8_name(
+	          record,
+	          (uint8_t *) "evtx_test_no_such_name",
+	          22,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_string_index_by_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_string_index_by_utf16_name(
+     libevtx_record_t *record )
+{
+	uint16_t utf16_name[ 7 ] = {
+		'n', 'o', 's', 'u', 'c', 'h', 0 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int string_index         = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_string_index_by_utf16_name(
+	          record,
+	          utf16_name,
+	          6,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_string_index_by_utf16_name(
+	          NULL,
+	          utf16_name,
+	          6,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_get_string_index_by_utf16_name(
+	          record,
+	          NULL,
+	          6,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_get_string_index_by_utf16_name(
+	          record,
+	          utf16_name,
+	          0,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_string_value_type function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_string_value_type(
+     libevtx_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	size_t data_size         = 0;
+	uint8_t value_type       = 0;
+	int number_of_strings    = 0;
+	int result               = 0;
+
+	result = libevtx_record_get_number_of_strings(
+	          record,
+	          &number_of_strings,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_strings == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_record_get_string_value_type(
+	          record,
+	          0,
+	          &value_type,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_get_string_data_size(
+	          record,
+	          0,
+	          &data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_get_string_value_type(
+	          NULL,
+	          0,
+	          &value_type,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_get_string_value_type(
+	          record,
+	          -1,
+	          &value_type,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_get_string_value_type(
+	          record,
+	          number_of_strings,
+	          &value_type,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The string names found in the event XML of a record
+ */
+typedef struct evtx_test_record_names evtx_test_record_names_t;
+
+struct evtx_test_record_names
+{
+	/* The depth of the current element
+	 */
+	int depth;
+
+	/* The depth of the EventData element or 0 if not set
+	 */
+	int event_data_depth;
+
+	/* The depth of the UserData element or 0 if not set
+	 */
+	int user_data_depth;
+
+	/* The number of elements of the UserData element
+	 */
+	int number_of_user_data_elements;
+
+	/* The depth of the current leaf element or 0 if not set
+	 */
+	int leaf_depth;
+
+	/* Value to indicate the current leaf element has a value
+	 */
+	int leaf_has_value;
+
+	/* The name of the current leaf element
+	 */
+	uint8_t leaf_name[ 64 ];
+
+	/* The length of the name of the current leaf element
+	 */
+	size_t leaf_name_length;
+
+	/* The value of the Name attribute of the first EventData Data element
+	 */
+	uint8_t event_data_name[ 64 ];
+
+	/* The length of the value of the Name attribute of the first EventData Data element
+	 */
+	size_t event_data_name_length;
+
+	/* The name of the first UserData leaf element with a value
+	 */
+	uint8_t user_data_name[ 64 ];
+
+	/* The length of the name of the first UserData leaf element with a value
+	 */
+	size_t user_data_name_length;
+};
+
+/* Start element callback that tracks the EventData and UserData elements
+ * Returns 1 to continue
+ */
+int evtx_test_record_names_start_element(
+     void *context,
+     const uint8_t *name,
+     size_t name_length,
+     libcerror_error_t **error EVTX_TEST_ATTRIBUTE_UNUSED )
+{
+	evtx_test_record_names_t *names = (evtx_test_record_names_t *) context;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( error )
+
+	names->depth += 1;
+
+	if( ( name_length == 9 )
+	 && ( memory_compare(
+	       name,
+	       "EventData",
+	       9 ) == 0 ) )
+	{
+		names->event_data_depth = names->depth;
+	}
+	else if( ( name_length == 8 )
+	      && ( memory_compare(
+	            name,
+	            "UserData",
+	            8 ) == 0 ) )
+	{
+		names->user_data_depth              = names->depth;
+		names->number_of_user_data_elements = 0;
+	}
+	else if( ( names->user_data_depth != 0 )
+	      && ( names->depth == ( names->user_data_depth + 1 ) ) )
+	{
+		names->number_of_user_data_elements += 1;
+	}
+	/* The strings of UserData are the leaf elements of its only element
+	 */
+	names->leaf_depth = 0;
+
+	if( ( names->user_data_depth != 0 )
+	 && ( names->depth >= ( names->user_data_depth + 2 ) )
+	 && ( name_length > 0 )
+	 && ( name_length < 64 ) )
+	{
+		if( memory_copy(
+		     names->leaf_name,
+		     name,
+		     name_length ) != NULL )
+		{
+			names->leaf_depth       = names->depth;
+			names->leaf_has_value   = 0;
+			names->leaf_name_length = name_length;
+		}
+	}
+	return( 1 );
+}
+
+/* Attribute callback that retrieves the Name attribute of the first EventData Data element
+ * Returns 1 to continue
+ */
+int evtx_test_record_names_attribute(
+     void *context,
+     const uint8_t *name,
+     size_t name_length,
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error EVTX_TEST_ATTRIBUTE_UNUSED )
+{
+	evtx_test_record_names_t *names = (evtx_test_record_names_t *) context;
+	size_t name_index               = 0;
+	size_t value_data_offset        = 0;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( names->event_data_depth == 0 )
+	 || ( names->depth != ( names->event_data_depth + 1 ) )
+	 || ( names->event_data_name_length != 0 )
+	 || ( value_type != LIBEVTX_VALUE_TYPE_STRING_UTF16 )
+	 || ( name_length != 4 )
+	 || ( memory_compare(
+	       name,
+	       "Name",
+	       4 ) != 0 ) )
+	{
+		return( 1 );
+	}
+	/* Only ASCII names are used so they can be compared as UTF-8 and UTF-16
+	 */
+	for( value_data_offset = 0;
+	     ( value_data_offset + 1 ) < value_data_size;
+	     value_data_offset += 2 )
+	{
+		if( ( value_data[ value_data_offset ] == 0 )
+		 && ( value_data[ value_data_offset + 1 ] == 0 ) )
+		{
+			break;
+		}
+		if( ( value_data[ value_data_offset ] >= 0x80 )
+		 || ( value_data[ value_data_offset + 1 ] != 0 )
+		 || ( name_index >= 63 ) )
+		{
+			return( 1 );
+		}
+		names->event_data_name[ name_index++ ] = value_data[ value_data_offset ];
+	}
+	names->event_data_name_length = name_index;
+
+	return( 1 );
+}
+
+/* Value callback that marks the current leaf element as having a value
+ * Returns 1 to continue
+ */
+int evtx_test_record_names_value(
+     void *context,
+     uint8_t value_type EVTX_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *value_data EVTX_TEST_ATTRIBUTE_UNUSED,
+     size_t value_data_size EVTX_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error EVTX_TEST_ATTRIBUTE_UNUSED )
+{
+	evtx_test_record_names_t *names = (evtx_test_record_names_t *) context;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( value_type )
+	EVTX_TEST_UNREFERENCED_PARAMETER( value_data )
+	EVTX_TEST_UNREFERENCED_PARAMETER( value_data_size )
+	EVTX_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( names->leaf_depth == names->depth )
+	{
+		names->leaf_has_value = 1;
+	}
+	return( 1 );
+}
+
+/* End element callback that retrieves the name of the first UserData leaf element with a value
+ * Returns 1 to continue
+ */
+int evtx_test_record_names_end_element(
+     void *context,
+     const uint8_t *name EVTX_TEST_ATTRIBUTE_UNUSED,
+     size_t name_length EVTX_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error EVTX_TEST_ATTRIBUTE_UNUSED )
+{
+	evtx_test_record_names_t *names = (evtx_test_record_names_t *) context;
+	size_t name_index               = 0;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( name )
+	EVTX_TEST_UNREFERENCED_PARAMETER( name_length )
+	EVTX_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( names->leaf_depth != 0 )
+	 && ( names->leaf_depth == names->depth )
+	 && ( names->leaf_has_value != 0 )
+	 && ( names->user_data_name_length == 0 ) )
+	{
+		for( name_index = 0;
+		     name_index < names->leaf_name_length;
+		     name_index++ )
+		{
+			if( names->leaf_name[ name_index ] >= 0x80 )
+			{
+				break;
+			}
+		}
+		if( name_index == names->leaf_name_length )
+		{
+			if( memory_copy(
+			     names->user_data_name,
+			     names->leaf_name,
+			     names->leaf_name_length ) != NULL )
+			{
+				names->user_data_name_length = names->leaf_name_length;
+			}
+		}
+	}
+	names->leaf_depth = 0;
+
+	if( names->depth == names->event_data_depth )
+	{
+		names->event_data_depth = 0;
+	}
+	else if( names->depth == names->user_data_depth )
+	{
+		/* The strings of UserData are only parsed if it contains a single element
+		 */
+		if( names->number_of_user_data_elements != 1 )
+		{
+			names->user_data_name_length = 0;
+		}
+		names->user_data_depth = 0;
+	}
+	names->depth -= 1;
+
+	return( 1 );
+}
+
+/* Looks up a string index by UTF-8 and UTF-16 name and checks that both agree
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_compare_string_index_by_name(
+     libevtx_record_t *record,
+     const uint8_t *name,
+     size_t name_length,
+     int *number_of_found_names )
+{
+	uint16_t utf16_name[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	size_t name_index        = 0;
+	int number_of_strings    = 0;
+	int result               = 0;
+	int string_index         = 0;
+	int utf16_result         = 0;
+	int utf16_string_index   = 0;
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "number_of_found_names",
+	 number_of_found_names );
+
+	EVTX_TEST_ASSERT_GREATER_THAN_INT(
+	 "name_length",
+	 (int) name_length,
+	 0 );
+
+	EVTX_TEST_ASSERT_LESS_THAN_INT(
+	 "name_length",
+	 (int) name_length,
+	 64 );
+
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		utf16_name[ name_index ] = (uint16_t) name[ name_index ];
+	}
+	result = libevtx_record_get_number_of_strings(
+	          record,
+	          &number_of_strings,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_get_string_index_by_utf8_name(
+	          record,
+	          name,
+	          name_length,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_result = libevtx_record_get_string_index_by_utf16_name(
+	                record,
+	                utf16_name,
+	                name_length,
+	                &utf16_string_index,
+	                &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "utf16_result",
+	 utf16_result,
+	 result );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		EVTX_TEST_ASSERT_GREATER_THAN_INT(
+		 "string_index",
+		 string_index,
+		 -1 );
+
+		EVTX_TEST_ASSERT_LESS_THAN_INT(
+		 "string_index",
+		 string_index,
+		 number_of_strings );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "utf16_string_index",
+		 utf16_string_index,
+		 string_index );
+
+		*number_of_found_names += 1;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_string_index_by_utf8_name and libevtx_record_get_string_index_by_utf16_name
+ * functions with the EventData and UserData names of the records of a file
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_string_index_by_name(
+     libevtx_file_t *file )
+{
+	evtx_test_record_names_t names;
+
+	libcerror_error_t *error             = NULL;
+	libevtx_record_t *record             = NULL;
+	int number_of_event_data_names       = 0;
+	int number_of_found_event_data_names = 0;
+	int number_of_found_user_data_names  = 0;
+	int number_of_records                = 0;
+	int number_of_user_data_names        = 0;
+	int record_index                     = 0;
+	int result                           = 0;
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The records of a file are parsed without a template definition
+	 * hence every record builds its own name index on the first lookup
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( ( number_of_found_event_data_names > 0 )
+		 && ( number_of_found_user_data_names > 0 ) )
+		{
+			break;
+		}
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( memory_set(
+		     &names,
+		     0,
+		     sizeof( evtx_test_record_names_t ) ) == NULL )
+		{
+			goto on_error;
+		}
+		result = libevtx_record_parse_with_callbacks(
+		          record,
+		          &evtx_test_record_names_start_element,
+		          &evtx_test_record_names_attribute,
+		          &evtx_test_record_names_value,
+		          &evtx_test_record_names_end_element,
+		          (void *) &names,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( names.event_data_name_length > 0 )
+		{
+			number_of_event_data_names++;
+
+			result = evtx_test_record_compare_string_index_by_name(
+			          record,
+			          names.event_data_name,
+			          names.event_data_name_length,
+			          &number_of_found_event_data_names );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		if( names.user_data_name_length > 0 )
+		{
+			number_of_user_data_names++;
+
+			result = evtx_test_record_compare_string_index_by_name(
+			          record,
+			          names.user_data_name,
+			          names.user_data_name_length,
+			          &number_of_found_user_data_names );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* A name can refer to an element that is not a string, such as a Data element
+	 * without a substituted value, but at least one name should be found
+	 */
+	if( number_of_event_data_names > 0 )
+	{
+		EVTX_TEST_ASSERT_GREATER_THAN_INT(
+		 "number_of_found_event_data_names",
+		 number_of_found_event_data_names,
+		 0 );
+	}
+	if( number_of_user_data_names > 0 )
+	{
+		EVTX_TEST_ASSERT_GREATER_THAN_INT(
+		 "number_of_found_user_data_names",
+		 number_of_found_user_data_names,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The callback counts of parsing the event XML of a record
+ */
+typedef struct evtx_test_record_callback_counts evtx_test_record_callback_counts_t;
+
+struct evtx_test_record_callback_counts
+{
+	/* The number of start element callbacks
+	 */
+	int number_of_start_elements;
+
+	/* The number of attribute callbacks
+	 */
+	int number_of_attributes;
+
+	/* The number of value callbacks
+	 */
+	int number_of_values;
+
+	/* The number of end element callbacks
+	 */
+	int number_of_end_elements;
+
+	/* The total number of callbacks after which to stop or 0 to not stop
+	 */
+	int stop_after;
+
+	/* The value returned when stopping
+	 */
+	int stop_result;
+};
+
+/* Determines the callback result after a callback was counted
+ * Returns 1 to continue or the stop result
+ */
+int evtx_test_record_callback_counts_get_result(
+     evtx_test_record_callback_counts_t *counts )
+{
+	int number_of_callbacks = counts->number_of_start_elements
+	                        + counts->number_of_attributes
+	                        + counts->number_of_values
+	                        + counts->number_of_end_elements;
+
+	if( ( counts->stop_after > 0 )
+	 && ( number_of_callbacks >= counts->stop_after ) )
+	{
+		return( counts->stop_result );
+	}
+	return( 1 );
+}
+
+/* Start element callback that counts the start elements
+ * Returns 1 to continue or the stop result
+ */
+int evtx_test_record_count_start_element(
+     void *context,
+     const uint8_t *name,
+     size_t name_length EVTX_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error EVTX_TEST_ATTRIBUTE_UNUSED )
+{
+	evtx_test_record_callback_counts_t *counts = (evtx_test_record_callback_counts_t *) context;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( name_length )
+	EVTX_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( name == NULL )
+	{
+		return( -1 );
+	}
+	counts->number_of_start_elements += 1;
+
+	return( evtx_test_record_callback_counts_get_result(
+	         counts ) );
+}
+
+/* Attribute callback that counts the attributes
+ * Returns 1 to continue or the stop result
+ */
+int evtx_test_record_count_attribute(
+     void *context,
+     const uint8_t *name,
+     size_t name_length EVTX_TEST_ATTRIBUTE_UNUSED,
+     uint8_t value_type EVTX_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *value_data EVTX_TEST_ATTRIBUTE_UNUSED,
+     size_t value_data_size EVTX_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error EVTX_TEST_ATTRIBUTE_UNUSED )
+{
+	evtx_test_record_callback_counts_t *counts = (evtx_test_record_callback_counts_t *) context;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( name_length )
+	EVTX_TEST_UNREFERENCED_PARAMETER( value_type )
+	EVTX_TEST_UNREFERENCED_PARAMETER( value_data )
+	EVTX_TEST_UNREFERENCED_PARAMETER( value_data_size )
+	EVTX_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( name == NULL )
+	{
+		return( -1 );
+	}
+	counts->number_of_attributes += 1;
+
+	return( evtx_test_record_callback_counts_get_result(
+	         counts ) );
+}
+
+/* Value callback that counts the values
+ * Returns 1 to continue or the stop result
+ */
+int evtx_test_record_count_value(
+     void *context,
+     uint8_t value_type EVTX_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error EVTX_TEST_ATTRIBUTE_UNUSED )
+{
+	evtx_test_record_callback_counts_t *counts = (evtx_test_record_callback_counts_t *) context;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( value_type )
+	EVTX_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( value_data == NULL )
+	 || ( value_data_size == 0 ) )
+	{
+		return( -1 );
+	}
+	counts->number_of_values += 1;
+
+	return( evtx_test_record_callback_counts_get_result(
+	         counts ) );
+}
+
+/* End element callback that counts the end elements
+ * Returns 1 to continue or the stop result
+ */
+int evtx_test_record_count_end_element(
+     void *context,
+     const uint8_t *name,
+     size_t name_length EVTX_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error EVTX_TEST_ATTRIBUTE_UNUSED )
+{
+	evtx_test_record_callback_counts_t *counts = (evtx_test_record_callback_counts_t *) context;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( name_length )
+	EVTX_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( name == NULL )
+	{
+		return( -1 );
+	}
+	counts->number_of_end_elements += 1;
+
+	return( evtx_test_record_callback_counts_get_result(
+	         counts ) );
+}
+
+/* Tests the libevtx_record_parse_with_callbacks function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_parse_with_callbacks(
+     libevtx_record_t *record )
+{
+	evtx_test_record_callback_counts_t counts;
+	evtx_test_record_callback_counts_t expected_counts;
+
+	libcerror_error_t *error = NULL;
+	int number_of_callbacks  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	if( memory_set(
+	     &expected_counts,
+	     0,
+	     sizeof( evtx_test_record_callback_counts_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libevtx_record_parse_with_callbacks(
+	          record,
+	          &evtx_test_record_count_start_element,
+	          &evtx_test_record_count_attribute,
+	          &evtx_test_record_count_value,
+	          &evtx_test_record_count_end_element,
+	          (void *) &expected_counts,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_GREATER_THAN_INT(
+	 "expected_counts.number_of_start_elements",
+	 expected_counts.number_of_start_elements,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "expected_counts.number_of_end_elements",
+	 expected_counts.number_of_end_elements,
+	 expected_counts.number_of_start_elements );
+
+	number_of_callbacks = expected_counts.number_of_start_elements
+	                    + expected_counts.number_of_attributes
+	                    + expected_counts.number_of_values
+	                    + expected_counts.number_of_end_elements;
+
+	/* Parsing the same record again invokes the same callbacks
+	 */
+	if( memory_set(
+	     &counts,
+	     0,
+	     sizeof( evtx_test_record_callback_counts_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libevtx_record_parse_with_callbacks(
+	          record,
+	          &evtx_test_record_count_start_element,
+	          &evtx_test_record_count_attribute,
+	          &evtx_test_record_count_value,
+	          &evtx_test_record_count_end_element,
+	          (void *) &counts,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_start_elements",
+	 counts.number_of_start_elements,
+	 expected_counts.number_of_start_elements );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_attributes",
+	 counts.number_of_attributes,
+	 expected_counts.number_of_attributes );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_values",
+	 counts.number_of_values,
+	 expected_counts.number_of_values );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_end_elements",
+	 counts.number_of_end_elements,
+	 expected_counts.number_of_end_elements );
+
+	/* Only the callbacks that are set are invoked
+	 */
+	if( memory_set(
+	     &counts,
+	     0,
+	     sizeof( evtx_test_record_callback_counts_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libevtx_record_parse_with_callbacks(
+	          record,
+	          NULL,
+	          NULL,
+	          &evtx_test_record_count_value,
+	          NULL,
+	          (void *) &counts,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_start_elements",
+	 counts.number_of_start_elements,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_values",
+	 counts.number_of_values,
+	 expected_counts.number_of_values );
+
+	result = libevtx_record_parse_with_callbacks(
+	          record,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Stop parsing at the first start element
+	 */
+	if( memory_set(
+	     &counts,
+	     0,
+	     sizeof( evtx_test_record_callback_counts_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	counts.stop_after  = 1;
+	counts.stop_result = 0;
+
+	result = libevtx_record_parse_with_callbacks(
+	          record,
+	          &evtx_test_record_count_start_element,
+	          &evtx_test_record_count_attribute,
+	          &evtx_test_record_count_value,
+	          &evtx_test_record_count_end_element,
+	          (void *) &counts,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_start_elements",
+	 counts.number_of_start_elements,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_attributes",
+	 counts.number_of_attributes,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_values",
+	 counts.number_of_values,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_end_elements",
+	 counts.number_of_end_elements,
+	 0 );
+
+	/* Stop parsing half way, no callbacks are invoked after the stop
+	 */
+	if( number_of_callbacks > 2 )
+	{
+		if( memory_set(
+		     &counts,
+		     0,
+		     sizeof( evtx_test_record_callback_counts_t ) ) == NULL )
+		{
+			goto on_error;
+		}
+		counts.stop_after  = number_of_callbacks / 2;
+		counts.stop_result = 0;
+
+		result = libevtx_record_parse_with_callbacks(
+		          record,
+		          &evtx_test_record_count_start_element,
+		          &evtx_test_record_count_attribute,
+		          &evtx_test_record_count_value,
+		          &evtx_test_record_count_end_element,
+		          (void *) &counts,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = counts.number_of_start_elements
+		       + counts.number_of_attributes
+		       + counts.number_of_values
+		       + counts.number_of_end_elements;
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "number_of_callbacks",
+		 result,
+		 number_of_callbacks / 2 );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_record_parse_with_callbacks(
+	          NULL,
+	          &evtx_test_record_count_start_element,
+	          &evtx_test_record_count_attribute,
+	          &evtx_test_record_count_value,
+	          &evtx_test_record_count_end_element,
+	          (void *) &counts,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A callback that fails stops parsing with an error
+	 */
+	if( memory_set(
+	     &counts,
+	     0,
+	     sizeof( evtx_test_record_callback_counts_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	counts.stop_after  = 1;
+	counts.stop_result = -1;
+
+	result = libevtx_record_parse_with_callbacks(
+	          record,
+	          &evtx_test_record_count_start_element,
+	          &evtx_test_record_count_attribute,
+	          &evtx_test_record_count_value,
+	          &evtx_test_record_count_end_element,
+	          (void *) &counts,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_start_elements",
+	 counts.number_of_start_elements,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "counts.number_of_end_elements",
+	 counts.number_of_end_elements,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests that a borrowed string remains valid after the record values
+ * are removed from the records cache of the file
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_reference_after_file_close(
+     const system_character_t *source )
+{
+	uint8_t utf8_string[ 512 ];
+
+	const uint8_t *utf8_string_reference = NULL;
+	libcerror_error_t *error             = NULL;
+	libevtx_file_t *file                 = NULL;
+	libevtx_record_t *record             = NULL;
+	size_t utf8_string_reference_size    = 0;
+	int number_of_records                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevtx_file_open_wide(
+	          file,
+	          source,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+#else
+	result = libevtx_file_open(
+	          file,
+	          source,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+#endif
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records > 0 )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          0,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_utf8_computer_name_reference(
+		          record,
+		          &utf8_string_reference,
+		          &utf8_string_reference_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( result != 0 )
+		 && ( utf8_string_reference_size <= 512 ) )
+		{
+			result = libevtx_record_get_utf8_computer_name(
+			          record,
+			          utf8_string,
+			          512,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* Closing the file frees the records cache
+			 */
+			result = libevtx_file_close(
+			          file,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          utf8_string_reference,
+			          utf8_string,
+			          utf8_string_reference_size );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Clean up
+	 */
+	if( record != NULL )
+	{
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
-	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+	libcerror_error_t *error   = NULL;
+	libevtx_file_t *file       = NULL;
+	libevtx_record_t *record   = NULL;
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+	int number_of_records      = 0;
+	int result                 = 0;
 
+	while( ( option = evtx_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
 #if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
 
 	/* TODO: add tests for libevtx_record_initialize */
@@ -98,6 +2232,202 @@ int main(
 	 "libevtx_record_free",
 	 evtx_test_record_free );
 
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_reference_after_file_close",
+		 evtx_test_record_reference_after_file_close,
+		 source );
+
+		/* Initialize record for tests
+		 */
+		result = libevtx_file_initialize(
+		          &file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "file",
+		 file );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevtx_file_open_wide(
+		          file,
+		          source,
+		          LIBEVTX_OPEN_READ,
+		          &error );
+#else
+		result = libevtx_file_open(
+		          file,
+		          source,
+		          LIBEVTX_OPEN_READ,
+		          &error );
+#endif
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_number_of_records(
+		          file,
+		          &number_of_records,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( number_of_records > 0 )
+		{
+			result = libevtx_file_get_record_by_index(
+			          file,
+			          0,
+			          &record,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "record",
+			 record );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			EVTX_TEST_RUN_WITH_ARGS(
+			 "libevtx_record_get_utf8_provider_identifier_reference",
+			 evtx_test_record_get_utf8_provider_identifier_reference,
+			 record );
+
+			EVTX_TEST_RUN_WITH_ARGS(
+			 "libevtx_record_get_utf8_source_name_reference",
+			 evtx_test_record_get_utf8_source_name_reference,
+			 record );
+
+			EVTX_TEST_RUN_WITH_ARGS(
+			 "libevtx_record_get_utf8_channel_name_reference",
+			 evtx_test_record_get_utf8_channel_name_reference,
+			 record );
+
+			EVTX_TEST_RUN_WITH_ARGS(
+			 "libevtx_record_get_utf8_computer_name_reference",
+			 evtx_test_record_get_utf8_computer_name_reference,
+			 record );
+
+			EVTX_TEST_RUN_WITH_ARGS(
+			 "libevtx_record_get_utf8_user_security_identifier_reference",
+			 evtx_test_record_get_utf8_user_security_identifier_reference,
+			 record );
+
+			EVTX_TEST_RUN_WITH_ARGS(
+			 "libevtx_record_get_utf8_string_reference",
+			 evtx_test_record_get_utf8_string_reference,
+			 record );
+
+			EVTX_TEST_RUN_WITH_ARGS(
+			 "libevtx_record_get_data_reference",
+			 evtx_test_record_get_data_reference,
+			 record );
+
+			EVTX_TEST_RUN_WITH_ARGS(
+			 "libevtx_record_get_string_index_by_utf8_name",
+			 evtx_test_record_get_string_index_by_utf8_name,
+			 record );
+
+			EVTX_TEST_RUN_WITH_ARGS(
+			 "libevtx_record_get_string_index_by_utf16_name",
+			 evtx_test_record_get_string_index_by_utf16_name,
+			 record );
+
+			EVTX_TEST_RUN_WITH_ARGS(
+			 "libevtx_record_get_string_value_type",
+			 evtx_test_record_get_string_value_type,
+			 record );
+
+			EVTX_TEST_RUN_WITH_ARGS(
+			 "libevtx_record_parse_with_callbacks",
+			 evtx_test_record_parse_with_callbacks,
+			 record );
+
+			/* Clean up
+			 */
+			result = libevtx_record_free(
+			          &record,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "record",
+			 record );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_string_index_by_name",
+		 evtx_test_record_get_string_index_by_name,
+		 file );
+
+		result = libevtx_file_close(
+		          file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_free(
+		          &file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "file",
+		 file );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 #if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
 
 	/* TODO: add tests for libevtx_record_get_offset */
@@ -173,6 +2503,23 @@ int main(
 	return( EXIT_SUCCESS );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
@@ -0,0 +1,933 @@
+/*
+ * Library record_index type test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_record_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_record_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_index_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libevtx_record_index_t *record_index = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_index_initialize(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_free(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_index_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_index = (libevtx_record_index_t *) 0x12345678UL;
+
+	result = libevtx_record_index_initialize(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_index = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_record_index_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_record_index_initialize(
+		          &record_index,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( record_index != NULL )
+			{
+				libevtx_record_index_free(
+				 &record_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "record_index",
+			 record_index );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_record_index_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_record_index_initialize(
+		          &record_index,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( record_index != NULL )
+			{
+				libevtx_record_index_free(
+				 &record_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "record_index",
+			 record_index );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &record_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_index_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_index_append_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_index_append_entry(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libevtx_record_index_t *record_index = NULL;
+	uint32_t chunk_data_offset           = 0;
+	uint32_t chunk_index                 = 0;
+	int entry_index                      = 0;
+	int number_of_entries                = 0;
+	int result                           = 0;
+	int test_number                      = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_index_initialize(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Append more entries than initially allocated to make sure the entries are resized
+	 */
+	for( test_number = 0;
+	     test_number < 1000;
+	     test_number++ )
+	{
+		result = libevtx_record_index_append_entry(
+		          record_index,
+		          &entry_index,
+		          (uint32_t) ( test_number / 100 ),
+		          (uint32_t) ( 512 + ( ( test_number % 100 ) * 24 ) ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "entry_index",
+		 entry_index,
+		 test_number );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_record_index_get_number_of_entries(
+	          record_index,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1000 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_get_entry_by_index(
+	          record_index,
+	          789,
+	          &chunk_index,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_index",
+	 chunk_index,
+	 (uint32_t) 7 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_data_offset",
+	 chunk_data_offset,
+	 (uint32_t) ( 512 + ( 89 * 24 ) ) );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_index_append_entry(
+	          NULL,
+	          &entry_index,
+	          0,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_append_entry(
+	          record_index,
+	          NULL,
+	          0,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_get_entry_by_index(
+	          record_index,
+	          1000,
+	          &chunk_index,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_get_entry_by_index(
+	          record_index,
+	          0,
+	          NULL,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_get_entry_by_index(
+	          record_index,
+	          0,
+	          &chunk_index,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libevtx_record_index_empty
+	 */
+	result = libevtx_record_index_empty(
+	          record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_get_number_of_entries(
+	          record_index,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_index_free(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &record_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_index_get_entry_index_by_logical_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_index_get_entry_index_by_logical_index(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libevtx_record_index_t *record_index = NULL;
+	int entry_index                      = 0;
+	int result                           = 0;
+	int test_number                      = 0;
+
+	/* Initialize test
+	 * Simulate a wrapped circular log of 3 chunks of 100 records where
+	 * the first chunk contains the newest records
+	 */
+	result = libevtx_record_index_initialize(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( test_number = 0;
+	     test_number < 300;
+	     test_number++ )
+	{
+		result = libevtx_record_index_append_entry(
+		          record_index,
+		          &entry_index,
+		          (uint32_t) ( test_number / 100 ),
+		          (uint32_t) ( 512 + ( ( test_number % 100 ) * 24 ) ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_record_index_append_range(
+	          record_index,
+	          201,
+	          0,
+	          100,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_append_range(
+	          record_index,
+	          1,
+	          100,
+	          100,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the ranges are not sorted
+	 */
+	result = libevtx_record_index_get_entry_index_by_logical_index(
+	          record_index,
+	          0,
+	          &entry_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the ranges do not cover all entries
+	 */
+	result = libevtx_record_index_sort_ranges(
+	          record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_append_range(
+	          record_index,
+	          101,
+	          200,
+	          100,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_sort_ranges(
+	          record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_index_get_entry_index_by_logical_index(
+	          record_index,
+	          0,
+	          &entry_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 100 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_get_entry_index_by_logical_index(
+	          record_index,
+	          150,
+	          &entry_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 250 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_get_entry_index_by_logical_index(
+	          record_index,
+	          299,
+	          &entry_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 99 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_index_append_range(
+	          NULL,
+	          1,
+	          0,
+	          100,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_append_range(
+	          record_index,
+	          1,
+	          0,
+	          301,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_get_entry_index_by_logical_index(
+	          NULL,
+	          0,
+	          &entry_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_get_entry_index_by_logical_index(
+	          record_index,
+	          300,
+	          &entry_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_get_entry_index_by_logical_index(
+	          record_index,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_index_free(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &record_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_index_initialize",
+	 evtx_test_record_index_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_index_free",
+	 evtx_test_record_index_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_index_append_entry",
+	 evtx_test_record_index_append_entry );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_index_get_entry_index_by_logical_index",
+	 evtx_test_record_index_get_entry_index_by_logical_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -33,7 +33,9 @@
 #include "evtx_test_memory.h"
 #include "evtx_test_unused.h"
 
+#include "../libevtx/libevtx_name_index.h"
 #include "../libevtx/libevtx_record_values.h"
+#include "../libevtx/libevtx_template_definition.h"
 
 #if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
 
@@ -3645,6 +3647,1021 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevtx_record_values_set_template_name_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_set_template_name_index(
+     void )
+{
+	uint8_t xml_tags_data[ 2 ];
+
+	libcerror_error_t *error                                             = NULL;
+	libevtx_internal_template_definition_t *internal_template_definition = NULL;
+	libevtx_record_values_t *first_record_values                         = NULL;
+	libevtx_record_values_t *second_record_values                        = NULL;
+	libevtx_template_definition_t *template_definition                   = NULL;
+	libfwevt_xml_tag_t *first_xml_tag                                    = NULL;
+	libfwevt_xml_tag_t *second_xml_tag                                   = NULL;
+	int entry_index                                                      = 0;
+	int result                                                           = 0;
+
+	/* Initialize test
+	 * The XML tags are only compared by reference
+	 */
+	first_xml_tag  = (libfwevt_xml_tag_t *) &( xml_tags_data[ 0 ] );
+	second_xml_tag = (libfwevt_xml_tag_t *) &( xml_tags_data[ 1 ] );
+
+	result = libevtx_template_definition_initialize(
+	          &template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_definition",
+	 template_definition );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_template_definition = (libevtx_internal_template_definition_t *) template_definition;
+
+	/* Set the name index of the template definition as built from
+	 * the strings of a record that contains both substitutions
+	 */
+	result = libevtx_name_index_initialize(
+	          &( internal_template_definition->name_index ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_append_name(
+	          internal_template_definition->name_index,
+	          (uint8_t *) "SubjectUserName",
+	          15,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_append_name(
+	          internal_template_definition->name_index,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &( internal_template_definition->name_index_xml_tags_array ),
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          internal_template_definition->name_index_xml_tags_array,
+	          &entry_index,
+	          (intptr_t *) first_xml_tag,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          internal_template_definition->name_index_xml_tags_array,
+	          &entry_index,
+	          (intptr_t *) second_xml_tag,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first record contains both substitutions
+	 */
+	result = libevtx_record_values_initialize(
+	          &first_record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "first_record_values",
+	 first_record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &( first_record_values->string_identifiers_array ),
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          first_record_values->string_identifiers_array,
+	          &entry_index,
+	          (intptr_t *) first_xml_tag,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          first_record_values->string_identifiers_array,
+	          &entry_index,
+	          (intptr_t *) second_xml_tag,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The second record of the same template definition only contains
+	 * the second substitution, hence its strings have a different layout
+	 */
+	result = libevtx_record_values_initialize(
+	          &second_record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "second_record_values",
+	 second_record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &( second_record_values->string_identifiers_array ),
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          second_record_values->string_identifiers_array,
+	          &entry_index,
+	          (intptr_t *) second_xml_tag,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_set_template_name_index(
+	          first_record_values,
+	          internal_template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INTPTR(
+	 "first_record_values->name_index",
+	 (intptr_t) first_record_values->name_index,
+	 (intptr_t) internal_template_definition->name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_values_set_template_name_index(
+	          second_record_values,
+	          internal_template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "second_record_values->name_index",
+	 second_record_values->name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_set_template_name_index(
+	          NULL,
+	          internal_template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_set_template_name_index(
+	          second_record_values,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_set_template_name_index(
+	          first_record_values,
+	          internal_template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &second_record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "second_record_values",
+	 second_record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_template_definition_free(
+	          &template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "template_definition",
+	 template_definition );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first record values keep the shared name index alive
+	 */
+	result = libevtx_record_values_free(
+	          &first_record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "first_record_values",
+	 first_record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &second_record_values,
+		 NULL );
+	}
+	if( first_record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &first_record_values,
+		 NULL );
+	}
+	if( template_definition != NULL )
+	{
+		libevtx_template_definition_free(
+		 &template_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_string_index_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_string_index_by_utf8_name(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libevtx_name_index_t *name_index              = NULL;
+	libevtx_record_values_t *first_record_values  = NULL;
+	libevtx_record_values_t *second_record_values = NULL;
+	int result                                    = 0;
+	int string_index                              = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_append_name(
+	          name_index,
+	          (uint8_t *) "SubjectUserName",
+	          15,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_append_name(
+	          name_index,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Share the name index between record values as is done for records
+	 * that are parsed with the same template definition
+	 */
+	result = libevtx_record_values_initialize(
+	          &first_record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "first_record_values",
+	 first_record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_add_reference(
+	          name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	first_record_values->name_index  = name_index;
+	first_record_values->data_parsed = 1;
+
+	result = libevtx_record_values_initialize(
+	          &second_record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "second_record_values",
+	 second_record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_add_reference(
+	          name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	second_record_values->name_index  = name_index;
+	second_record_values->data_parsed = 1;
+
+	/* Release the reference of the template definition, the record values
+	 * keep the shared name index alive
+	 */
+	result = libevtx_name_index_free(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_string_index_by_utf8_name(
+	          first_record_values,
+	          NULL,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "string_index",
+	 string_index,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_values_get_string_index_by_utf8_name(
+	          second_record_values,
+	          NULL,
+	          (uint8_t *) "SubjectUserName",
+	          15,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "string_index",
+	 string_index,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INTPTR(
+	 "second_record_values->name_index",
+	 (intptr_t) second_record_values->name_index,
+	 (intptr_t) first_record_values->name_index );
+
+	result = libevtx_record_values_get_string_index_by_utf8_name(
+	          first_record_values,
+	          NULL,
+	          (uint8_t *) "TargetDomainName",
+	          16,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_string_index_by_utf8_name(
+	          NULL,
+	          NULL,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_string_index_by_utf8_name(
+	          first_record_values,
+	          NULL,
+	          NULL,
+	          14,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_string_index_by_utf8_name(
+	          first_record_values,
+	          NULL,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &second_record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "second_record_values",
+	 second_record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The name index remains valid after the other record values are freed
+	 */
+	result = libevtx_record_values_get_string_index_by_utf8_name(
+	          first_record_values,
+	          NULL,
+	          (uint8_t *) "TargetUserName",
+	          14,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "string_index",
+	 string_index,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_values_free(
+	          &first_record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "first_record_values",
+	 first_record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &second_record_values,
+		 NULL );
+	}
+	if( first_record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &first_record_values,
+		 NULL );
+	}
+	if( name_index != NULL )
+	{
+		libevtx_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_string_index_by_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_string_index_by_utf16_name(
+     void )
+{
+	uint16_t subject_user_name[ 15 ] = {
+		'S', 'u', 'b', 'j', 'e', 'c', 't', 'U', 's', 'e', 'r', 'N', 'a', 'm', 'e' };
+
+	uint16_t target_domain_name[ 16 ] = {
+		'T', 'a', 'r', 'g', 'e', 't', 'D', 'o', 'm', 'a', 'i', 'n', 'N', 'a', 'm', 'e' };
+
+	libcerror_error_t *error               = NULL;
+	libevtx_name_index_t *name_index       = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
+	int string_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_name_index_append_name(
+	          name_index,
+	          (uint8_t *) "SubjectUserName",
+	          15,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record_values->name_index  = name_index;
+	record_values->data_parsed = 1;
+
+	name_index = NULL;
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_values_get_string_index_by_utf16_name(
+	          record_values,
+	          NULL,
+	          subject_user_name,
+	          15,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "string_index",
+	 string_index,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_values_get_string_index_by_utf16_name(
+	          record_values,
+	          NULL,
+	          target_domain_name,
+	          16,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_string_index_by_utf16_name(
+	          NULL,
+	          NULL,
+	          subject_user_name,
+	          15,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_string_index_by_utf16_name(
+	          record_values,
+	          NULL,
+	          NULL,
+	          15,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_string_index_by_utf16_name(
+	          record_values,
+	          NULL,
+	          subject_user_name,
+	          0,
+	          &string_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( name_index != NULL )
+	{
+		libevtx_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
 
 /* The main program
@@ -3676,6 +4693,18 @@ int main(
 	 "libevtx_record_values_clone",
 	 evtx_test_record_values_clone );
 
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_set_template_name_index",
+	 evtx_test_record_values_set_template_name_index );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_string_index_by_utf8_name",
+	 evtx_test_record_values_get_string_index_by_utf8_name );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_string_index_by_utf16_name",
+	 evtx_test_record_values_get_string_index_by_utf16_name );
+
 #if defined( TODO )
 
 	/* TODO: add tests for libevtx_record_values_read_header */
@@ -199,6 +199,211 @@ on_error:
 	return( 0 );
 }
 
+/* Allocates memory for the libevtx_set_memory_functions test
+ */
+void *evtx_test_memory_allocate_function(
+       void *context,
+       size_t size )
+{
+	int *number_of_allocations = (int *) context;
+
+	if( number_of_allocations != NULL )
+	{
+		*number_of_allocations += 1;
+	}
+	return( malloc(
+	         size ) );
+}
+
+/* Reallocates memory for the libevtx_set_memory_functions test
+ */
+void *evtx_test_memory_reallocate_function(
+       void *context,
+       void *buffer,
+       size_t size )
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( context )
+
+	return( realloc(
+	         buffer,
+	         size ) );
+}
+
+/* Frees memory for the libevtx_set_memory_functions test
+ */
+void evtx_test_memory_free_function(
+      void *context,
+      void *buffer )
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( context )
+
+	free(
+	 buffer );
+}
+
+/* Tests the libevtx_set_memory_functions function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_set_memory_functions(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libevtx_file_t *file      = NULL;
+	int number_of_allocations = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_set_memory_functions(
+	          &evtx_test_memory_allocate_function,
+	          &evtx_test_memory_reallocate_function,
+	          &evtx_test_memory_free_function,
+	          (void *) &number_of_allocations,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 0 );
+
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_set_memory_functions(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_set_memory_functions(
+	          NULL,
+	          &evtx_test_memory_reallocate_function,
+	          &evtx_test_memory_free_function,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_set_memory_functions(
+	          &evtx_test_memory_allocate_function,
+	          NULL,
+	          &evtx_test_memory_free_function,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_set_memory_functions(
+	          &evtx_test_memory_allocate_function,
+	          &evtx_test_memory_reallocate_function,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	libevtx_set_memory_functions(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
 /* Tests the libevtx_check_file_signature function
  * Returns 1 if successful or 0 if not
  */
@@ -765,6 +970,10 @@ int main(
 	 "libevtx_set_codepage",
 	 evtx_test_set_codepage );
 
+	EVTX_TEST_RUN(
+	 "libevtx_set_memory_functions",
+	 evtx_test_set_memory_functions );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	EVTX_TEST_RUN_WITH_ARGS(
@@ -0,0 +1,787 @@
+/*
+ * Tools merge_handle type test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../evtxtools/merge_handle.h"
+
+/* Tests the merge_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_merge_handle_initialize(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	merge_handle_t *merge_handle = NULL;
+	int result                   = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = merge_handle_initialize(
+	          &merge_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "merge_handle",
+	 merge_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = merge_handle_free(
+	          &merge_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "merge_handle",
+	 merge_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = merge_handle_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	merge_handle = (merge_handle_t *) 0x12345678UL;
+
+	result = merge_handle_initialize(
+	          &merge_handle,
+	          &error );
+
+	merge_handle = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test merge_handle_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = merge_handle_initialize(
+		          &merge_handle,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( merge_handle != NULL )
+			{
+				merge_handle_free(
+				 &merge_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "merge_handle",
+			 merge_handle );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test merge_handle_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = merge_handle_initialize(
+		          &merge_handle,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( merge_handle != NULL )
+			{
+				merge_handle_free(
+				 &merge_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "merge_handle",
+			 merge_handle );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( merge_handle != NULL )
+	{
+		merge_handle_free(
+		 &merge_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the merge_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_merge_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = merge_handle_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+
+/* Tests the merge_handle_set_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_merge_handle_set_ascii_codepage(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	merge_handle_t *merge_handle = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = merge_handle_initialize(
+	          &merge_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "merge_handle",
+	 merge_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = merge_handle_set_ascii_codepage(
+	          merge_handle,
+	          LIBEVTX_CODEPAGE_WINDOWS_1250,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "merge_handle->ascii_codepage",
+	 merge_handle->ascii_codepage,
+	 LIBEVTX_CODEPAGE_WINDOWS_1250 );
+
+	/* Test error cases
+	 */
+	result = merge_handle_set_ascii_codepage(
+	          NULL,
+	          LIBEVTX_CODEPAGE_WINDOWS_1250,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = merge_handle_free(
+	          &merge_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "merge_handle",
+	 merge_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( merge_handle != NULL )
+	{
+		merge_handle_free(
+		 &merge_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the merge_handle_open_input function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_merge_handle_open_input(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	merge_handle_t *merge_handle = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = merge_handle_initialize(
+	          &merge_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "merge_handle",
+	 merge_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = merge_handle_open_input(
+	          NULL,
+	          _SYSTEM_STRING( "nonexisting.evtx" ),
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = merge_handle_open_input(
+	          merge_handle,
+	          _SYSTEM_STRING( "nonexisting.evtx" ),
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "merge_handle->number_of_inputs",
+	 merge_handle->number_of_inputs,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "merge_handle->heap_size",
+	 merge_handle->heap_size,
+	 0 );
+
+	/* Clean up
+	 */
+	result = merge_handle_free(
+	          &merge_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "merge_handle",
+	 merge_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( merge_handle != NULL )
+	{
+		merge_handle_free(
+		 &merge_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the merge_handle_get_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_merge_handle_get_next_record(
+     void )
+{
+	/* The written times of the current record of the inputs,
+	 * where inputs 0 and 2 have the same written time
+	 */
+	uint64_t written_times[ 4 ]     = { 30, 10, 30, 20 };
+	int expected_input_indexes[ 4 ] = { 1, 3, 0, 2 };
+
+	libcerror_error_t *error        = NULL;
+	libevtx_record_t *record        = NULL;
+	merge_handle_t *merge_handle    = NULL;
+	void *memset_result             = NULL;
+	int event_log_type              = 0;
+	int input_index                 = 0;
+	int record_index                = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = merge_handle_initialize(
+	          &merge_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "merge_handle",
+	 merge_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving a record without inputs
+	 */
+	result = merge_handle_get_next_record(
+	          merge_handle,
+	          &record,
+	          &event_log_type,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Set up inputs that have a current record and no further records,
+	 * the current record is a placeholder that is only compared
+	 */
+	merge_handle->inputs = (merge_input_t *) memory_allocate(
+	                                          sizeof( merge_input_t ) * 4 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "merge_handle->inputs",
+	 merge_handle->inputs );
+
+	merge_handle->heap = (int *) memory_allocate(
+	                              sizeof( int ) * 4 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "merge_handle->heap",
+	 merge_handle->heap );
+
+	merge_handle->number_of_allocated_inputs = 4;
+
+	for( input_index = 0;
+	     input_index < 4;
+	     input_index++ )
+	{
+		memset_result = memory_set(
+		                 &( merge_handle->inputs[ input_index ] ),
+		                 0,
+		                 sizeof( merge_input_t ) );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "memset_result",
+		 memset_result );
+
+		merge_handle->inputs[ input_index ].event_log_type = input_index + 1;
+		merge_handle->inputs[ input_index ].record         = (libevtx_record_t *) &( written_times[ input_index ] );
+		merge_handle->inputs[ input_index ].written_time   = written_times[ input_index ];
+
+		merge_handle->number_of_inputs += 1;
+
+		merge_handle->heap[ merge_handle->heap_size ] = input_index;
+
+		merge_handle->heap_size += 1;
+
+		merge_handle_heap_sift_up(
+		 merge_handle,
+		 merge_handle->heap_size - 1 );
+	}
+	/* Test regular cases
+	 */
+	for( record_index = 0;
+	     record_index < 4;
+	     record_index++ )
+	{
+		input_index = expected_input_indexes[ record_index ];
+
+		result = merge_handle_get_next_record(
+		          merge_handle,
+		          &record,
+		          &event_log_type,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_INTPTR(
+		 "record",
+		 (intptr_t) record,
+		 (intptr_t) &( written_times[ input_index ] ) );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "event_log_type",
+		 event_log_type,
+		 input_index + 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "merge_handle->inputs[ input_index ].record",
+		 merge_handle->inputs[ input_index ].record );
+
+		record = NULL;
+	}
+	result = merge_handle_get_next_record(
+	          merge_handle,
+	          &record,
+	          &event_log_type,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The inputs have no input file, hence they are not closed
+	 */
+	merge_handle->number_of_inputs = 0;
+
+	/* Test error cases
+	 */
+	result = merge_handle_get_next_record(
+	          NULL,
+	          &record,
+	          &event_log_type,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = merge_handle_get_next_record(
+	          merge_handle,
+	          NULL,
+	          &event_log_type,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = merge_handle_get_next_record(
+	          merge_handle,
+	          &record,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = merge_handle_free(
+	          &merge_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "merge_handle",
+	 merge_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( merge_handle != NULL )
+	{
+		merge_handle->number_of_inputs = 0;
+
+		merge_handle_free(
+		 &merge_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "merge_handle_initialize",
+	 evtx_test_tools_merge_handle_initialize );
+
+	EVTX_TEST_RUN(
+	 "merge_handle_free",
+	 evtx_test_tools_merge_handle_free );
+
+	EVTX_TEST_RUN(
+	 "merge_handle_set_ascii_codepage",
+	 evtx_test_tools_merge_handle_set_ascii_codepage );
+
+	EVTX_TEST_RUN(
+	 "merge_handle_open_input",
+	 evtx_test_tools_merge_handle_open_input );
+
+	EVTX_TEST_RUN(
+	 "merge_handle_get_next_record",
+	 evtx_test_tools_merge_handle_get_next_record );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
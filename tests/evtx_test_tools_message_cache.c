@@ -0,0 +1,2482 @@
+/*
+ * Tools message_cache type test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../evtxtools/message_cache.h"
+#include "../evtxtools/message_string.h"
+
+/* Tests the message_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_message_cache_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	message_cache_t *message_cache = NULL;
+	int result                     = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = message_cache_initialize(
+	          &message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_cache",
+	 message_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_cache_free(
+	          &message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_cache",
+	 message_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = message_cache_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	message_cache = (message_cache_t *) 0x12345678UL;
+
+	result = message_cache_initialize(
+	          &message_cache,
+	          &error );
+
+	message_cache = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test message_cache_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = message_cache_initialize(
+		          &message_cache,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( message_cache != NULL )
+			{
+				message_cache_free(
+				 &message_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "message_cache",
+			 message_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test message_cache_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = message_cache_initialize(
+		          &message_cache,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( message_cache != NULL )
+			{
+				message_cache_free(
+				 &message_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "message_cache",
+			 message_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_cache != NULL )
+	{
+		message_cache_free(
+		 &message_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the message_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_message_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = message_cache_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+
+/* Tests the message_cache_calculate_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_message_cache_calculate_hash(
+     void )
+{
+	uint32_t hash1 = 0;
+	uint32_t hash2 = 0;
+
+	/* Test regular cases
+	 */
+	hash1 = message_cache_calculate_hash(
+	         1,
+	         _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	         38,
+	         _SYSTEM_STRING( "Application" ),
+	         11,
+	         4624,
+	         0,
+	         0x00000409UL );
+
+	hash2 = message_cache_calculate_hash(
+	         1,
+	         _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	         38,
+	         _SYSTEM_STRING( "Application" ),
+	         11,
+	         4624,
+	         0,
+	         0x00000409UL );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "hash2",
+	 hash2,
+	 hash1 );
+
+	hash2 = message_cache_calculate_hash(
+	         1,
+	         _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	         38,
+	         _SYSTEM_STRING( "Application" ),
+	         11,
+	         4625,
+	         0,
+	         0x00000409UL );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "hash2",
+	 (int32_t) hash2,
+	 (int32_t) hash1 );
+
+	hash2 = message_cache_calculate_hash(
+	         1,
+	         NULL,
+	         0,
+	         _SYSTEM_STRING( "Application" ),
+	         11,
+	         4624,
+	         0,
+	         0x00000409UL );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "hash2",
+	 (int32_t) hash2,
+	 (int32_t) hash1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the message_cache_entry_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_message_cache_entry_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	message_cache_entry_t *message_cache_entry = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 3;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = message_cache_entry_initialize(
+	          &message_cache_entry,
+	          1,
+	          _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	          38,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_cache_entry",
+	 message_cache_entry );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "message_cache_entry->provider_identifier_length",
+	 message_cache_entry->provider_identifier_length,
+	 (size_t) 38 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "message_cache_entry->event_source_length",
+	 message_cache_entry->event_source_length,
+	 (size_t) 11 );
+
+	result = system_string_compare(
+	          message_cache_entry->event_source,
+	          _SYSTEM_STRING( "Application" ),
+	          12 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "message_cache_entry->hash",
+	 message_cache_entry->hash,
+	 message_cache_calculate_hash(
+	  1,
+	  _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	  38,
+	  _SYSTEM_STRING( "Application" ),
+	  11,
+	  4624,
+	  0,
+	  0x00000409UL ) );
+
+	result = message_cache_entry_free(
+	          &message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_cache_entry",
+	 message_cache_entry );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test without a provider identifier and event source
+	 */
+	result = message_cache_entry_initialize(
+	          &message_cache_entry,
+	          1,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_cache_entry",
+	 message_cache_entry );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_cache_entry->provider_identifier",
+	 message_cache_entry->provider_identifier );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_cache_entry->event_source",
+	 message_cache_entry->event_source );
+
+	result = message_cache_entry_free(
+	          &message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = message_cache_entry_initialize(
+	          NULL,
+	          1,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	message_cache_entry = (message_cache_entry_t *) 0x12345678UL;
+
+	result = message_cache_entry_initialize(
+	          &message_cache_entry,
+	          1,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &error );
+
+	message_cache_entry = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = message_cache_entry_initialize(
+	          &message_cache_entry,
+	          1,
+	          _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	          (size_t) SSIZE_MAX,
+	          NULL,
+	          0,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test message_cache_entry_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = message_cache_entry_initialize(
+		          &message_cache_entry,
+		          1,
+		          _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+		          38,
+		          _SYSTEM_STRING( "Application" ),
+		          11,
+		          4624,
+		          0,
+		          0,
+		          0x00000409UL,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( message_cache_entry != NULL )
+			{
+				message_cache_entry_free(
+				 &message_cache_entry,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "message_cache_entry",
+			 message_cache_entry );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_cache_entry != NULL )
+	{
+		message_cache_entry_free(
+		 &message_cache_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the message_cache_entry_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_message_cache_entry_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = message_cache_entry_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the message_cache_get_entry and message_cache_insert_entry functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_message_cache_get_entry(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	message_cache_t *message_cache             = NULL;
+	message_cache_entry_t *message_cache_entry = NULL;
+	message_cache_entry_t *cached_entry        = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = message_cache_initialize(
+	          &message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_cache",
+	 message_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_cache_entry_initialize(
+	          &message_cache_entry,
+	          1,
+	          _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	          38,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_cache_insert_entry(
+	          message_cache,
+	          message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cached_entry        = message_cache_entry;
+	message_cache_entry = NULL;
+
+	/* An entry without an event source, as for an unresolved message
+	 */
+	result = message_cache_entry_initialize(
+	          &message_cache_entry,
+	          1,
+	          _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	          38,
+	          NULL,
+	          0,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_cache_insert_entry(
+	          message_cache,
+	          message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	message_cache_entry = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "message_cache->number_of_entries",
+	 message_cache->number_of_entries,
+	 2 );
+
+	/* Test regular cases
+	 */
+	result = message_cache_get_entry(
+	          message_cache,
+	          1,
+	          _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	          38,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INTPTR(
+	 "message_cache_entry",
+	 (intptr_t) message_cache_entry,
+	 (intptr_t) cached_entry );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	message_cache_entry = NULL;
+
+	result = message_cache_get_entry(
+	          message_cache,
+	          1,
+	          _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	          38,
+	          NULL,
+	          0,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_cache_entry",
+	 message_cache_entry );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_cache_entry->event_source",
+	 message_cache_entry->event_source );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	message_cache_entry = NULL;
+
+	/* Test with key values that differ in language identifier
+	 */
+	result = message_cache_get_entry(
+	          message_cache,
+	          1,
+	          _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	          38,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          4624,
+	          0,
+	          0,
+	          0x00000407UL,
+	          &message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with key values that differ in whether the event identifier qualifiers are set
+	 */
+	result = message_cache_get_entry(
+	          message_cache,
+	          1,
+	          _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	          38,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          4624,
+	          0,
+	          1,
+	          0x00000409UL,
+	          &message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with key values that differ in event source
+	 */
+	result = message_cache_get_entry(
+	          message_cache,
+	          1,
+	          _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	          38,
+	          _SYSTEM_STRING( "Security" ),
+	          8,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = message_cache_get_entry(
+	          NULL,
+	          1,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = message_cache_get_entry(
+	          message_cache,
+	          1,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = message_cache_insert_entry(
+	          NULL,
+	          cached_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = message_cache_insert_entry(
+	          message_cache,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test get entry after the cache was emptied
+	 */
+	result = message_cache_empty(
+	          message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "message_cache->number_of_entries",
+	 message_cache->number_of_entries,
+	 0 );
+
+	result = message_cache_get_entry(
+	          message_cache,
+	          1,
+	          _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	          38,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_cache_empty(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = message_cache_free(
+	          &message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_cache",
+	 message_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_cache != NULL )
+	{
+		message_cache_free(
+		 &message_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the message_cache_set_maximum_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_message_cache_set_maximum_number_of_entries(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	message_cache_t *message_cache             = NULL;
+	message_cache_entry_t *message_cache_entry = NULL;
+	uint32_t event_identifier                  = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = message_cache_initialize(
+	          &message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_cache",
+	 message_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = message_cache_set_maximum_number_of_entries(
+	          message_cache,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the cache is emptied when the maximum number of entries is reached
+	 */
+	for( event_identifier = 1;
+	     event_identifier <= 3;
+	     event_identifier++ )
+	{
+		result = message_cache_entry_initialize(
+		          &message_cache_entry,
+		          1,
+		          NULL,
+		          0,
+		          _SYSTEM_STRING( "Application" ),
+		          11,
+		          event_identifier,
+		          0,
+		          0,
+		          0x00000409UL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = message_cache_insert_entry(
+		          message_cache,
+		          message_cache_entry,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		message_cache_entry = NULL;
+	}
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "message_cache->number_of_entries",
+	 message_cache->number_of_entries,
+	 1 );
+
+	/* Test that a maximum of 0 does not empty the cache
+	 */
+	result = message_cache_set_maximum_number_of_entries(
+	          message_cache,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( event_identifier = 4;
+	     event_identifier <= 6;
+	     event_identifier++ )
+	{
+		result = message_cache_entry_initialize(
+		          &message_cache_entry,
+		          1,
+		          NULL,
+		          0,
+		          _SYSTEM_STRING( "Application" ),
+		          11,
+		          event_identifier,
+		          0,
+		          0,
+		          0x00000409UL,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = message_cache_insert_entry(
+		          message_cache,
+		          message_cache_entry,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		message_cache_entry = NULL;
+	}
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "message_cache->number_of_entries",
+	 message_cache->number_of_entries,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = message_cache_set_maximum_number_of_entries(
+	          NULL,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = message_cache_set_maximum_number_of_entries(
+	          message_cache,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = message_cache_free(
+	          &message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_cache",
+	 message_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_cache_entry != NULL )
+	{
+		message_cache_entry_free(
+		 &message_cache_entry,
+		 NULL );
+	}
+	if( message_cache != NULL )
+	{
+		message_cache_free(
+		 &message_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Writes data to a file for testing
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_test_tools_message_cache_write_test_file(
+     const system_character_t *filename,
+     const uint8_t *data,
+     size_t data_size )
+{
+	FILE *stream = NULL;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		return( -1 );
+	}
+	if( file_stream_write(
+	     stream,
+	     data,
+	     data_size ) != data_size )
+	{
+		file_stream_close(
+		 stream );
+
+		return( -1 );
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if a file exists for testing
+ * Returns 1 if the file exists or 0 if not
+ */
+int evtx_test_tools_message_cache_file_exists(
+     const system_character_t *filename )
+{
+	FILE *stream = NULL;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		return( 0 );
+	}
+	file_stream_close(
+	 stream );
+
+	return( 1 );
+}
+
+/* Removes a file for testing
+ */
+void evtx_test_tools_message_cache_remove_file(
+      const system_character_t *filename )
+{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	_wremove(
+	 filename );
+#else
+	remove(
+	 filename );
+#endif
+}
+
+/* Tests the message_cache_write_string and message_cache_read_string functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_message_cache_write_string(
+     void )
+{
+	uint8_t string_data[ 4 + ( 3 * 4 ) ];
+
+	system_character_t *string = NULL;
+	libcerror_error_t *error   = NULL;
+	FILE *stream               = NULL;
+	size_t byte_index          = 0;
+	size_t data_offset         = 0;
+	size_t read_count          = 0;
+	size_t string_size         = 0;
+	uint8_t expected_byte      = 0;
+	int result                 = 0;
+
+	/* Test write of a string
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          "evtx_test_message_cache.dat",
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = message_cache_write_string(
+	          stream,
+	          _SYSTEM_STRING( "ab" ),
+	          3,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = file_stream_close(
+	          stream );
+
+	stream = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the characters are stored little-endian
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          "evtx_test_message_cache.dat",
+	          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	read_count = file_stream_read(
+	              stream,
+	              string_data,
+	              4 + ( 3 * sizeof( system_character_t ) ) );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 (size_t) ( 4 + ( 3 * sizeof( system_character_t ) ) ) );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "string_data[ 0 ]",
+	 string_data[ 0 ],
+	 3 );
+
+	data_offset = 4;
+
+	for( byte_index = 0;
+	     byte_index < sizeof( system_character_t );
+	     byte_index++ )
+	{
+		expected_byte = 0;
+
+		if( byte_index == 0 )
+		{
+			expected_byte = (uint8_t) 'a';
+		}
+		EVTX_TEST_ASSERT_EQUAL_UINT8(
+		 "string_data[ data_offset ]",
+		 string_data[ data_offset ],
+		 expected_byte );
+
+		if( byte_index == 0 )
+		{
+			expected_byte = (uint8_t) 'b';
+		}
+		EVTX_TEST_ASSERT_EQUAL_UINT8(
+		 "string_data[ data_offset + sizeof( system_character_t ) ]",
+		 string_data[ data_offset + sizeof( system_character_t ) ],
+		 expected_byte );
+
+		data_offset++;
+	}
+	/* Test read of the string
+	 */
+	result = file_stream_seek_offset(
+	          stream,
+	          0,
+	          SEEK_SET );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = message_cache_read_string(
+	          stream,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 3 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          string,
+	          _SYSTEM_STRING( "ab" ),
+	          3 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 string );
+
+	string = NULL;
+
+	/* Clean up
+	 */
+	result = file_stream_close(
+	          stream );
+
+	stream = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	evtx_test_tools_message_cache_remove_file(
+	 _SYSTEM_STRING( "evtx_test_message_cache.dat" ) );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	evtx_test_tools_message_cache_remove_file(
+	 _SYSTEM_STRING( "evtx_test_message_cache.dat" ) );
+
+	return( 0 );
+}
+
+/* Tests the message_cache_write_file and message_cache_read_file functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_message_cache_write_file(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	message_cache_t *message_cache             = NULL;
+	message_cache_entry_t *message_cache_entry = NULL;
+	message_cache_t *read_message_cache        = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = message_cache_initialize(
+	          &message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_cache",
+	 message_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A resolved entry
+	 */
+	result = message_cache_entry_initialize(
+	          &message_cache_entry,
+	          1,
+	          _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	          38,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	message_cache_entry->resource_filename = system_string_allocate(
+	                                          11 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_cache_entry->resource_filename",
+	 message_cache_entry->resource_filename );
+
+	system_string_copy(
+	 message_cache_entry->resource_filename,
+	 _SYSTEM_STRING( "test.dll" ),
+	 9 );
+
+	message_cache_entry->resource_filename_size = 9;
+	message_cache_entry->message_identifier     = 0x00001210UL;
+
+	result = message_string_initialize(
+	          &( message_cache_entry->message_string ),
+	          0x00001210UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	message_cache_entry->message_string->string = system_string_allocate(
+	                                               8 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_cache_entry->message_string->string",
+	 message_cache_entry->message_string->string );
+
+	system_string_copy(
+	 message_cache_entry->message_string->string,
+	 _SYSTEM_STRING( "Test %1" ),
+	 8 );
+
+	message_cache_entry->message_string->string_size = 8;
+
+	result = message_cache_insert_entry(
+	          message_cache,
+	          message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	message_cache_entry = NULL;
+
+	/* An unresolved entry
+	 */
+	result = message_cache_entry_initialize(
+	          &message_cache_entry,
+	          2,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "Security" ),
+	          8,
+	          4625,
+	          0x40000000UL,
+	          1,
+	          0x00000409UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_cache_insert_entry(
+	          message_cache,
+	          message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	message_cache_entry = NULL;
+
+	/* Test regular cases
+	 */
+	result = message_cache_write_file(
+	          message_cache,
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "message_cache->is_modified",
+	 message_cache->is_modified,
+	 0 );
+
+	/* Test that the temporary file replaced the file
+	 */
+	result = evtx_test_tools_message_cache_file_exists(
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat.tmp" ) );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = message_cache_initialize(
+	          &read_message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_cache_read_file(
+	          read_message_cache,
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "read_message_cache->number_of_entries",
+	 read_message_cache->number_of_entries,
+	 2 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "read_message_cache->is_modified",
+	 read_message_cache->is_modified,
+	 0 );
+
+	result = message_cache_get_entry(
+	          read_message_cache,
+	          1,
+	          _SYSTEM_STRING( "{fc65ddd8-d6ef-4962-83d5-6e5cfe9ce148}" ),
+	          38,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          4624,
+	          0,
+	          0,
+	          0x00000409UL,
+	          &message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "message_cache_entry->message_identifier",
+	 message_cache_entry->message_identifier,
+	 (uint32_t) 0x00001210UL );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "message_cache_entry->resource_filename_size",
+	 message_cache_entry->resource_filename_size,
+	 (size_t) 9 );
+
+	result = system_string_compare(
+	          message_cache_entry->resource_filename,
+	          _SYSTEM_STRING( "test.dll" ),
+	          9 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_cache_entry->message_filename",
+	 message_cache_entry->message_filename );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_cache_entry->message_string",
+	 message_cache_entry->message_string );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "message_cache_entry->message_string->identifier",
+	 message_cache_entry->message_string->identifier,
+	 (uint32_t) 0x00001210UL );
+
+	result = system_string_compare(
+	          message_cache_entry->message_string->string,
+	          _SYSTEM_STRING( "Test %1" ),
+	          8 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	message_cache_entry = NULL;
+
+	result = message_cache_get_entry(
+	          read_message_cache,
+	          2,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "Security" ),
+	          8,
+	          4625,
+	          0x40000000UL,
+	          1,
+	          0x00000409UL,
+	          &message_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_cache_entry->message_string",
+	 message_cache_entry->message_string );
+
+	message_cache_entry = NULL;
+
+	/* Test that writing replaces an existing file
+	 */
+	result = message_cache_empty(
+	          message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_cache_write_file(
+	          message_cache,
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_cache_empty(
+	          read_message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_cache_read_file(
+	          read_message_cache,
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "read_message_cache->number_of_entries",
+	 read_message_cache->number_of_entries,
+	 0 );
+
+	evtx_test_tools_message_cache_remove_file(
+	 _SYSTEM_STRING( "evtx_test_message_cache.dat" ) );
+
+	/* Test error cases
+	 */
+	result = message_cache_write_file(
+	          NULL,
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = message_cache_write_file(
+	          message_cache,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test message_cache_write_file with a file that cannot be created
+	 */
+	result = message_cache_write_file(
+	          message_cache,
+	          _SYSTEM_STRING( "nonexisting/evtx_test_message_cache.dat" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = message_cache_free(
+	          &read_message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_cache_free(
+	          &message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_message_cache != NULL )
+	{
+		message_cache_free(
+		 &read_message_cache,
+		 NULL );
+	}
+	if( message_cache != NULL )
+	{
+		message_cache_free(
+		 &message_cache,
+		 NULL );
+	}
+	evtx_test_tools_message_cache_remove_file(
+	 _SYSTEM_STRING( "evtx_test_message_cache.dat" ) );
+
+	return( 0 );
+}
+
+/* Tests the message_cache_read_file function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_message_cache_read_file(
+     void )
+{
+	uint8_t file_data[ 16 ] = {
+		'e', 'v', 't', 'x', 'm', 's', 'g', 'c', 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error       = NULL;
+	message_cache_t *message_cache = NULL;
+	int result                     = 0;
+
+	file_data[ 10 ] = (uint8_t) sizeof( system_character_t );
+
+	/* Initialize test
+	 */
+	result = message_cache_initialize(
+	          &message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_cache",
+	 message_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of a file that does not exist
+	 */
+	result = message_cache_read_file(
+	          message_cache,
+	          _SYSTEM_STRING( "nonexisting.dat" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of a truncated file header
+	 */
+	result = evtx_test_tools_message_cache_write_test_file(
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          file_data,
+	          10 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = message_cache_read_file(
+	          message_cache,
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read of a file that is truncated after the file header
+	 */
+	result = evtx_test_tools_message_cache_write_test_file(
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          file_data,
+	          16 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = message_cache_read_file(
+	          message_cache,
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "message_cache->number_of_entries",
+	 message_cache->number_of_entries,
+	 0 );
+
+	/* Test read of a file with an unsupported signature
+	 */
+	file_data[ 7 ] = 'x';
+
+	result = evtx_test_tools_message_cache_write_test_file(
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          file_data,
+	          16 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = message_cache_read_file(
+	          message_cache,
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_data[ 7 ] = 'c';
+
+	/* Test read of a file with an unsupported character size
+	 */
+	file_data[ 10 ] = (uint8_t) ( sizeof( system_character_t ) + 1 );
+
+	result = evtx_test_tools_message_cache_write_test_file(
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          file_data,
+	          16 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = message_cache_read_file(
+	          message_cache,
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_data[ 10 ] = (uint8_t) sizeof( system_character_t );
+
+	/* Test read of a file with an unsupported format version
+	 */
+	file_data[ 8 ] = 0x02;
+
+	result = evtx_test_tools_message_cache_write_test_file(
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          file_data,
+	          16 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = message_cache_read_file(
+	          message_cache,
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	evtx_test_tools_message_cache_remove_file(
+	 _SYSTEM_STRING( "evtx_test_message_cache.dat" ) );
+
+	/* Test error cases
+	 */
+	result = message_cache_read_file(
+	          NULL,
+	          _SYSTEM_STRING( "evtx_test_message_cache.dat" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = message_cache_read_file(
+	          message_cache,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = message_cache_free(
+	          &message_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_cache",
+	 message_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_cache != NULL )
+	{
+		message_cache_free(
+		 &message_cache,
+		 NULL );
+	}
+	evtx_test_tools_message_cache_remove_file(
+	 _SYSTEM_STRING( "evtx_test_message_cache.dat" ) );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "message_cache_calculate_hash",
+	 evtx_test_tools_message_cache_calculate_hash );
+
+	EVTX_TEST_RUN(
+	 "message_cache_entry_initialize",
+	 evtx_test_tools_message_cache_entry_initialize );
+
+	EVTX_TEST_RUN(
+	 "message_cache_entry_free",
+	 evtx_test_tools_message_cache_entry_free );
+
+	EVTX_TEST_RUN(
+	 "message_cache_initialize",
+	 evtx_test_tools_message_cache_initialize );
+
+	EVTX_TEST_RUN(
+	 "message_cache_free",
+	 evtx_test_tools_message_cache_free );
+
+	EVTX_TEST_RUN(
+	 "message_cache_get_entry",
+	 evtx_test_tools_message_cache_get_entry );
+
+	EVTX_TEST_RUN(
+	 "message_cache_set_maximum_number_of_entries",
+	 evtx_test_tools_message_cache_set_maximum_number_of_entries );
+
+	EVTX_TEST_RUN(
+	 "message_cache_write_string",
+	 evtx_test_tools_message_cache_write_string );
+
+	EVTX_TEST_RUN(
+	 "message_cache_write_file",
+	 evtx_test_tools_message_cache_write_file );
+
+	EVTX_TEST_RUN(
+	 "message_cache_read_file",
+	 evtx_test_tools_message_cache_read_file );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
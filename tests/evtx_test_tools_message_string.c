@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -273,6 +274,726 @@ on_error:
 	return( 0 );
 }
 
+/* Creates a message string for testing
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_test_tools_message_string_create(
+     message_string_t **message_string,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	size_t string_length = 0;
+
+	if( message_string_initialize(
+	     message_string,
+	     0x00001000UL,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	( *message_string )->string = system_string_allocate(
+	                               string_length + 1 );
+
+	if( ( *message_string )->string == NULL )
+	{
+		message_string_free(
+		 message_string,
+		 NULL );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     ( *message_string )->string,
+	     string,
+	     string_length + 1 ) == NULL )
+	{
+		message_string_free(
+		 message_string,
+		 NULL );
+
+		return( -1 );
+	}
+	( *message_string )->string_size = string_length + 1;
+
+	return( 1 );
+}
+
+/* Formats a message string without record for testing
+ * Returns 1 if the formatted string matches the expected string, 0 if not or -1 on error
+ */
+int evtx_test_tools_message_string_format_string(
+     const system_character_t *string,
+     const system_character_t *expected_string,
+     libcerror_error_t **error )
+{
+	message_string_t *message_string = NULL;
+	system_character_t *buffer       = NULL;
+	size_t buffer_size               = 0;
+	size_t expected_string_length    = 0;
+	size_t formatted_string_length   = 0;
+	int result                       = 0;
+
+	if( evtx_test_tools_message_string_create(
+	     &message_string,
+	     string,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	result = message_string_format(
+	          message_string,
+	          NULL,
+	          &buffer,
+	          &buffer_size,
+	          &formatted_string_length,
+	          error );
+
+	if( result == 1 )
+	{
+		expected_string_length = system_string_length(
+		                          expected_string );
+
+		if( ( formatted_string_length != expected_string_length )
+		 || ( buffer[ formatted_string_length ] != 0 )
+		 || ( system_string_compare(
+		       buffer,
+		       expected_string,
+		       expected_string_length ) != 0 ) )
+		{
+			result = 0;
+		}
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	message_string_free(
+	 &message_string,
+	 NULL );
+
+	return( result );
+}
+
+/* Tests the message_string_compile function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_message_string_compile(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	message_string_t *message_string = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = evtx_test_tools_message_string_create(
+	          &message_string,
+	          _SYSTEM_STRING( "Logon %1!s!%n\r\nUser: %12" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_string_compile(
+	          message_string,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "message_string->is_compiled",
+	 message_string->is_compiled,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "message_string->number_of_segments",
+	 message_string->number_of_segments,
+	 6 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "message_string->segments[ 0 ].type",
+	 message_string->segments[ 0 ].type,
+	 MESSAGE_STRING_SEGMENT_TYPE_TEXT );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "message_string->segments[ 0 ].string_length",
+	 message_string->segments[ 0 ].string_length,
+	 (size_t) 6 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "message_string->segments[ 1 ].type",
+	 message_string->segments[ 1 ].type,
+	 MESSAGE_STRING_SEGMENT_TYPE_ARGUMENT );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "message_string->segments[ 1 ].string_index",
+	 message_string->segments[ 1 ].string_index,
+	 (size_t) 6 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "message_string->segments[ 1 ].string_length",
+	 message_string->segments[ 1 ].string_length,
+	 (size_t) 5 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "message_string->segments[ 1 ].value_string_index",
+	 message_string->segments[ 1 ].value_string_index,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "message_string->segments[ 2 ].type",
+	 message_string->segments[ 2 ].type,
+	 MESSAGE_STRING_SEGMENT_TYPE_NEW_LINE );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "message_string->segments[ 3 ].type",
+	 message_string->segments[ 3 ].type,
+	 MESSAGE_STRING_SEGMENT_TYPE_NEW_LINE );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "message_string->segments[ 4 ].type",
+	 message_string->segments[ 4 ].type,
+	 MESSAGE_STRING_SEGMENT_TYPE_TEXT );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "message_string->segments[ 4 ].string_length",
+	 message_string->segments[ 4 ].string_length,
+	 (size_t) 6 );
+
+	/* Test a two digit conversion specifier at the end of the string
+	 */
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "message_string->segments[ 5 ].type",
+	 message_string->segments[ 5 ].type,
+	 MESSAGE_STRING_SEGMENT_TYPE_ARGUMENT );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "message_string->segments[ 5 ].string_length",
+	 message_string->segments[ 5 ].string_length,
+	 (size_t) 3 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "message_string->segments[ 5 ].value_string_index",
+	 message_string->segments[ 5 ].value_string_index,
+	 11 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "message_string->segments_text_length",
+	 message_string->segments_text_length,
+	 (size_t) 12 );
+
+	/* Test compile of a string that was already compiled
+	 */
+	result = message_string_compile(
+	          message_string,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "message_string->number_of_segments",
+	 message_string->number_of_segments,
+	 6 );
+
+	result = message_string_free(
+	          &message_string,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an unsupported conversion specifier
+	 */
+	result = evtx_test_tools_message_string_create(
+	          &message_string,
+	          _SYSTEM_STRING( "Text %x" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_string_compile(
+	          message_string,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "message_string->is_compiled",
+	 message_string->is_compiled,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "message_string->number_of_segments",
+	 message_string->number_of_segments,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_string->segments_text",
+	 message_string->segments_text );
+
+	result = message_string_free(
+	          &message_string,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = message_string_compile(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_string != NULL )
+	{
+		message_string_free(
+		 &message_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the message_string_format function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_message_string_format(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	message_string_t *message_string = NULL;
+	system_character_t *buffer       = NULL;
+	size_t buffer_size               = 0;
+	size_t formatted_string_length   = 0;
+	int result                       = 0;
+
+	/* Test that %n and \n are collapsed into a single new line
+	 */
+	result = evtx_test_tools_message_string_format_string(
+	          _SYSTEM_STRING( "Line 1%n%n\n\nLine 2\n%n" ),
+	          _SYSTEM_STRING( "Line 1\nLine 2\n" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that %r and \r are dropped
+	 */
+	result = evtx_test_tools_message_string_format_string(
+	          _SYSTEM_STRING( "Line 1\r\nLine 2%r%nLine%r 3\r" ),
+	          _SYSTEM_STRING( "Line 1\nLine 2\nLine 3" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the replacement of escaped characters
+	 */
+	result = evtx_test_tools_message_string_format_string(
+	          _SYSTEM_STRING( "%%%!%.%b%t%0" ),
+	          _SYSTEM_STRING( "%!. \t" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a conversion specifier without corresponding string is retained
+	 * and that the character following the conversion specifier is considered
+	 * the last character for collapsing new lines
+	 */
+	result = evtx_test_tools_message_string_format_string(
+	          _SYSTEM_STRING( "Value: %12!s!\n\nNext: %2%nEnd" ),
+	          _SYSTEM_STRING( "Value: %12!s!Next: %2\nEnd" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a two digit conversion specifier at the end of the string
+	 */
+	result = evtx_test_tools_message_string_format_string(
+	          _SYSTEM_STRING( "Value: %12" ),
+	          _SYSTEM_STRING( "Value: %12" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_tools_message_string_format_string(
+	          _SYSTEM_STRING( "Value: %12!s!" ),
+	          _SYSTEM_STRING( "Value: %12!s!" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the buffer can be reused
+	 */
+	result = evtx_test_tools_message_string_create(
+	          &message_string,
+	          _SYSTEM_STRING( "Text %1" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = message_string_format(
+	          message_string,
+	          NULL,
+	          &buffer,
+	          &buffer_size,
+	          &formatted_string_length,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "formatted_string_length",
+	 formatted_string_length,
+	 (size_t) 7 );
+
+	result = message_string_format(
+	          message_string,
+	          NULL,
+	          &buffer,
+	          &buffer_size,
+	          &formatted_string_length,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "formatted_string_length",
+	 formatted_string_length,
+	 (size_t) 7 );
+
+	result = system_string_compare(
+	          buffer,
+	          _SYSTEM_STRING( "Text %1" ),
+	          8 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 buffer );
+
+	buffer      = NULL;
+	buffer_size = 0;
+
+	result = message_string_free(
+	          &message_string,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an unsupported conversion specifier does not produce output
+	 */
+	result = evtx_test_tools_message_string_create(
+	          &message_string,
+	          _SYSTEM_STRING( "Text %1!d! more text" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	formatted_string_length = 0;
+
+	result = message_string_format(
+	          message_string,
+	          NULL,
+	          &buffer,
+	          &buffer_size,
+	          &formatted_string_length,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "buffer",
+	 buffer );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "formatted_string_length",
+	 formatted_string_length,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = message_string_format(
+	          NULL,
+	          NULL,
+	          &buffer,
+	          &buffer_size,
+	          &formatted_string_length,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = message_string_format(
+	          message_string,
+	          NULL,
+	          NULL,
+	          &buffer_size,
+	          &formatted_string_length,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = message_string_format(
+	          message_string,
+	          NULL,
+	          &buffer,
+	          NULL,
+	          &formatted_string_length,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = message_string_format(
+	          message_string,
+	          NULL,
+	          &buffer,
+	          &buffer_size,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = message_string_free(
+	          &message_string,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( message_string != NULL )
+	{
+		message_string_free(
+		 &message_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -296,6 +1017,14 @@ int main(
 	 "message_string_free",
 	 evtx_test_tools_message_string_free );
 
+	EVTX_TEST_RUN(
+	 "message_string_compile",
+	 evtx_test_tools_message_string_compile );
+
+	EVTX_TEST_RUN(
+	 "message_string_format",
+	 evtx_test_tools_message_string_format );
+
 	return( EXIT_SUCCESS );
 
 on_error:
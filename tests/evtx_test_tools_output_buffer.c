@@ -0,0 +1,1186 @@
+/*
+ * Tools output_buffer type test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../evtxtools/output_buffer.h"
+
+/* Tests the output_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_output_buffer_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	int result                     = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stdout,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = output_buffer_initialize(
+	          NULL,
+	          stdout,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	output_buffer = (output_buffer_t *) 0x12345678UL;
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stdout,
+	          &error );
+
+	output_buffer = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test output_buffer_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = output_buffer_initialize(
+		          &output_buffer,
+		          stdout,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( output_buffer != NULL )
+			{
+				output_buffer_free(
+				 &output_buffer,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "output_buffer",
+			 output_buffer );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test output_buffer_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = output_buffer_initialize(
+		          &output_buffer,
+		          stdout,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( output_buffer != NULL )
+			{
+				output_buffer_free(
+				 &output_buffer,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "output_buffer",
+			 output_buffer );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_output_buffer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = output_buffer_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_commit_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_output_buffer_commit_string(
+     void )
+{
+	system_character_t *append_buffer = NULL;
+	libcerror_error_t *error          = NULL;
+	output_buffer_t *output_buffer    = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stdout,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = output_buffer_get_append_buffer(
+	          output_buffer,
+	          8,
+	          &append_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "append_buffer",
+	 append_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The string is shorter than the size reserved for it
+	 */
+	append_buffer[ 0 ] = (system_character_t) 'a';
+	append_buffer[ 1 ] = (system_character_t) 'b';
+	append_buffer[ 2 ] = (system_character_t) 'c';
+	append_buffer[ 3 ] = 0;
+	append_buffer[ 4 ] = (system_character_t) 'x';
+
+	result = output_buffer_commit_string(
+	          output_buffer,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->buffer_offset",
+	 output_buffer->buffer_offset,
+	 (size_t) 3 );
+
+	/* The string fills the size reserved for it without an end-of-string character
+	 */
+	result = output_buffer_get_append_buffer(
+	          output_buffer,
+	          2,
+	          &append_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "append_buffer",
+	 append_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	append_buffer[ 0 ] = (system_character_t) 'd';
+	append_buffer[ 1 ] = (system_character_t) 'e';
+
+	result = output_buffer_commit_string(
+	          output_buffer,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->buffer_offset",
+	 output_buffer->buffer_offset,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          output_buffer->buffer,
+	          _SYSTEM_STRING( "abcde" ),
+	          sizeof( system_character_t ) * 5 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_buffer_commit_string(
+	          NULL,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_commit_string(
+	          output_buffer,
+	          output_buffer->buffer_size - output_buffer->buffer_offset + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_append_decimal_64bit and output_buffer_append_hexadecimal_32bit functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_output_buffer_append_integer(
+     void )
+{
+	system_character_t expected_string[ 44 ] = {
+		'0', ' ', '1', '8', '4', '4', '6', '7', '4', '4', '0', '7', '3', '7', '0', '9', '5', '5', '1', '6', '1', '5', ' ', '0', 'x', '0', '0', '0', '0', '0', '0', '0', '0', ' ', '0', 'x', '0', '1', '2', '3', 'a', 'b', 'c', 'f' };
+
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stdout,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = output_buffer_append_decimal_64bit(
+	          output_buffer,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_string(
+	          output_buffer,
+	          _SYSTEM_STRING( " " ),
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_decimal_64bit(
+	          output_buffer,
+	          0xffffffffffffffffULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_string(
+	          output_buffer,
+	          _SYSTEM_STRING( " " ),
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_hexadecimal_32bit(
+	          output_buffer,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_string(
+	          output_buffer,
+	          _SYSTEM_STRING( " " ),
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_hexadecimal_32bit(
+	          output_buffer,
+	          0x0123abcfUL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->buffer_offset",
+	 output_buffer->buffer_offset,
+	 (size_t) 44 );
+
+	result = memory_compare(
+	          output_buffer->buffer,
+	          expected_string,
+	          sizeof( system_character_t ) * 44 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_buffer_append_decimal_64bit(
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_append_hexadecimal_32bit(
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_append_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_output_buffer_append_filetime(
+     void )
+{
+	system_character_t expected_string[ 93 ] = {
+		'D', 'e', 'c', ' ', '3', '1', ',', ' ', '2', '0', '1', '1', ' ', '1', '6', ':', '0', '0', ':', '0', '0', '.', '1', '2', '3', '4', '5', '6', '7', '0', '0',
+		'D', 'e', 'c', ' ', '3', '1', ',', ' ', '2', '0', '1', '1', ' ', '1', '6', ':', '0', '0', ':', '0', '0', '.', '9', '9', '9', '9', '9', '9', '9', '0', '0',
+		'D', 'e', 'c', ' ', '3', '1', ',', ' ', '2', '0', '1', '1', ' ', '1', '6', ':', '0', '0', ':', '0', '1', '.', '0', '0', '0', '0', '0', '0', '0', '0', '0' };
+
+	uint64_t filetimes[ 3 ] = {
+		129698208001234567ULL, 129698208009999999ULL, 129698208010000000ULL };
+
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	int filetime_index             = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stdout,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, where the second value uses the cached date and time
+	 */
+	for( filetime_index = 0;
+	     filetime_index < 3;
+	     filetime_index++ )
+	{
+		result = output_buffer_append_filetime(
+		          output_buffer,
+		          filetimes[ filetime_index ],
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->buffer_offset",
+	 output_buffer->buffer_offset,
+	 (size_t) 93 );
+
+	result = memory_compare(
+	          output_buffer->buffer,
+	          expected_string,
+	          sizeof( system_character_t ) * 93 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a FILETIME of 0 is not served from the date and time cached
+	 * for another value within the first second of 1601
+	 */
+	output_buffer->buffer_offset = 0;
+
+	result = output_buffer_append_filetime(
+	          output_buffer,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_filetime(
+	          output_buffer,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->buffer_offset",
+	 output_buffer->buffer_offset,
+	 (size_t) 42 );
+
+	result = memory_compare(
+	          output_buffer->buffer,
+	          _SYSTEM_STRING( "Jan 01, 1601 00:00:00.000000100Not set (0)" ),
+	          sizeof( system_character_t ) * 42 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_buffer_append_filetime(
+	          NULL,
+	          filetimes[ 0 ],
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_flush function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_output_buffer_flush(
+     void )
+{
+	uint8_t expected_data[ 5 ] = {
+		'a', 'b', 0, 'c', 'd' };
+
+	uint8_t data[ 16 ];
+
+	system_character_t *append_buffer = NULL;
+	libcerror_error_t *error          = NULL;
+	output_buffer_t *output_buffer    = NULL;
+	FILE *stream                      = NULL;
+	size_t read_count                 = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	stream = tmpfile();
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test flush of an empty buffer
+	 */
+	result = output_buffer_flush(
+	          output_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test flush of buffer data that contains an end-of-string character
+	 */
+	result = output_buffer_append_string(
+	          output_buffer,
+	          _SYSTEM_STRING( "ab" ),
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_get_append_buffer(
+	          output_buffer,
+	          1,
+	          &append_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "append_buffer",
+	 append_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	append_buffer[ 0 ] = 0;
+
+	result = output_buffer_commit(
+	          output_buffer,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_string(
+	          output_buffer,
+	          _SYSTEM_STRING( "cd" ),
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_flush(
+	          output_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->buffer_offset",
+	 output_buffer->buffer_offset,
+	 (size_t) 0 );
+
+	result = fflush(
+	          stream );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	rewind(
+	 stream );
+
+	read_count = file_stream_read(
+	              stream,
+	              data,
+	              16 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          5 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_buffer_flush(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = file_stream_close(
+	          stream );
+
+	stream = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "output_buffer_initialize",
+	 evtx_test_tools_output_buffer_initialize );
+
+	EVTX_TEST_RUN(
+	 "output_buffer_free",
+	 evtx_test_tools_output_buffer_free );
+
+	EVTX_TEST_RUN(
+	 "output_buffer_commit_string",
+	 evtx_test_tools_output_buffer_commit_string );
+
+	EVTX_TEST_RUN(
+	 "output_buffer_append_integer",
+	 evtx_test_tools_output_buffer_append_integer );
+
+	EVTX_TEST_RUN(
+	 "output_buffer_append_filetime",
+	 evtx_test_tools_output_buffer_append_filetime );
+
+	EVTX_TEST_RUN(
+	 "output_buffer_flush",
+	 evtx_test_tools_output_buffer_flush );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
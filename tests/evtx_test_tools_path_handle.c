@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,8 +34,21 @@
 #include "evtx_test_memory.h"
 #include "evtx_test_unused.h"
 
+#include "../evtxtools/evtxtools_libcdirectory.h"
 #include "../evtxtools/path_handle.h"
 
+/* A name with a non-ASCII character that differs only in case
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define EVTX_TEST_TOOLS_PATH_HANDLE_LOWER_CASE_NAME	L"\u00e9v\u00e9nements.dll"
+#define EVTX_TEST_TOOLS_PATH_HANDLE_UPPER_CASE_NAME	L"\u00c9V\u00c9NEMENTS.DLL"
+#define EVTX_TEST_TOOLS_PATH_HANDLE_CASE_NAME_LENGTH	14
+#else
+#define EVTX_TEST_TOOLS_PATH_HANDLE_LOWER_CASE_NAME	"\xc3\xa9v\xc3\xa9nements.dll"
+#define EVTX_TEST_TOOLS_PATH_HANDLE_UPPER_CASE_NAME	"\xc3\x89V\xc3\x89NEMENTS.DLL"
+#define EVTX_TEST_TOOLS_PATH_HANDLE_CASE_NAME_LENGTH	16
+#endif
+
 /* Tests the path_handle_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -268,6 +282,403 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the path_handle_calculate_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_path_handle_calculate_name_hash(
+     void )
+{
+	uint32_t hash          = 0;
+	uint32_t expected_hash = 0;
+	int result             = 0;
+
+	/* Test regular cases
+	 */
+	expected_hash = path_handle_calculate_name_hash(
+	                 _SYSTEM_STRING( "msaudite.dll" ),
+	                 12 );
+
+	hash = path_handle_calculate_name_hash(
+	        _SYSTEM_STRING( "MSAudite.DLL" ),
+	        12 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 expected_hash );
+
+	/* Test that names that compare equal ignoring case have the same hash
+	 */
+	expected_hash = path_handle_calculate_name_hash(
+	                 EVTX_TEST_TOOLS_PATH_HANDLE_LOWER_CASE_NAME,
+	                 EVTX_TEST_TOOLS_PATH_HANDLE_CASE_NAME_LENGTH );
+
+	hash = path_handle_calculate_name_hash(
+	        EVTX_TEST_TOOLS_PATH_HANDLE_UPPER_CASE_NAME,
+	        EVTX_TEST_TOOLS_PATH_HANDLE_CASE_NAME_LENGTH );
+
+	result = system_string_compare_no_case(
+	          EVTX_TEST_TOOLS_PATH_HANDLE_LOWER_CASE_NAME,
+	          EVTX_TEST_TOOLS_PATH_HANDLE_UPPER_CASE_NAME,
+	          EVTX_TEST_TOOLS_PATH_HANDLE_CASE_NAME_LENGTH );
+
+	if( result == 0 )
+	{
+		EVTX_TEST_ASSERT_EQUAL_UINT32(
+		 "hash",
+		 hash,
+		 expected_hash );
+	}
+	/* Test a name of 0 characters
+	 */
+	hash = path_handle_calculate_name_hash(
+	        _SYSTEM_STRING( "" ),
+	        0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0x811c9dc5UL );
+
+	hash = path_handle_calculate_name_hash(
+	        NULL,
+	        0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0x811c9dc5UL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the path_handle_directory_get_entry_by_name_no_case function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_path_handle_directory_get_entry_by_name_no_case(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	path_handle_directory_t *directory             = NULL;
+	path_handle_directory_entry_t *directory_entry = NULL;
+	int bucket_index                               = 0;
+	int entry_index                                = 0;
+	int expected_result                            = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = path_handle_directory_initialize(
+	          &directory,
+	          _SYSTEM_STRING( "Windows" ),
+	          7,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = path_handle_directory_append_entry(
+	          directory,
+	          _SYSTEM_STRING( "System32" ),
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = path_handle_directory_append_entry(
+	          directory,
+	          _SYSTEM_STRING( "explorer.exe" ),
+	          12,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = path_handle_directory_append_entry(
+	          directory,
+	          EVTX_TEST_TOOLS_PATH_HANDLE_LOWER_CASE_NAME,
+	          EVTX_TEST_TOOLS_PATH_HANDLE_CASE_NAME_LENGTH,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Build the buckets as path_handle_directory_read would do
+	 */
+	directory->buckets = (int *) memory_allocate(
+	                              sizeof( int ) * 16 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "directory->buckets",
+	 directory->buckets );
+
+	directory->number_of_buckets = 16;
+
+	for( bucket_index = 0;
+	     bucket_index < 16;
+	     bucket_index++ )
+	{
+		directory->buckets[ bucket_index ] = -1;
+	}
+	for( entry_index = 0;
+	     entry_index < directory->number_of_entries;
+	     entry_index++ )
+	{
+		bucket_index = (int) ( directory->entries[ entry_index ].hash & 15 );
+
+		directory->entries[ entry_index ].next_entry_index = directory->buckets[ bucket_index ];
+		directory->buckets[ bucket_index ]                 = entry_index;
+	}
+	/* Test regular cases
+	 */
+	result = path_handle_directory_get_entry_by_name_no_case(
+	          directory,
+	          _SYSTEM_STRING( "SYSTEM32" ),
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+	          &directory_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          directory_entry->name,
+	          _SYSTEM_STRING( "System32" ),
+	          8 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = path_handle_directory_get_entry_by_name_no_case(
+	          directory,
+	          _SYSTEM_STRING( "Explorer.EXE" ),
+	          12,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          &directory_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a name that compares equal ignoring case resolves to the same entry
+	 */
+	result = system_string_compare_no_case(
+	          EVTX_TEST_TOOLS_PATH_HANDLE_LOWER_CASE_NAME,
+	          EVTX_TEST_TOOLS_PATH_HANDLE_UPPER_CASE_NAME,
+	          EVTX_TEST_TOOLS_PATH_HANDLE_CASE_NAME_LENGTH );
+
+	if( result == 0 )
+	{
+		expected_result = 1;
+	}
+
+	result = path_handle_directory_get_entry_by_name_no_case(
+	          directory,
+	          EVTX_TEST_TOOLS_PATH_HANDLE_UPPER_CASE_NAME,
+	          EVTX_TEST_TOOLS_PATH_HANDLE_CASE_NAME_LENGTH,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          &directory_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an entry of a different type
+	 */
+	result = path_handle_directory_get_entry_by_name_no_case(
+	          directory,
+	          _SYSTEM_STRING( "explorer.exe" ),
+	          12,
+	          LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+	          &directory_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a missing entry
+	 */
+	result = path_handle_directory_get_entry_by_name_no_case(
+	          directory,
+	          _SYSTEM_STRING( "System" ),
+	          6,
+	          LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+	          &directory_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = path_handle_directory_get_entry_by_name_no_case(
+	          NULL,
+	          _SYSTEM_STRING( "System32" ),
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+	          &directory_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = path_handle_directory_get_entry_by_name_no_case(
+	          directory,
+	          NULL,
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+	          &directory_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = path_handle_directory_get_entry_by_name_no_case(
+	          directory,
+	          _SYSTEM_STRING( "System32" ),
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = path_handle_directory_free(
+	          &directory,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		path_handle_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -291,6 +702,14 @@ int main(
 	 "path_handle_free",
 	 evtx_test_tools_path_handle_free );
 
+	EVTX_TEST_RUN(
+	 "path_handle_calculate_name_hash",
+	 evtx_test_tools_path_handle_calculate_name_hash );
+
+	EVTX_TEST_RUN(
+	 "path_handle_directory_get_entry_by_name_no_case",
+	 evtx_test_tools_path_handle_directory_get_entry_by_name_no_case );
+
 	return( EXIT_SUCCESS );
 
 on_error:
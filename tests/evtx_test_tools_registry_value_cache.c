@@ -0,0 +1,1279 @@
+/*
+ * Tools registry_value_cache type test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../evtxtools/registry_value_cache.h"
+
+/* Tests the registry_value_cache_calculate_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_registry_value_cache_calculate_hash(
+     void )
+{
+	uint32_t hash          = 0;
+	uint32_t expected_hash = 0;
+
+	/* Test regular cases
+	 */
+	expected_hash = registry_value_cache_calculate_hash(
+	                 REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	                 "SYSTEM\\ControlSet001\\Services\\EventLog",
+	                 38,
+	                 _SYSTEM_STRING( "Application\\Security" ),
+	                 20,
+	                 _SYSTEM_STRING( "EventMessageFile" ),
+	                 16 );
+
+	/* Test that the hash is case insensitive
+	 */
+	hash = registry_value_cache_calculate_hash(
+	        REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	        "system\\controlset001\\services\\eventlog",
+	        38,
+	        _SYSTEM_STRING( "APPLICATION\\security" ),
+	        20,
+	        _SYSTEM_STRING( "eventmessagefile" ),
+	        16 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 expected_hash );
+
+	/* Test that the key type is part of the hash
+	 */
+	hash = registry_value_cache_calculate_hash(
+	        REGISTRY_VALUE_CACHE_KEY_TYPE_PROVIDER_IDENTIFIER,
+	        "SYSTEM\\ControlSet001\\Services\\EventLog",
+	        38,
+	        _SYSTEM_STRING( "Application\\Security" ),
+	        20,
+	        _SYSTEM_STRING( "EventMessageFile" ),
+	        16 );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "hash",
+	 (int32_t) hash,
+	 (int32_t) expected_hash );
+
+	/* Test that the names are separated
+	 */
+	expected_hash = registry_value_cache_calculate_hash(
+	                 REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	                 NULL,
+	                 0,
+	                 _SYSTEM_STRING( "ab" ),
+	                 2,
+	                 _SYSTEM_STRING( "c" ),
+	                 1 );
+
+	hash = registry_value_cache_calculate_hash(
+	        REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	        NULL,
+	        0,
+	        _SYSTEM_STRING( "a" ),
+	        1,
+	        _SYSTEM_STRING( "bc" ),
+	        2 );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "hash",
+	 (int32_t) hash,
+	 (int32_t) expected_hash );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the registry_value_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_registry_value_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	registry_value_cache_t *registry_value_cache = NULL;
+	int result                                   = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = registry_value_cache_initialize(
+	          &registry_value_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "registry_value_cache",
+	 registry_value_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = registry_value_cache_free(
+	          &registry_value_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "registry_value_cache",
+	 registry_value_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = registry_value_cache_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	registry_value_cache = (registry_value_cache_t *) 0x12345678UL;
+
+	result = registry_value_cache_initialize(
+	          &registry_value_cache,
+	          &error );
+
+	registry_value_cache = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test registry_value_cache_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = registry_value_cache_initialize(
+		          &registry_value_cache,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( registry_value_cache != NULL )
+			{
+				registry_value_cache_free(
+				 &registry_value_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "registry_value_cache",
+			 registry_value_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test registry_value_cache_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = registry_value_cache_initialize(
+		          &registry_value_cache,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( registry_value_cache != NULL )
+			{
+				registry_value_cache_free(
+				 &registry_value_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "registry_value_cache",
+			 registry_value_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( registry_value_cache != NULL )
+	{
+		registry_value_cache_free(
+		 &registry_value_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the registry_value_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_registry_value_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = registry_value_cache_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the registry_value_cache_entry_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_registry_value_cache_entry_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = registry_value_cache_entry_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the registry_value_cache_get_entry and registry_value_cache_insert_value functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_registry_value_cache_get_entry(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	registry_value_cache_t *registry_value_cache             = NULL;
+	registry_value_cache_entry_t *registry_value_cache_entry = NULL;
+	int result                                               = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests                          = 5;
+	int test_number                                          = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = registry_value_cache_initialize(
+	          &registry_value_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "registry_value_cache",
+	 registry_value_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = registry_value_cache_get_entry(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          "SYSTEM\\ControlSet001\\Services\\EventLog",
+	          38,
+	          _SYSTEM_STRING( "Application\\Security" ),
+	          20,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          &registry_value_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = registry_value_cache_insert_value(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          "SYSTEM\\ControlSet001\\Services\\EventLog",
+	          38,
+	          _SYSTEM_STRING( "Application\\Security" ),
+	          20,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          _SYSTEM_STRING( "%SystemRoot%\\System32\\msaudite.dll" ),
+	          35,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test insert of a value that is not available
+	 */
+	result = registry_value_cache_insert_value(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          "SYSTEM\\ControlSet001\\Services\\EventLog",
+	          38,
+	          _SYSTEM_STRING( "Application\\Security" ),
+	          20,
+	          _SYSTEM_STRING( "ParameterMessageFile" ),
+	          20,
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test insert of a value without parent key name
+	 */
+	result = registry_value_cache_insert_value(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_PROVIDER_IDENTIFIER,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "{54849625-5478-4994-a5ba-3e3b0328c30d}" ),
+	          38,
+	          _SYSTEM_STRING( "MessageFileName" ),
+	          15,
+	          _SYSTEM_STRING( "adtschema.dll" ),
+	          14,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "registry_value_cache->number_of_entries",
+	 registry_value_cache->number_of_entries,
+	 3 );
+
+	/* Test that the names are compared case insensitive
+	 */
+	registry_value_cache_entry = NULL;
+
+	result = registry_value_cache_get_entry(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          "system\\controlset001\\services\\eventlog",
+	          38,
+	          _SYSTEM_STRING( "APPLICATION\\SECURITY" ),
+	          20,
+	          _SYSTEM_STRING( "eventmessagefile" ),
+	          16,
+	          &registry_value_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "registry_value_cache_entry",
+	 registry_value_cache_entry );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "registry_value_cache_entry->value_string",
+	 registry_value_cache_entry->value_string );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "registry_value_cache_entry->value_string_size",
+	 registry_value_cache_entry->value_string_size,
+	 (size_t) 35 );
+
+	result = system_string_compare(
+	          registry_value_cache_entry->value_string,
+	          _SYSTEM_STRING( "%SystemRoot%\\System32\\msaudite.dll" ),
+	          35 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a value that is not available is returned as a negative entry
+	 */
+	registry_value_cache_entry = NULL;
+
+	result = registry_value_cache_get_entry(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          "SYSTEM\\ControlSet001\\Services\\EventLog",
+	          38,
+	          _SYSTEM_STRING( "Application\\Security" ),
+	          20,
+	          _SYSTEM_STRING( "ParameterMessageFile" ),
+	          20,
+	          &registry_value_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "registry_value_cache_entry",
+	 registry_value_cache_entry );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "registry_value_cache_entry->value_string",
+	 registry_value_cache_entry->value_string );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "registry_value_cache_entry->value_string_size",
+	 registry_value_cache_entry->value_string_size,
+	 (size_t) 0 );
+
+	/* Test retrieval of a value without parent key name
+	 */
+	registry_value_cache_entry = NULL;
+
+	result = registry_value_cache_get_entry(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_PROVIDER_IDENTIFIER,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "{54849625-5478-4994-A5BA-3E3B0328C30D}" ),
+	          38,
+	          _SYSTEM_STRING( "MessageFileName" ),
+	          15,
+	          &registry_value_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "registry_value_cache_entry",
+	 registry_value_cache_entry );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "registry_value_cache_entry->parent_key_name",
+	 registry_value_cache_entry->parent_key_name );
+
+	/* Test that a different key type is not available
+	 */
+	result = registry_value_cache_get_entry(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "{54849625-5478-4994-a5ba-3e3b0328c30d}" ),
+	          38,
+	          _SYSTEM_STRING( "MessageFileName" ),
+	          15,
+	          &registry_value_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a different parent key name is not available
+	 */
+	result = registry_value_cache_get_entry(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          "SYSTEM\\ControlSet002\\Services\\EventLog",
+	          38,
+	          _SYSTEM_STRING( "Application\\Security" ),
+	          20,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          &registry_value_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = registry_value_cache_get_entry(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_PROVIDER_IDENTIFIER,
+	          "SYSTEM\\ControlSet001\\Services\\EventLog",
+	          38,
+	          _SYSTEM_STRING( "{54849625-5478-4994-a5ba-3e3b0328c30d}" ),
+	          38,
+	          _SYSTEM_STRING( "MessageFileName" ),
+	          15,
+	          &registry_value_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a different value name is not available
+	 */
+	result = registry_value_cache_get_entry(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          "SYSTEM\\ControlSet001\\Services\\EventLog",
+	          38,
+	          _SYSTEM_STRING( "Application\\Security" ),
+	          20,
+	          _SYSTEM_STRING( "EventMessageFil" ),
+	          15,
+	          &registry_value_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = registry_value_cache_get_entry(
+	          NULL,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          &registry_value_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = registry_value_cache_get_entry(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          NULL,
+	          0,
+	          NULL,
+	          11,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          &registry_value_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = registry_value_cache_get_entry(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          NULL,
+	          16,
+	          &registry_value_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = registry_value_cache_get_entry(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = registry_value_cache_insert_value(
+	          NULL,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = registry_value_cache_insert_value(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          NULL,
+	          0,
+	          NULL,
+	          11,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = registry_value_cache_insert_value(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          NULL,
+	          16,
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = registry_value_cache_insert_value(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          _SYSTEM_STRING( "test.dll" ),
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test registry_value_cache_insert_value with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = registry_value_cache_insert_value(
+		          registry_value_cache,
+		          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+		          "SYSTEM\\ControlSet001\\Services\\EventLog",
+		          38,
+		          _SYSTEM_STRING( "System" ),
+		          6,
+		          _SYSTEM_STRING( "EventMessageFile" ),
+		          16,
+		          _SYSTEM_STRING( "test.dll" ),
+		          9,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "registry_value_cache->number_of_entries",
+			 registry_value_cache->number_of_entries,
+			 3 );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = registry_value_cache_free(
+	          &registry_value_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "registry_value_cache",
+	 registry_value_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( registry_value_cache != NULL )
+	{
+		registry_value_cache_free(
+		 &registry_value_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the registry_value_cache_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_registry_value_cache_empty(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	registry_value_cache_t *registry_value_cache             = NULL;
+	registry_value_cache_entry_t *registry_value_cache_entry = NULL;
+	int bucket_index                                         = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = registry_value_cache_initialize(
+	          &registry_value_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "registry_value_cache",
+	 registry_value_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = registry_value_cache_insert_value(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          _SYSTEM_STRING( "test.dll" ),
+	          9,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = registry_value_cache_insert_value(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "System" ),
+	          6,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = registry_value_cache_empty(
+	          registry_value_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "registry_value_cache->number_of_entries",
+	 registry_value_cache->number_of_entries,
+	 0 );
+
+	for( bucket_index = 0;
+	     bucket_index < REGISTRY_VALUE_CACHE_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "registry_value_cache->buckets[ bucket_index ]",
+		 registry_value_cache->buckets[ bucket_index ] );
+	}
+	result = registry_value_cache_get_entry(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          &registry_value_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an empty cache can be emptied
+	 */
+	result = registry_value_cache_empty(
+	          registry_value_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = registry_value_cache_empty(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a cache with entries can be freed
+	 */
+	result = registry_value_cache_insert_value(
+	          registry_value_cache,
+	          REGISTRY_VALUE_CACHE_KEY_TYPE_EVENT_SOURCE,
+	          NULL,
+	          0,
+	          _SYSTEM_STRING( "Application" ),
+	          11,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          _SYSTEM_STRING( "test.dll" ),
+	          9,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = registry_value_cache_free(
+	          &registry_value_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "registry_value_cache",
+	 registry_value_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( registry_value_cache != NULL )
+	{
+		registry_value_cache_free(
+		 &registry_value_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "registry_value_cache_calculate_hash",
+	 evtx_test_tools_registry_value_cache_calculate_hash );
+
+	EVTX_TEST_RUN(
+	 "registry_value_cache_entry_free",
+	 evtx_test_tools_registry_value_cache_entry_free );
+
+	EVTX_TEST_RUN(
+	 "registry_value_cache_initialize",
+	 evtx_test_tools_registry_value_cache_initialize );
+
+	EVTX_TEST_RUN(
+	 "registry_value_cache_free",
+	 evtx_test_tools_registry_value_cache_free );
+
+	EVTX_TEST_RUN(
+	 "registry_value_cache_empty",
+	 evtx_test_tools_registry_value_cache_empty );
+
+	EVTX_TEST_RUN(
+	 "registry_value_cache_get_entry",
+	 evtx_test_tools_registry_value_cache_get_entry );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
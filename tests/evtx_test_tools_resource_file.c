@@ -273,6 +273,108 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the resource_file_open_resource_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_resource_file_open_resource_stream(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	resource_file_t *resource_file = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = resource_file_initialize(
+	          &resource_file,
+	          0x00000409UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "resource_file",
+	 resource_file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = resource_file_open_resource_stream(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test resource file not open
+	 */
+	result = resource_file_open_resource_stream(
+	          resource_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = resource_file_free(
+	          &resource_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "resource_file",
+	 resource_file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resource_file != NULL )
+	{
+		resource_file_free(
+		 &resource_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -296,6 +398,10 @@ int main(
 	 "resource_file_free",
 	 evtx_test_tools_resource_file_free );
 
+	EVTX_TEST_RUN(
+	 "resource_file_open_resource_stream",
+	 evtx_test_tools_resource_file_open_resource_stream );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,657 @@
+/*
+ * Tools resource_file_cache type test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../evtxtools/resource_file.h"
+#include "../evtxtools/resource_file_cache.h"
+
+/* Tests the resource_file_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_resource_file_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	resource_file_cache_t *resource_file_cache = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 1;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = resource_file_cache_initialize(
+	          &resource_file_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "resource_file_cache",
+	 resource_file_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resource_file_cache_free(
+	          &resource_file_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "resource_file_cache",
+	 resource_file_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = resource_file_cache_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	resource_file_cache = (resource_file_cache_t *) 0x12345678UL;
+
+	result = resource_file_cache_initialize(
+	          &resource_file_cache,
+	          &error );
+
+	resource_file_cache = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test resource_file_cache_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = resource_file_cache_initialize(
+		          &resource_file_cache,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( resource_file_cache != NULL )
+			{
+				resource_file_cache_free(
+				 &resource_file_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "resource_file_cache",
+			 resource_file_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test resource_file_cache_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = resource_file_cache_initialize(
+		          &resource_file_cache,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( resource_file_cache != NULL )
+			{
+				resource_file_cache_free(
+				 &resource_file_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "resource_file_cache",
+			 resource_file_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resource_file_cache != NULL )
+	{
+		resource_file_cache_free(
+		 &resource_file_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the resource_file_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_resource_file_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = resource_file_cache_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Creates a resource file with a specific name for testing
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_test_tools_resource_file_cache_create_resource_file(
+     const system_character_t *name,
+     size_t name_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	if( resource_file_initialize(
+	     resource_file,
+	     0x00000409UL,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( resource_file_set_name(
+	     *resource_file,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		resource_file_free(
+		 resource_file,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the resource_file_cache_get_resource_file and resource_file_cache_insert_resource_file functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_resource_file_cache_get_resource_file(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	resource_file_t *cached_resource_file      = NULL;
+	resource_file_t *resource_file             = NULL;
+	resource_file_cache_t *resource_file_cache = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = resource_file_cache_initialize(
+	          &resource_file_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "resource_file_cache",
+	 resource_file_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resource_file_cache_set_maximum_number_of_entries(
+	          resource_file_cache,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_tools_resource_file_cache_create_resource_file(
+	          _SYSTEM_STRING( "%SystemRoot%\\System32\\Kernel32.dll" ),
+	          34,
+	          &resource_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = resource_file_cache_insert_resource_file(
+	          resource_file_cache,
+	          resource_file,
+	          &error );
+
+	resource_file = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_tools_resource_file_cache_create_resource_file(
+	          _SYSTEM_STRING( "%SystemRoot%\\System32\\wevtapi.dll" ),
+	          33,
+	          &resource_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = resource_file_cache_insert_resource_file(
+	          resource_file_cache,
+	          resource_file,
+	          &error );
+
+	resource_file = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          _SYSTEM_STRING( "%SYSTEMROOT%\\system32\\KERNEL32.DLL" ),
+	          34,
+	          &cached_resource_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "cached_resource_file",
+	 cached_resource_file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          _SYSTEM_STRING( "%SystemRoot%\\System32\\user32.dll" ),
+	          32,
+	          &cached_resource_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Inserting a third resource file removes the least recently used one
+	 */
+	result = evtx_test_tools_resource_file_cache_create_resource_file(
+	          _SYSTEM_STRING( "%SystemRoot%\\System32\\user32.dll" ),
+	          32,
+	          &resource_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = resource_file_cache_insert_resource_file(
+	          resource_file_cache,
+	          resource_file,
+	          &error );
+
+	resource_file = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "resource_file_cache->number_of_entries",
+	 resource_file_cache->number_of_entries,
+	 2 );
+
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          _SYSTEM_STRING( "%SystemRoot%\\System32\\wevtapi.dll" ),
+	          33,
+	          &cached_resource_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          _SYSTEM_STRING( "%SystemRoot%\\System32\\Kernel32.dll" ),
+	          34,
+	          &cached_resource_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = resource_file_cache_get_resource_file(
+	          NULL,
+	          _SYSTEM_STRING( "%SystemRoot%\\System32\\Kernel32.dll" ),
+	          34,
+	          &cached_resource_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          NULL,
+	          34,
+	          &cached_resource_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          _SYSTEM_STRING( "%SystemRoot%\\System32\\Kernel32.dll" ),
+	          34,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resource_file_cache_insert_resource_file(
+	          resource_file_cache,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = resource_file_cache_free(
+	          &resource_file_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "resource_file_cache",
+	 resource_file_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resource_file != NULL )
+	{
+		resource_file_free(
+		 &resource_file,
+		 NULL );
+	}
+	if( resource_file_cache != NULL )
+	{
+		resource_file_cache_free(
+		 &resource_file_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "resource_file_cache_initialize",
+	 evtx_test_tools_resource_file_cache_initialize );
+
+	EVTX_TEST_RUN(
+	 "resource_file_cache_free",
+	 evtx_test_tools_resource_file_cache_free );
+
+	EVTX_TEST_RUN(
+	 "resource_file_cache_get_resource_file",
+	 evtx_test_tools_resource_file_cache_get_resource_file );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1149 @@
+/*
+ * Tools template_definition_cache type test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../evtxtools/template_definition_cache.h"
+
+/* Tests the template_definition_cache_calculate_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_template_definition_cache_calculate_hash(
+     void )
+{
+	uint8_t provider_identifier[ 16 ] = {
+		0x25, 0x96, 0x84, 0x54, 0x78, 0x54, 0x94, 0x49, 0xa5, 0xba, 0x3e, 0x3b, 0x03, 0x28, 0xc3, 0x0d };
+
+	uint32_t hash                     = 0;
+	uint32_t expected_hash            = 0;
+
+	/* Test regular cases
+	 */
+	expected_hash = template_definition_cache_calculate_hash(
+	                 provider_identifier,
+	                 4624,
+	                 2 );
+
+	hash = template_definition_cache_calculate_hash(
+	        provider_identifier,
+	        4624,
+	        2 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 expected_hash );
+
+	/* Test that the event identifier and version are part of the hash
+	 */
+	hash = template_definition_cache_calculate_hash(
+	        provider_identifier,
+	        4625,
+	        2 );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "hash",
+	 (int32_t) hash,
+	 (int32_t) expected_hash );
+
+	hash = template_definition_cache_calculate_hash(
+	        provider_identifier,
+	        4624,
+	        1 );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "hash",
+	 (int32_t) hash,
+	 (int32_t) expected_hash );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the template_definition_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_template_definition_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                               = NULL;
+	template_definition_cache_t *template_definition_cache = NULL;
+	int result                                             = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = template_definition_cache_initialize(
+	          &template_definition_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_definition_cache",
+	 template_definition_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = template_definition_cache_free(
+	          &template_definition_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "template_definition_cache",
+	 template_definition_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = template_definition_cache_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	template_definition_cache = (template_definition_cache_t *) 0x12345678UL;
+
+	result = template_definition_cache_initialize(
+	          &template_definition_cache,
+	          &error );
+
+	template_definition_cache = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test template_definition_cache_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = template_definition_cache_initialize(
+		          &template_definition_cache,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( template_definition_cache != NULL )
+			{
+				template_definition_cache_free(
+				 &template_definition_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "template_definition_cache",
+			 template_definition_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test template_definition_cache_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = template_definition_cache_initialize(
+		          &template_definition_cache,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( template_definition_cache != NULL )
+			{
+				template_definition_cache_free(
+				 &template_definition_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "template_definition_cache",
+			 template_definition_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_definition_cache != NULL )
+	{
+		template_definition_cache_free(
+		 &template_definition_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the template_definition_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_template_definition_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = template_definition_cache_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the template_definition_cache_entry_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_template_definition_cache_entry_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = template_definition_cache_entry_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the template_definition_cache_get_entry and template_definition_cache_insert_template_definition functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_template_definition_cache_get_entry(
+     void )
+{
+	uint8_t provider_identifier[ 16 ] = {
+		0x25, 0x96, 0x84, 0x54, 0x78, 0x54, 0x94, 0x49, 0xa5, 0xba, 0x3e, 0x3b, 0x03, 0x28, 0xc3, 0x0d };
+
+	uint8_t other_provider_identifier[ 16 ] = {
+		0x25, 0x96, 0x84, 0x54, 0x78, 0x54, 0x94, 0x49, 0xa5, 0xba, 0x3e, 0x3b, 0x03, 0x28, 0xc3, 0x0e };
+
+	libcerror_error_t *error                                           = NULL;
+	libevtx_template_definition_t *template_definition                 = NULL;
+	template_definition_cache_t *template_definition_cache             = NULL;
+	template_definition_cache_entry_t *template_definition_cache_entry = NULL;
+	int result                                                         = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests                                    = 1;
+	int number_of_memset_fail_tests                                    = 1;
+	int test_number                                                    = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = template_definition_cache_initialize(
+	          &template_definition_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_definition_cache",
+	 template_definition_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_template_definition_initialize(
+	          &template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_definition",
+	 template_definition );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = template_definition_cache_get_entry(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4624,
+	          2,
+	          &template_definition_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = template_definition_cache_insert_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4624,
+	          2,
+	          template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cache takes over management of the template definition
+	 */
+	template_definition = NULL;
+
+	/* Test insert of a template definition that is not available
+	 */
+	result = template_definition_cache_insert_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4624,
+	          1,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "template_definition_cache->number_of_entries",
+	 template_definition_cache->number_of_entries,
+	 2 );
+
+	result = template_definition_cache_get_entry(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4624,
+	          2,
+	          &template_definition_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_definition_cache_entry",
+	 template_definition_cache_entry );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_definition_cache_entry->template_definition",
+	 template_definition_cache_entry->template_definition );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "template_definition_cache_entry->event_identifier",
+	 template_definition_cache_entry->event_identifier,
+	 (uint32_t) 4624 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "template_definition_cache_entry->event_version",
+	 template_definition_cache_entry->event_version,
+	 2 );
+
+	/* Test that a template definition that is not available is returned as a negative entry
+	 */
+	template_definition_cache_entry = NULL;
+
+	result = template_definition_cache_get_entry(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4624,
+	          1,
+	          &template_definition_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_definition_cache_entry",
+	 template_definition_cache_entry );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "template_definition_cache_entry->template_definition",
+	 template_definition_cache_entry->template_definition );
+
+	/* Test that a different provider identifier is not available
+	 */
+	result = template_definition_cache_get_entry(
+	          template_definition_cache,
+	          other_provider_identifier,
+	          16,
+	          4624,
+	          2,
+	          &template_definition_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a different event identifier is not available
+	 */
+	result = template_definition_cache_get_entry(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4625,
+	          2,
+	          &template_definition_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = template_definition_cache_get_entry(
+	          NULL,
+	          provider_identifier,
+	          16,
+	          4624,
+	          2,
+	          &template_definition_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = template_definition_cache_get_entry(
+	          template_definition_cache,
+	          NULL,
+	          16,
+	          4624,
+	          2,
+	          &template_definition_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = template_definition_cache_get_entry(
+	          template_definition_cache,
+	          provider_identifier,
+	          15,
+	          4624,
+	          2,
+	          &template_definition_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = template_definition_cache_get_entry(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4624,
+	          2,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = template_definition_cache_insert_template_definition(
+	          NULL,
+	          provider_identifier,
+	          16,
+	          4624,
+	          3,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = template_definition_cache_insert_template_definition(
+	          template_definition_cache,
+	          NULL,
+	          16,
+	          4624,
+	          3,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = template_definition_cache_insert_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          15,
+	          4624,
+	          3,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test template_definition_cache_insert_template_definition with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = template_definition_cache_insert_template_definition(
+		          template_definition_cache,
+		          provider_identifier,
+		          16,
+		          4624,
+		          3,
+		          NULL,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "template_definition_cache->number_of_entries",
+			 template_definition_cache->number_of_entries,
+			 2 );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test template_definition_cache_insert_template_definition with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = template_definition_cache_insert_template_definition(
+		          template_definition_cache,
+		          provider_identifier,
+		          16,
+		          4624,
+		          3,
+		          NULL,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "template_definition_cache->number_of_entries",
+			 template_definition_cache->number_of_entries,
+			 2 );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = template_definition_cache_free(
+	          &template_definition_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "template_definition_cache",
+	 template_definition_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_definition != NULL )
+	{
+		libevtx_template_definition_free(
+		 &template_definition,
+		 NULL );
+	}
+	if( template_definition_cache != NULL )
+	{
+		template_definition_cache_free(
+		 &template_definition_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the template_definition_cache_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_template_definition_cache_empty(
+     void )
+{
+	uint8_t provider_identifier[ 16 ] = {
+		0x25, 0x96, 0x84, 0x54, 0x78, 0x54, 0x94, 0x49, 0xa5, 0xba, 0x3e, 0x3b, 0x03, 0x28, 0xc3, 0x0d };
+
+	libcerror_error_t *error                                           = NULL;
+	libevtx_template_definition_t *template_definition                 = NULL;
+	template_definition_cache_t *template_definition_cache             = NULL;
+	template_definition_cache_entry_t *template_definition_cache_entry = NULL;
+	int bucket_index                                                   = 0;
+	int result                                                         = 0;
+
+	/* Initialize test
+	 */
+	result = template_definition_cache_initialize(
+	          &template_definition_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_definition_cache",
+	 template_definition_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_template_definition_initialize(
+	          &template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = template_definition_cache_insert_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4624,
+	          2,
+	          template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	template_definition = NULL;
+
+	result = template_definition_cache_insert_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4625,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = template_definition_cache_empty(
+	          template_definition_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "template_definition_cache->number_of_entries",
+	 template_definition_cache->number_of_entries,
+	 0 );
+
+	for( bucket_index = 0;
+	     bucket_index < TEMPLATE_DEFINITION_CACHE_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "template_definition_cache->buckets[ bucket_index ]",
+		 template_definition_cache->buckets[ bucket_index ] );
+	}
+	result = template_definition_cache_get_entry(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4624,
+	          2,
+	          &template_definition_cache_entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an empty cache can be emptied
+	 */
+	result = template_definition_cache_empty(
+	          template_definition_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = template_definition_cache_empty(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a cache with entries can be freed
+	 */
+	result = template_definition_cache_insert_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4625,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = template_definition_cache_free(
+	          &template_definition_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "template_definition_cache",
+	 template_definition_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_definition != NULL )
+	{
+		libevtx_template_definition_free(
+		 &template_definition,
+		 NULL );
+	}
+	if( template_definition_cache != NULL )
+	{
+		template_definition_cache_free(
+		 &template_definition_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "template_definition_cache_calculate_hash",
+	 evtx_test_tools_template_definition_cache_calculate_hash );
+
+	EVTX_TEST_RUN(
+	 "template_definition_cache_entry_free",
+	 evtx_test_tools_template_definition_cache_entry_free );
+
+	EVTX_TEST_RUN(
+	 "template_definition_cache_initialize",
+	 evtx_test_tools_template_definition_cache_initialize );
+
+	EVTX_TEST_RUN(
+	 "template_definition_cache_free",
+	 evtx_test_tools_template_definition_cache_free );
+
+	EVTX_TEST_RUN(
+	 "template_definition_cache_empty",
+	 evtx_test_tools_template_definition_cache_empty );
+
+	EVTX_TEST_RUN(
+	 "template_definition_cache_get_entry",
+	 evtx_test_tools_template_definition_cache_get_entry );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -6,8 +6,8 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "chunk chunks_table error io_handle notify record record_values template_definition"
-$LibraryTestsWithInput = "file support"
+$LibraryTests = "chunk chunks_table error io_handle name_index notify record_index record_values template_definition"
+$LibraryTestsWithInput = "file record support"
 $OptionSets = ""
 
 $InputGlob = "*"
@@ -7,8 +7,8 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="chunk chunks_table error io_handle notify record record_values template_definition";
-LIBRARY_TESTS_WITH_INPUT="file support";
+LIBRARY_TESTS="chunk chunks_table error io_handle name_index notify record_index record_values template_definition";
+LIBRARY_TESTS_WITH_INPUT="file record support";
 OPTION_SETS=();
 
 INPUT_GLOB="*";
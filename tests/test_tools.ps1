@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$ToolsTests = "info_handle message_handle message_string output path_handle registry_file resource_file signal"
+$ToolsTests = "info_handle merge_handle message_cache message_handle message_string output output_buffer path_handle registry_file registry_value_cache resource_file resource_file_cache signal template_definition_cache"
 $ToolsTestsWithInput = ""
 
 $InputGlob = "*"
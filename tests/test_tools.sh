@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-TOOLS_TESTS="info_handle message_handle message_string output path_handle registry_file resource_file signal";
+TOOLS_TESTS="info_handle merge_handle message_cache message_handle message_string output output_buffer path_handle registry_file registry_value_cache resource_file resource_file_cache signal template_definition_cache";
 TOOLS_TESTS_WITH_INPUT="";
 OPTION_SETS=();
 